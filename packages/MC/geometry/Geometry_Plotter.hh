@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/Geometry_Plotter.hh
+ * \author agent
+ * \date   Mon Oct 19 02:40:26 2026
+ * \brief  Geometry_Plotter class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_geometry_Geometry_Plotter_hh
+#define MC_geometry_Geometry_Plotter_hh
+
+#include <memory>
+#include <string>
+
+#include "utils/Definitions.hh"
+#include "utils/Vector_Lite.hh"
+#include "Definitions.hh"
+#include "Bounding_Box.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Geometry_Plotter
+ * \brief Sample cell and material ids of a geometry on a regular grid.
+ *
+ * The plotter evaluates the cell and material id at the center of every
+ * pixel of a slice plane, or every voxel of a 3D box, using only point
+ * location in the geometry (no tracking).  The grid is decomposed over
+ * domains along its slowest-varying dimension, and the points on each domain
+ * are sampled in parallel over threads.  Points that are outside the
+ * geometry are given cell and material ids of -1.
+ *
+ * Cell volumes and their relative errors (eg. from Volume_Estimator) can be
+ * given to the plotter so that they are written with the plot.
+ *
+ * Results are written to HDF5 with the fields decomposed in the same way
+ * they were sampled (collectively if parallel HDF5 is available).  The
+ * fields are stored COLUMN-MAJOR on an \f$(N_0,N_1,N_2)\f$ grid, where
+ * \f$N_2 = 1\f$ for slices.
+ *
+ * \code
+   Geometry_Plotter<Core> plotter(geometry);
+
+   // plot the z = 10.0 plane of a 100x100 core on a 4096x4096 grid
+   plotter.slice(Space_Vector(0.0, 0.0, 10.0), Space_Vector(100.0, 0.0, 0.0),
+                 Space_Vector(0.0, 100.0, 0.0), 4096, 4096);
+   plotter.write("core_plot.h5");
+ * \endcode
+ */
+/*!
+ * \example geometry/test/tstGeometry_Plotter.cc
+ *
+ * Test of Geometry_Plotter.
+ */
+//===========================================================================//
+
+template<class Geometry>
+class Geometry_Plotter
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef Geometry                          Geometry_t;
+    typedef std::shared_ptr<const Geometry_t> SP_Geometry;
+    typedef typename Geometry_t::Geo_State_t  Geo_State_t;
+    typedef def::Space_Vector                 Space_Vector;
+    typedef def::Vec_Int                      Vec_Int;
+    typedef def::Vec_Dbl                      Vec_Dbl;
+    typedef Vector_Lite<int, 3>               Dim_Vector;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // Geometry.
+    SP_Geometry d_geometry;
+
+    // Cell and material ids on the local block of the grid.
+    Vec_Int d_cells, d_matids;
+
+    // Cell volumes and relative errors.
+    Vec_Dbl d_volumes, d_volume_err;
+
+  public:
+    // Constructor.
+    explicit Geometry_Plotter(SP_Geometry geometry);
+
+    // Sample a slice plane.
+    void slice(const Space_Vector &corner, const Space_Vector &u,
+               const Space_Vector &v, int Nu, int Nv);
+
+    // Sample the voxels of a box.
+    void voxelize(const Bounding_Box &box, int Nx, int Ny, int Nz);
+
+    // Set the cell volumes and relative errors to write.
+    void set_volumes(const Vec_Dbl &volumes, const Vec_Dbl &errors);
+
+    // Write the sampled data to HDF5.
+    void write(const std::string &filename) const;
+
+    // >>> ACCESSORS
+
+    //! Cell ids on the local block of the grid.
+    const Vec_Int& cells() const { return d_cells; }
+
+    //! Material ids on the local block of the grid.
+    const Vec_Int& matids() const { return d_matids; }
+
+    //! Global grid dimensions.
+    const Dim_Vector& global_dims() const { return d_N; }
+
+    //! Local grid dimensions.
+    const Dim_Vector& local_dims() const { return d_local; }
+
+    //! Offsets of the local block in the global grid.
+    const Dim_Vector& offsets() const { return d_offset; }
+
+    //! Cell volumes (empty until set_volumes is called).
+    const Vec_Dbl& volumes() const { return d_volumes; }
+
+    //! Relative errors of the cell volumes.
+    const Vec_Dbl& volume_errors() const { return d_volume_err; }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Grid origin and step vectors along each dimension.
+    Space_Vector d_origin;
+    Space_Vector d_step[3];
+
+    // Global/local grid dimensions and offsets of the local block.
+    Dim_Vector d_N, d_local, d_offset;
+
+    // Geometry extents.
+    Bounding_Box d_box;
+
+    // Decompose the grid and sample it.
+    void sample();
+};
+
+} // end namespace profugus
+
+#endif // MC_geometry_Geometry_Plotter_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Geometry_Plotter.hh
+//---------------------------------------------------------------------------//
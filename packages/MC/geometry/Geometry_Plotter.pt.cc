@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/Geometry_Plotter.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 02:40:26 2026
+ * \brief  Geometry_Plotter explicit instantiations.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Geometry_Plotter.t.hh"
+#include "RTK_Geometry.hh"
+#include "Mesh_Geometry.hh"
+
+namespace profugus
+{
+
+template class Geometry_Plotter<Core>;
+template class Geometry_Plotter<Mesh_Geometry>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Geometry_Plotter.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,317 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/Geometry_Plotter.t.hh
+ * \author agent
+ * \date   Mon Oct 19 02:40:26 2026
+ * \brief  Geometry_Plotter template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_geometry_Geometry_Plotter_t_hh
+#define MC_geometry_Geometry_Plotter_t_hh
+
+#include <algorithm>
+#include <vector>
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "utils/Serial_HDF5_Writer.hh"
+#include "utils/Parallel_HDF5_Writer.hh"
+#include "Geometry_Plotter.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+template<class Geometry>
+Geometry_Plotter<Geometry>::Geometry_Plotter(SP_Geometry geometry)
+    : d_geometry(geometry)
+    , d_N(0, 0, 0)
+    , d_local(0, 0, 0)
+    , d_offset(0, 0, 0)
+    , d_box(geometry->get_extents())
+{
+    REQUIRE(d_geometry);
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sample cell and material ids on a slice plane.
+ *
+ * The plane is the parallelogram spanned by the edge vectors \e u and \e v
+ * from \e corner.  It is divided into \f$N_u\times N_v\f$ pixels and the
+ * geometry is sampled at the pixel centers.
+ *
+ * \param corner lower-left corner of the plane
+ * \param u edge vector of the plane in the first (fastest) dimension
+ * \param v edge vector of the plane in the second dimension
+ * \param Nu number of pixels along \e u
+ * \param Nv number of pixels along \e v
+ */
+template<class Geometry>
+void Geometry_Plotter<Geometry>::slice(const Space_Vector &corner,
+                                       const Space_Vector &u,
+                                       const Space_Vector &v,
+                                       int                 Nu,
+                                       int                 Nv)
+{
+    REQUIRE(Nu > 0);
+    REQUIRE(Nv > 0);
+
+    d_origin = corner;
+    d_N      = Dim_Vector(Nu, Nv, 1);
+
+    for (int d = 0; d < 3; ++d)
+    {
+        d_step[0][d] = u[d] / Nu;
+        d_step[1][d] = v[d] / Nv;
+        d_step[2][d] = 0.0;
+    }
+
+    sample();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sample cell and material ids on the voxels of a box.
+ *
+ * \param box region to voxelize
+ * \param Nx number of voxels in x
+ * \param Ny number of voxels in y
+ * \param Nz number of voxels in z
+ */
+template<class Geometry>
+void Geometry_Plotter<Geometry>::voxelize(const Bounding_Box &box,
+                                          int                 Nx,
+                                          int                 Ny,
+                                          int                 Nz)
+{
+    using def::X; using def::Y; using def::Z;
+
+    REQUIRE(Nx > 0);
+    REQUIRE(Ny > 0);
+    REQUIRE(Nz > 0);
+
+    d_origin = box.lower();
+    d_N      = Dim_Vector(Nx, Ny, Nz);
+
+    for (int n = 0; n < 3; ++n)
+    {
+        d_step[n] = Space_Vector(0.0, 0.0, 0.0);
+        d_step[n][n] = (box.upper()[n] - box.lower()[n]) / d_N[n];
+    }
+
+    sample();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the cell volumes and relative errors written with the plot.
+ *
+ * The volumes are typically estimated by Volume_Estimator.
+ */
+template<class Geometry>
+void Geometry_Plotter<Geometry>::set_volumes(const Vec_Dbl &volumes,
+                                             const Vec_Dbl &errors)
+{
+    REQUIRE(volumes.size() == d_geometry->num_cells());
+    REQUIRE(errors.size() == volumes.size());
+
+    d_volumes    = volumes;
+    d_volume_err = errors;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the sampled cell and material ids to HDF5.
+ *
+ * The datasets \c cells and \c matids are written on the global grid along
+ * with the grid description (\c origin, \c steps, \c dims).  The estimated
+ * volumes and their relative errors are added if they have been set.
+ */
+template<class Geometry>
+void Geometry_Plotter<Geometry>::write(const std::string &filename) const
+{
+    REQUIRE(d_cells.size() == d_local[0] * d_local[1] * d_local[2]);
+
+#ifdef USE_HDF5
+    int node = profugus::node();
+
+    // grid description
+    Vec_Int dims(d_N.begin(), d_N.end());
+    Vec_Dbl origin(d_origin.begin(), d_origin.end());
+    Vec_Dbl steps;
+    for (int n = 0; n < 3; ++n)
+    {
+        steps.insert(steps.end(), d_step[n].begin(), d_step[n].end());
+    }
+
+#ifdef H5_HAVE_PARALLEL
+    // write the fields collectively
+    {
+        Parallel_HDF5_Writer writer;
+        writer.open(filename);
+
+        HDF5_IO::Decomp d(3, HDF5_IO::COLUMN_MAJOR);
+        for (int n = 0; n < 3; ++n)
+        {
+            d.global[n] = d_N[n];
+            d.local[n]  = d_local[n];
+            d.offset[n] = d_offset[n];
+        }
+
+        writer.write("cells", d, d_cells.data());
+        writer.write("matids", d, d_matids.data());
+        writer.close();
+    }
+
+    // add the grid description from the master domain
+    if (node == 0)
+    {
+        Serial_HDF5_Writer writer;
+        writer.open(filename, HDF5_IO::APPEND);
+        writer.write("dims", dims);
+        writer.write("origin", origin);
+        writer.write("steps", steps);
+        if (!d_volumes.empty())
+        {
+            writer.write("volumes", d_volumes);
+            writer.write("volume_errors", d_volume_err);
+        }
+        writer.close();
+    }
+#else
+    // the local blocks are contiguous in the global (column-major) ordering,
+    // so reduce the fields onto the master domain and write them serially
+    int Np     = d_N[0] * d_N[1] * d_N[2];
+    int offset = d_offset[0] + d_N[0] * (d_offset[1] + d_N[1] * d_offset[2]);
+
+    Vec_Int cells(Np, 0), matids(Np, 0);
+    std::copy(d_cells.begin(), d_cells.end(), cells.begin() + offset);
+    std::copy(d_matids.begin(), d_matids.end(), matids.begin() + offset);
+    profugus::sum(cells.data(), Np, 0);
+    profugus::sum(matids.data(), Np, 0);
+
+    if (node == 0)
+    {
+        Serial_HDF5_Writer writer;
+        writer.open(filename);
+        writer.write("dims", dims);
+        writer.write("origin", origin);
+        writer.write("steps", steps);
+        writer.write("cells", cells);
+        writer.write("matids", matids);
+        if (!d_volumes.empty())
+        {
+            writer.write("volumes", d_volumes);
+            writer.write("volume_errors", d_volume_err);
+        }
+        writer.close();
+    }
+#endif // H5_HAVE_PARALLEL
+#endif // USE_HDF5
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Decompose the grid over domains and sample it.
+ *
+ * The grid is split into contiguous blocks along its slowest-varying
+ * (non-unit) dimension.
+ */
+template<class Geometry>
+void Geometry_Plotter<Geometry>::sample()
+{
+    using def::X; using def::Y; using def::Z;
+
+    REQUIRE(d_N[0] > 0 && d_N[1] > 0 && d_N[2] > 0);
+
+    int node  = profugus::node();
+    int nodes = profugus::nodes();
+
+    // decompose along the slowest-varying dimension
+    int dim = d_N[2] > 1 ? 2 : 1;
+
+    d_local  = d_N;
+    d_offset = Dim_Vector(0, 0, 0);
+
+    int base       = d_N[dim] / nodes;
+    int rem        = d_N[dim] % nodes;
+    d_local[dim]  = base + (node < rem ? 1 : 0);
+    d_offset[dim] = node * base + std::min(node, rem);
+
+    // number of points on this domain
+    int Np = d_local[0] * d_local[1] * d_local[2];
+    d_cells.resize(Np);
+    d_matids.resize(Np);
+
+#pragma omp parallel
+    {
+        // dummy direction used to initialize the geometry state
+        Space_Vector omega(1.0, 0.0, 0.0);
+        Space_Vector r;
+        Geo_State_t  state;
+
+        // logical indices of the point
+        int l[3] = {0, 0, 0};
+
+#pragma omp for schedule(static)
+        for (int n = 0; n < Np; ++n)
+        {
+            l[0] = n % d_local[0] + d_offset[0];
+            l[1] = (n / d_local[0]) % d_local[1] + d_offset[1];
+            l[2] = n / (d_local[0] * d_local[1]) + d_offset[2];
+
+            // center of the pixel/voxel
+            r = d_origin;
+            for (int m = 0; m < 3; ++m)
+            {
+                r[X] += (l[m] + 0.5) * d_step[m][X];
+                r[Y] += (l[m] + 0.5) * d_step[m][Y];
+                r[Z] += (l[m] + 0.5) * d_step[m][Z];
+            }
+
+            // points outside of the geometry are flagged with -1
+            if (!d_box.is_point_inside(r))
+            {
+                d_cells[n]  = -1;
+                d_matids[n] = -1;
+                continue;
+            }
+
+            // locate the point
+            d_geometry->initialize(r, omega, state);
+            if (d_geometry->boundary_state(state) == geometry::OUTSIDE)
+            {
+                d_cells[n]  = -1;
+                d_matids[n] = -1;
+            }
+            else
+            {
+                d_cells[n]  = d_geometry->cell(state);
+                d_matids[n] = d_geometry->matid(state);
+            }
+        }
+    }
+
+    ENSURE(d_cells.size() == Np);
+    ENSURE(d_matids.size() == Np);
+}
+
+} // end namespace profugus
+
+#endif // MC_geometry_Geometry_Plotter_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Geometry_Plotter.t.hh
+//---------------------------------------------------------------------------//
@@ -100,6 +100,9 @@ class RTK_Array
     // Constructor.
     RTK_Array(int Nx, int Ny, int Nz, int num_objects);
 
+    // Construct a completed array from a packed stream and its objects.
+    RTK_Array(Unpacker &u, const Object_Array &objects);
+
     // >>> SETUP FUNCTIONALITY
 
     //@{
@@ -123,6 +126,9 @@ class RTK_Array
     // Build and get volumes of cells.
     Vec_Dbl get_volumes() const;
 
+    // Pack the array (but not its objects) into a stream.
+    void pack(Packer &p) const;
+
     // >>> TRACKING FUNCTIONALITY
 
     // Initialize a state.
@@ -155,6 +161,13 @@ class RTK_Array
     //! Number of objects.
     int num_objects() const { return d_objects.size(); }
 
+    //! Query if an object has been assigned to an id.
+    bool has_object(int index) const
+    {
+        REQUIRE(index >= 0 && index < d_objects.size());
+        return static_cast<bool>(d_objects[index]);
+    }
+
     // Return the current material id.
     inline int matid(const Geo_State_t &state) const;
 
@@ -54,6 +54,38 @@ RTK_Array<T>::RTK_Array(int Nx,
     ENSURE(size() > 0);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct a completed array from a stream written by pack().
+ *
+ * The objects must already be constructed (and completed); they are stored
+ * in the order of their ids in the array layout.
+ */
+template<class T>
+RTK_Array<T>::RTK_Array(Unpacker           &u,
+                        const Object_Array &objects)
+    : d_objects(objects)
+    , d_completed(true)
+{
+    u >> d_N;
+    unpack_vector(u, d_layout);
+    unpack_vector(u, d_x);
+    unpack_vector(u, d_y);
+    unpack_vector(u, d_z);
+    u >> d_corner >> d_length;
+    unpack_vector(u, d_reflect);
+    unpack_vector(u, d_num_cells);
+    unpack_vector(u, d_Nc_offset);
+    u >> d_total_cells >> d_r >> d_origin >> d_vessel >> d_vessel_id;
+
+    // calculate the level for quick access
+    d_level = calc_level();
+
+    ENSURE(d_level < Geo_State_t::max_levels);
+    ENSURE(d_layout.size() == size());
+    ENSURE(d_Nc_offset.back() == d_total_cells);
+}
+
 //---------------------------------------------------------------------------//
 // PUBLIC FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -390,6 +422,31 @@ void RTK_Array<T>::distance_to_boundary(const Space_Vector &r,
     object(state)->distance_to_boundary(tr, omega, state);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pack the array into a stream.
+ *
+ * Only the array data is packed; the objects are packed separately by the
+ * client so that objects shared between arrays are stored once.  The packer
+ * may be in compute_buffer_size_mode().
+ */
+template<class T>
+void RTK_Array<T>::pack(Packer &p) const
+{
+    REQUIRE(d_completed);
+
+    p << d_N;
+    pack_vector(p, d_layout);
+    pack_vector(p, d_x);
+    pack_vector(p, d_y);
+    pack_vector(p, d_z);
+    p << d_corner << d_length;
+    pack_vector(p, d_reflect);
+    pack_vector(p, d_num_cells);
+    pack_vector(p, d_Nc_offset);
+    p << d_total_cells << d_r << d_origin << d_vessel << d_vessel_id;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Build volumes.
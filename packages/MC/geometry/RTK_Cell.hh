@@ -17,6 +17,7 @@
 #include "harness/DBC.hh"
 #include "utils/Definitions.hh"
 #include "utils/Vector_Lite.hh"
+#include "utils/Packing_Utils.hh"
 #include "RTK_State.hh"
 #include "Definitions.hh"
 
@@ -125,6 +126,12 @@ class RTK_Cell
     RTK_Cell(int mod_id, double dx, double dy, double height, double R0,
              double R1, double x_offset, double y_offset, int vessel_id);
 
+    // Construct from a packed stream.
+    explicit RTK_Cell(Unpacker &u);
+
+    // Pack the pin-cell into a stream.
+    void pack(Packer &p) const;
+
     // Pin-cells are completed on construction.
     bool completed() const { return true; }
 
@@ -138,7 +145,7 @@ class RTK_Cell
     // Track to next boundary.
     void distance_to_boundary(const Space_Vector &r,
                               const Space_Vector &omega,
-                              Geo_State_t &state);
+                              Geo_State_t &state) const;
 
     // Update a state at collision sites.
     void update_state(Geo_State_t &state) const;
@@ -210,25 +217,26 @@ class RTK_Cell
 
     // Intersections with shells.
     void calc_shell_db(const Space_Vector &r, const Space_Vector &omega,
-                       Geo_State_t &state);
+                       Geo_State_t &state) const;
 
     // Distance to external surface.
     inline void dist_to_radial_face(int axis, double p, double dir,
-                                    Geo_State_t &state);
-    inline void dist_to_axial_face(double p, double dir, Geo_State_t &state);
+                                    Geo_State_t &state) const;
+    inline void dist_to_axial_face(double p, double dir,
+                                   Geo_State_t &state) const;
 
     // Distance to vessel.
     void dist_to_vessel(const Space_Vector &r, const Space_Vector &omega,
-                        Geo_State_t &state);
+                        Geo_State_t &state) const;
 
     // Distance to a shell.
-    void dist_to_shell(double x, double y, double omega_x, double omega_y,
-                       double r, int face);
+    double dist_to_shell(double x, double y, double omega_x, double omega_y,
+                         double r, int face) const;
 
-    // Update state if it hits a shell.
-    void check_shell(const Space_Vector &r, const Space_Vector &omega,
-                     int shell, int face, int next_region, int next_face,
-                     Geo_State_t &state);
+    // Update state if it hits a shell; returns the distance to the shell.
+    double check_shell(const Space_Vector &r, const Space_Vector &omega,
+                       int shell, int face, int next_region, int next_face,
+                       Geo_State_t &state) const;
 
     // Transform to vessel coordinates.
     double l2g(double local, int dir) const
@@ -259,11 +267,6 @@ class RTK_Cell
     // Number of cells.
     int d_num_cells;
 
-    // Work variables.
-    double d_db;
-    int    d_face;
-    int    d_segment;
-
     // Vessel parameters.
     bool d_vessel;         // indicates this cell has a vessel
     double d_offsets[2];   // radial offsets from origin of outer rtk-array to
@@ -97,6 +97,7 @@ class RTK_Geometry : public Tracking_Geometry<RTK_State>
   public:
     // Constructor.
     explicit RTK_Geometry(SP_Array array);
+    RTK_Geometry(SP_Array array, const Vec_Dbl &volumes);
 
     // >>> DERIVED INTERFACE from Geometry_Base
 
@@ -241,6 +242,13 @@ class RTK_Geometry : public Tracking_Geometry<RTK_State>
         return d_volumes;
     }
 
+    //! Replace the (analytic) cell volumes, eg. with stochastic estimates.
+    void set_cell_volumes(const Vec_Dbl &volumes)
+    {
+        REQUIRE(volumes.size() == num_cells());
+        d_volumes = volumes;
+    }
+
     //! Return the underlying array representation of objects.
     const Array_t& array() const { REQUIRE(d_array); return *d_array; }
 
@@ -37,6 +37,28 @@ RTK_Geometry<Array>::RTK_Geometry(SP_Array array)
     ENSURE(d_lower <= d_upper);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor with precomputed cell volumes.
+ *
+ * This avoids rebuilding the volumes, eg. when the geometry is read from a
+ * compiled geometry file.
+ */
+template<class Array>
+RTK_Geometry<Array>::RTK_Geometry(SP_Array       array,
+                                  const Vec_Dbl &volumes)
+    : d_array(array)
+    , d_volumes(volumes)
+    , d_level(d_array->level())
+{
+    REQUIRE(d_volumes.size() == num_cells());
+
+    d_array->get_extents(d_lower, d_upper);
+
+    ENSURE(d_array);
+    ENSURE(d_lower <= d_upper);
+}
+
 //---------------------------------------------------------------------------//
 // PUBLIC INTERFACE
 //---------------------------------------------------------------------------//
@@ -0,0 +1,301 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/RTK_Geometry_File.cc
+ * \author agent
+ * \date   Mon Oct 19 02:47:22 2026
+ * \brief  RTK_Geometry_File member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "utils/Packing_Utils.hh"
+#include "RTK_Geometry_File.hh"
+
+namespace profugus
+{
+
+namespace
+{
+
+// Magic number identifying compiled RTK geometry files ("PRTK").
+const int rtk_magic = 0x4B545250;
+
+}
+
+//---------------------------------------------------------------------------//
+// STATIC MEMBERS
+//---------------------------------------------------------------------------//
+
+const int RTK_Geometry_File::d_version = 2;
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write a core geometry to a compiled geometry file.
+ *
+ * This is called on every domain.  The file is written by the master domain
+ * to a temporary file that is renamed when complete; all domains wait at a
+ * barrier until the file is in place.
+ */
+void RTK_Geometry_File::write(const Geometry_t  &geometry,
+                              const std::string &filename,
+                              Signature          signature) const
+{
+    if (profugus::node() == 0)
+    {
+        // compute the size of the file
+        Packer p;
+        p.compute_buffer_size_mode();
+        pack(geometry, signature, p);
+
+        // pack the geometry
+        std::vector<char> buffer(p.size());
+        p.set_buffer(buffer.size(), buffer.data());
+        pack(geometry, signature, p);
+        CHECK(p.get_ptr() == p.end());
+
+        std::string tmp = filename + ".tmp";
+        {
+            std::ofstream out(tmp.c_str(), std::ios::out | std::ios::binary);
+            INSIST(out, "Unable to open compiled geometry file " << tmp);
+            out.write(buffer.data(), buffer.size());
+            INSIST(out, "Unable to write compiled geometry file " << tmp);
+        }
+        INSIST(std::rename(tmp.c_str(), filename.c_str()) == 0,
+               "Unable to rename " << tmp << " to " << filename);
+    }
+
+    profugus::global_barrier();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Read a core geometry from a compiled geometry file.
+ *
+ * This is called on every domain; the file is mapped read-only into memory
+ * and the geometry is unpacked directly from the mapping.
+ */
+auto RTK_Geometry_File::read(const std::string &filename) const -> SP_Geometry
+{
+    // map the file
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    INSIST(fd >= 0, "Unable to open compiled geometry file " << filename);
+
+    struct stat st;
+    INSIST(::fstat(fd, &st) == 0, "Unable to stat " << filename);
+
+    void *map = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    INSIST(map != MAP_FAILED, "Unable to map " << filename);
+
+    Unpacker u;
+    u.set_buffer(st.st_size, static_cast<const char *>(map));
+
+    // header
+    int magic = 0, version = 0, num_pins = 0, num_lattices = 0;
+    Signature signature = 0;
+    u >> magic >> version;
+    VALIDATE(magic == rtk_magic, filename << " is not a compiled RTK "
+             << "geometry file");
+    VALIDATE(version == d_version, "Compiled geometry file " << filename
+             << " has version " << version << "; expected " << d_version);
+    u >> signature >> num_pins >> num_lattices;
+
+    // pin-cells
+    std::vector<SP_Pin_Cell> pins(num_pins);
+    for (auto &pin : pins)
+    {
+        pin = std::make_shared<Pin_Cell_t>(u);
+    }
+
+    // lattices
+    int num_objects = 0, id = 0;
+    std::vector<SP_Lattice> lattices(num_lattices);
+    for (auto &lattice : lattices)
+    {
+        u >> num_objects;
+        Lattice_t::Object_Array objects(num_objects);
+        for (auto &object : objects)
+        {
+            u >> id;
+            CHECK(id < num_pins);
+            if (id >= 0)
+                object = pins[id];
+        }
+        lattice = std::make_shared<Lattice_t>(u, objects);
+    }
+
+    // core
+    u >> num_objects;
+    Core_t::Object_Array objects(num_objects);
+    for (auto &object : objects)
+    {
+        u >> id;
+        CHECK(id < num_lattices);
+        if (id >= 0)
+            object = lattices[id];
+    }
+    auto core = std::make_shared<Core_t>(u, objects);
+
+    // volumes
+    def::Vec_Dbl volumes;
+    unpack_vector(u, volumes);
+    CHECK(u.get_ptr() == u.end());
+
+    ::munmap(map, st.st_size);
+
+    return std::make_shared<Geometry_t>(core, volumes);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Input signature stored in a compiled geometry file.
+ *
+ * Only the header is read.  The first entry of the result is false if the
+ * file does not exist or is not a compiled geometry file of the current
+ * version.  This is a local operation.
+ */
+auto RTK_Geometry_File::signature(const std::string &filename) const
+    -> std::pair<bool, Signature>
+{
+    std::pair<bool, Signature> result(false, 0);
+
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!in)
+        return result;
+
+    int magic = 0, version = 0;
+    Signature signature = 0;
+    char buffer[2 * sizeof(int) + sizeof(Signature)];
+    if (!in.read(buffer, sizeof(buffer)))
+        return result;
+
+    Unpacker u;
+    u.set_buffer(sizeof(buffer), buffer);
+    u >> magic >> version >> signature;
+
+    if (magic == rtk_magic && version == d_version)
+    {
+        result.first  = true;
+        result.second = signature;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Signature (64-bit FNV-1a hash) of an input string.
+ */
+auto RTK_Geometry_File::hash(const std::string &input) -> Signature
+{
+    Signature h = 14695981039346656037ull;
+    for (unsigned char c : input)
+    {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pack the geometry.
+ */
+void RTK_Geometry_File::pack(const Geometry_t &geometry,
+                             Signature         signature,
+                             Packer           &p) const
+{
+    const Core_t &core = geometry.array();
+
+    // index the unique lattices and pins (objects shared between arrays are
+    // identified by address)
+    std::unordered_map<const Lattice_t *, int>  lattice_index;
+    std::unordered_map<const Pin_Cell_t *, int> pin_index;
+    std::vector<const Lattice_t *>              lattices;
+    std::vector<const Pin_Cell_t *>             pins;
+
+    for (int n = 0; n < core.num_objects(); ++n)
+    {
+        if (!core.has_object(n))
+            continue;
+
+        const Lattice_t *lattice = &core.object(n);
+        if (lattice_index.count(lattice))
+            continue;
+
+        lattice_index[lattice] = lattices.size();
+        lattices.push_back(lattice);
+
+        for (int m = 0; m < lattice->num_objects(); ++m)
+        {
+            if (!lattice->has_object(m))
+                continue;
+
+            const Pin_Cell_t *pin = &lattice->object(m);
+            if (!pin_index.count(pin))
+            {
+                pin_index[pin] = pins.size();
+                pins.push_back(pin);
+            }
+        }
+    }
+
+    // header
+    int num_pins     = pins.size();
+    int num_lattices = lattices.size();
+    p << rtk_magic << d_version << signature << num_pins << num_lattices;
+
+    // pin-cells
+    for (auto pin : pins)
+    {
+        pin->pack(p);
+    }
+
+    // lattices (unassigned objects have index -1)
+    int num_objects = 0, id = 0;
+    for (auto lattice : lattices)
+    {
+        num_objects = lattice->num_objects();
+        p << num_objects;
+        for (int m = 0; m < num_objects; ++m)
+        {
+            id = lattice->has_object(m) ? pin_index[&lattice->object(m)] : -1;
+            p << id;
+        }
+        lattice->pack(p);
+    }
+
+    // core
+    num_objects = core.num_objects();
+    p << num_objects;
+    for (int n = 0; n < num_objects; ++n)
+    {
+        id = core.has_object(n) ? lattice_index[&core.object(n)] : -1;
+        p << id;
+    }
+    core.pack(p);
+
+    // volumes
+    pack_vector(p, geometry.cell_volumes());
+}
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of RTK_Geometry_File.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,111 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/RTK_Geometry_File.hh
+ * \author agent
+ * \date   Mon Oct 19 02:47:22 2026
+ * \brief  RTK_Geometry_File class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_geometry_RTK_Geometry_File_hh
+#define MC_geometry_RTK_Geometry_File_hh
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "RTK_Geometry.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class RTK_Geometry_File
+ * \brief Read and write compiled (binary) RTK core geometries.
+ *
+ * Building a core from XML parses every pin and assembly sublist and
+ * completes (counts cells and builds volumes for) every array on every
+ * domain.  A compiled geometry file stores the completed core in flattened
+ * binary form so that it can be reconstructed directly:
+ * - a header (magic string, version, input signature, and object counts);
+ * - every unique pin-cell;
+ * - every unique assembly lattice, given by the indices of its pin-cells
+ *   followed by the lattice data;
+ * - the core, given by the indices of its lattices followed by the core
+ *   data;
+ * - the cell volumes.
+ * .
+ * Objects that are shared in the core (eg. pins that are used in several
+ * assemblies) are written once and remain shared when the file is read.
+ *
+ * The file is written by the master domain and read on every domain by
+ * mapping it read-only into memory (mmap), so it is never broadcast.  The
+ * mapping only replaces file I/O: the geometry is unpacked into ordinary
+ * memory and the file is unmapped, so every domain holds its own copy.  The
+ * file is first written to a temporary name and renamed, and write() ends
+ * with a barrier, so no domain can map a partially written file.  The file
+ * is in native byte order and is not portable between architectures; the
+ * XML input remains the authoring format.
+ *
+ * The header stores a signature of the input the geometry was built from
+ * (eg. hash() of the XML input).  Clients compare it with signature() to
+ * detect a compiled file that is stale with respect to its input.
+ */
+/*!
+ * \example geometry/test/tstRTK_Geometry_File.cc
+ *
+ * Test of RTK_Geometry_File.
+ */
+//===========================================================================//
+
+class RTK_Geometry_File
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef Core                         Geometry_t;
+    typedef std::shared_ptr<Geometry_t>  SP_Geometry;
+    typedef Geometry_t::Array_t          Core_t;
+    typedef Geometry_t::SP_Array         SP_Core;
+    typedef Core_t::Object_t             Lattice_t;
+    typedef Core_t::SP_Object            SP_Lattice;
+    typedef Lattice_t::Object_t          Pin_Cell_t;
+    typedef Lattice_t::SP_Object         SP_Pin_Cell;
+    typedef std::uint64_t                Signature;
+    //@}
+
+  public:
+    // Write a core geometry to a compiled geometry file.
+    void write(const Geometry_t &geometry, const std::string &filename,
+               Signature signature = 0) const;
+
+    // Read a core geometry from a compiled geometry file.
+    SP_Geometry read(const std::string &filename) const;
+
+    // Input signature stored in a compiled geometry file.
+    std::pair<bool, Signature> signature(const std::string &filename) const;
+
+    // Signature (64-bit FNV-1a hash) of an input string.
+    static Signature hash(const std::string &input);
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Pack the geometry (or compute its packed size).
+    void pack(const Geometry_t &geometry, Signature signature,
+              Packer &p) const;
+
+    // File version.
+    static const int d_version;
+};
+
+} // end namespace profugus
+
+#endif // MC_geometry_RTK_Geometry_File_hh
+
+//---------------------------------------------------------------------------//
+//                 end of RTK_Geometry_File.hh
+//---------------------------------------------------------------------------//
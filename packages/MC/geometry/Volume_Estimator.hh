@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/Volume_Estimator.hh
+ * \author agent
+ * \date   Mon Oct 19 02:44:04 2026
+ * \brief  Volume_Estimator class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_geometry_Volume_Estimator_hh
+#define MC_geometry_Volume_Estimator_hh
+
+#include <memory>
+#include <string>
+
+#include "utils/Definitions.hh"
+#include "Definitions.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Volume_Estimator
+ * \brief Estimate cell volumes by stochastic ray casting.
+ *
+ * Analytic cell volumes are not available (or are wrong) for some
+ * geometries, eg. RTK pin-cells that are bisected by a vessel.  This class
+ * estimates the volume of every cell with a track-length estimator.  Rays
+ * are started at uniformly sampled points on the low face of the geometry
+ * bounding box and tracked in the +x or +y direction (alternating) until they
+ * leave the box.  The volume of cell \e c from a single ray along axis \e a
+ * is
+ * \f[
+   V_c = A_a\,l_c\:,
+ * \f]
+ * where \f$A_a\f$ is the area of the box face normal to \e a and \f$l_c\f$ is
+ * the track length of the ray in cell \e c.  The mean over all rays is an
+ * unbiased estimate of the volume, and its relative error is computed from
+ * the variance of the single-ray estimates.  Rays are not cast along z
+ * because they would be parallel to the pin-cell shells; the axial positions
+ * of the rays are sampled uniformly so all cells are still covered.
+ *
+ * The rays are divided over domains and threads (each with an independent
+ * random number stream), and the tallies are reduced over both.
+ *
+ * When a cache file is given, the volumes are read from it if it was
+ * written for the same geometry (identified by a hash of the geometry
+ * output) with at least as many rays; otherwise the volumes are calculated
+ * and the cache file is (re)written.  Caching requires HDF5.
+ */
+/*!
+ * \example geometry/test/tstVolume_Estimator.cc
+ *
+ * Test of Volume_Estimator.
+ */
+//===========================================================================//
+
+template<class Geometry>
+class Volume_Estimator
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef Geometry                         Geometry_t;
+    typedef std::shared_ptr<Geometry_t>      SP_Geometry;
+    typedef typename Geometry_t::Geo_State_t Geo_State_t;
+    typedef def::Space_Vector                Space_Vector;
+    typedef def::Vec_Int                     Vec_Int;
+    typedef def::Vec_Dbl                     Vec_Dbl;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // Geometry.
+    SP_Geometry d_geometry;
+
+    // Estimated volumes and relative errors.
+    Vec_Dbl d_volumes, d_errors;
+
+  public:
+    // Constructor.
+    explicit Volume_Estimator(SP_Geometry geometry);
+
+    // Estimate the cell volumes.
+    void calc_volumes(int num_rays, const std::string &cache = std::string(),
+                      int seed = 5417);
+
+    // Hash of the geometry used to key the cache.
+    std::string hash() const;
+
+    // >>> ACCESSORS
+
+    //! Estimated cell volumes.
+    const Vec_Dbl& volumes() const { return d_volumes; }
+
+    //! Relative errors of the estimated cell volumes.
+    const Vec_Dbl& errors() const { return d_errors; }
+
+    //! True if the last estimate was read from the cache.
+    bool from_cache() const { return d_from_cache; }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Cache indicator.
+    bool d_from_cache;
+
+    // Cast rays through the geometry.
+    void sweep(int num_rays, int seed);
+
+    // Read/write the cache file.
+    bool read_cache(const std::string &filename, int num_rays);
+    void write_cache(const std::string &filename, int num_rays) const;
+};
+
+} // end namespace profugus
+
+#endif // MC_geometry_Volume_Estimator_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Volume_Estimator.hh
+//---------------------------------------------------------------------------//
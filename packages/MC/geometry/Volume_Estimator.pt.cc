@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/Volume_Estimator.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 02:44:04 2026
+ * \brief  Volume_Estimator explicit instantiations.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Volume_Estimator.t.hh"
+#include "RTK_Geometry.hh"
+#include "Mesh_Geometry.hh"
+
+namespace profugus
+{
+
+template class Volume_Estimator<Core>;
+template class Volume_Estimator<Mesh_Geometry>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Volume_Estimator.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,324 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/Volume_Estimator.t.hh
+ * \author agent
+ * \date   Mon Oct 19 02:44:04 2026
+ * \brief  Volume_Estimator template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_geometry_Volume_Estimator_t_hh
+#define MC_geometry_Volume_Estimator_t_hh
+
+#include <cmath>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <vector>
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "rng/RNG_Control.hh"
+#include "utils/Serial_HDF5_Writer.hh"
+#include "utils/HDF5_Reader.hh"
+#include "Volume_Estimator.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+template<class Geometry>
+Volume_Estimator<Geometry>::Volume_Estimator(SP_Geometry geometry)
+    : d_geometry(geometry)
+    , d_from_cache(false)
+{
+    REQUIRE(d_geometry);
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Estimate the cell volumes.
+ *
+ * \param num_rays total number of rays cast over all domains
+ * \param cache cache file; if empty the volumes are always calculated
+ * \param seed random number seed
+ */
+template<class Geometry>
+void Volume_Estimator<Geometry>::calc_volumes(int                num_rays,
+                                              const std::string &cache,
+                                              int                seed)
+{
+    REQUIRE(num_rays > 0);
+
+    d_from_cache = false;
+
+    // try the cache first
+    if (!cache.empty())
+    {
+        d_from_cache = read_cache(cache, num_rays);
+    }
+
+    if (!d_from_cache)
+    {
+        sweep(num_rays, seed);
+
+        if (!cache.empty())
+        {
+            write_cache(cache, num_rays);
+        }
+    }
+
+    ENSURE(d_volumes.size() == d_geometry->num_cells());
+    ENSURE(d_errors.size() == d_geometry->num_cells());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Hash of the geometry.
+ *
+ * The hash is computed from the geometry diagnostic output, the number of
+ * cells, and the extents, and is returned as a hexadecimal string.
+ */
+template<class Geometry>
+std::string Volume_Estimator<Geometry>::hash() const
+{
+    std::ostringstream geo;
+    d_geometry->output(geo);
+
+    auto box = d_geometry->get_extents();
+    geo.precision(17);
+    geo << d_geometry->num_cells() << " "
+        << box.lower() << " " << box.upper();
+
+    std::ostringstream h;
+    h << std::hex << std::hash<std::string>()(geo.str());
+    return h.str();
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Cast rays through the geometry and tally track lengths.
+ */
+template<class Geometry>
+void Volume_Estimator<Geometry>::sweep(int num_rays,
+                                       int seed)
+{
+    using def::X; using def::Y; using def::Z;
+
+    // number of cells in the geometry
+    int Nc = d_geometry->num_cells();
+
+    // rays on this domain
+    int node  = profugus::node();
+    int nodes = profugus::nodes();
+    int Nr    = num_rays / nodes + (node < num_rays % nodes ? 1 : 0);
+
+    // extents of the geometry
+    auto box = d_geometry->get_extents();
+    Space_Vector lower = box.lower();
+    Space_Vector width = box.upper();
+    for (int d = 0; d < 3; ++d)
+    {
+        width[d] -= lower[d];
+    }
+
+    // area of the face that rays along x and y are started on
+    double area[2] = {width[Y] * width[Z], width[X] * width[Z]};
+
+    // make independent random number streams for each thread on each domain
+    int num_threads = profugus::num_available_threads();
+    RNG_Control control(seed);
+    std::vector<RNG_Control::RNG_t> rngs;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        rngs.push_back(control.rng(node * num_threads + t));
+    }
+
+    // sum and sum-of-squares of the single-ray estimates on each thread
+    std::vector<Vec_Dbl> sum(num_threads, Vec_Dbl(Nc, 0.0));
+    std::vector<Vec_Dbl> sum2(num_threads, Vec_Dbl(Nc, 0.0));
+
+#pragma omp parallel
+    {
+        const RNG_Control::RNG_t &rng = rngs[profugus::thread_id()];
+        Vec_Dbl                  &s   = sum[profugus::thread_id()];
+        Vec_Dbl                  &s2  = sum2[profugus::thread_id()];
+
+        // track length in each cell along the current ray and the cells
+        // that it crossed
+        Vec_Dbl ray(Nc, 0.0);
+        Vec_Int crossed;
+
+        Space_Vector r, omega;
+        Geo_State_t  state;
+
+        int    a = 0, b = 0, cell = 0;
+        double d = 0.0, v = 0.0;
+
+#pragma omp for schedule(static)
+        for (int n = 0; n < Nr; ++n)
+        {
+            // alternate the ray direction between x and y
+            a = n % 2;
+            b = 1 - a;
+
+            r[a] = lower[a];
+            r[b] = lower[b] + rng.ran() * width[b];
+            r[Z] = lower[Z] + rng.ran() * width[Z];
+
+            omega    = Space_Vector(0.0, 0.0, 0.0);
+            omega[a] = 1.0;
+
+            // track the ray through the geometry
+            d_geometry->initialize(r, omega, state);
+            while (d_geometry->boundary_state(state) == geometry::INSIDE)
+            {
+                cell = d_geometry->cell(state);
+                d    = d_geometry->distance_to_boundary(state);
+                CHECK(cell < Nc);
+
+                if (ray[cell] == 0.0 && d > 0.0)
+                {
+                    crossed.push_back(cell);
+                }
+                ray[cell] += d;
+
+                d_geometry->move_to_surface(state);
+            }
+
+            // tally the single-ray estimates
+            for (auto c : crossed)
+            {
+                v       = area[a] * ray[c];
+                s[c]   += v;
+                s2[c]  += v * v;
+                ray[c]  = 0.0;
+            }
+            crossed.clear();
+        }
+    }
+
+    // reduce over threads and domains
+    d_volumes.assign(Nc, 0.0);
+    d_errors.assign(Nc, 0.0);
+    for (int t = 0; t < num_threads; ++t)
+    {
+        for (int c = 0; c < Nc; ++c)
+        {
+            d_volumes[c] += sum[t][c];
+            d_errors[c]  += sum2[t][c];
+        }
+    }
+    profugus::global_sum(d_volumes.data(), Nc);
+    profugus::global_sum(d_errors.data(), Nc);
+
+    // calculate the mean volumes and their relative errors
+    double N = num_rays, var = 0.0;
+    for (int c = 0; c < Nc; ++c)
+    {
+        d_volumes[c] /= N;
+
+        if (d_volumes[c] > 0.0 && num_rays > 1)
+        {
+            var = (d_errors[c] / N - d_volumes[c] * d_volumes[c]) / (N - 1.0);
+            d_errors[c] = std::sqrt(std::max(var, 0.0)) / d_volumes[c];
+        }
+        else
+        {
+            d_errors[c] = 1.0;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Read the volumes from a cache file.
+ *
+ * \return true if the cache matches the geometry and has at least \e
+ * num_rays rays
+ */
+template<class Geometry>
+bool Volume_Estimator<Geometry>::read_cache(const std::string &filename,
+                                            int                num_rays)
+{
+#ifdef USE_HDF5
+    int Nc = d_geometry->num_cells();
+
+    // the master domain checks the cache
+    int valid = 0;
+    if (profugus::node() == 0 && std::ifstream(filename.c_str()).good())
+    {
+        HDF5_Reader reader;
+        reader.open(filename);
+
+        std::string key;
+        int         rays = 0;
+        reader.read("hash", key);
+        reader.read("num_rays", rays);
+
+        if (key == hash() && rays >= num_rays)
+        {
+            reader.read("volumes", d_volumes);
+            reader.read("errors", d_errors);
+            valid = d_volumes.size() == Nc && d_errors.size() == Nc;
+        }
+        reader.close();
+    }
+
+    profugus::broadcast(&valid, 1, 0);
+    if (!valid)
+    {
+        return false;
+    }
+
+    d_volumes.resize(Nc);
+    d_errors.resize(Nc);
+    profugus::broadcast(d_volumes.data(), Nc, 0);
+    profugus::broadcast(d_errors.data(), Nc, 0);
+    return true;
+#else
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the volumes to a cache file.
+ */
+template<class Geometry>
+void Volume_Estimator<Geometry>::write_cache(const std::string &filename,
+                                             int                num_rays) const
+{
+#ifdef USE_HDF5
+    // the hash requires the full geometry output so only do it once
+    if (profugus::node() == 0)
+    {
+        Serial_HDF5_Writer writer;
+        writer.open(filename);
+        writer.write("hash", hash());
+        writer.write("num_rays", num_rays);
+        writer.write("volumes", d_volumes);
+        writer.write("errors", d_errors);
+        writer.close();
+    }
+#endif
+}
+
+} // end namespace profugus
+
+#endif // MC_geometry_Volume_Estimator_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Volume_Estimator.t.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,164 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/test/tstGeometry_Plotter.cc
+ * \author agent
+ * \date   Mon Oct 19 02:40:26 2026
+ * \brief  Geometry_Plotter unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <memory>
+
+#include "gtest/utils_gtest.hh"
+
+#include "comm/global.hh"
+#include "../Geometry_Plotter.hh"
+#include "../Volume_Estimator.hh"
+#include "../Mesh_Geometry.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+class Geometry_PlotterTest : public ::testing::Test
+{
+  protected:
+    typedef profugus::Mesh_Geometry                 Geometry_t;
+    typedef std::shared_ptr<Geometry_t>             SP_Geometry;
+    typedef profugus::Geometry_Plotter<Geometry_t>  Plotter;
+    typedef Plotter::Space_Vector                   Space_Vector;
+    typedef def::Vec_Dbl                            Vec_Dbl;
+    typedef def::Vec_Int                            Vec_Int;
+
+  protected:
+    void SetUp()
+    {
+        node  = profugus::node();
+        nodes = profugus::nodes();
+
+        // 2x2x1 mesh with a different material in each cell
+        Vec_Dbl x = {0.0, 1.0, 2.0};
+        Vec_Dbl y = {0.0, 1.0, 2.0};
+        Vec_Dbl z = {0.0, 1.0};
+
+        geometry = std::make_shared<Geometry_t>(x, y, z);
+        geometry->set_matids(std::make_shared<Vec_Int>(Vec_Int{1, 2, 3, 4}));
+    }
+
+  protected:
+    SP_Geometry geometry;
+
+    int node, nodes;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_PlotterTest, slice)
+{
+    Plotter plotter(geometry);
+
+    // 4x4 slice of the z = 0.5 plane
+    plotter.slice(Space_Vector(0.0, 0.0, 0.5), Space_Vector(2.0, 0.0, 0.0),
+                  Space_Vector(0.0, 2.0, 0.0), 4, 4);
+
+    const auto &local  = plotter.local_dims();
+    const auto &offset = plotter.offsets();
+    EXPECT_EQ(4, plotter.global_dims()[0]);
+    EXPECT_EQ(4, plotter.global_dims()[1]);
+    EXPECT_EQ(1, plotter.global_dims()[2]);
+    EXPECT_EQ(4, local[0]);
+    EXPECT_EQ(1, local[2]);
+
+    // the slice is decomposed along y
+    int nj = local[1];
+    profugus::global_sum(nj);
+    EXPECT_EQ(4, nj);
+
+    const auto &cells  = plotter.cells();
+    const auto &matids = plotter.matids();
+    ASSERT_EQ(4 * local[1], cells.size());
+
+    for (int j = 0; j < local[1]; ++j)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            int n    = i + 4 * j;
+            int cell = i / 2 + 2 * ((j + offset[1]) / 2);
+            EXPECT_EQ(cell, cells[n]);
+            EXPECT_EQ(cell + 1, matids[n]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_PlotterTest, outside)
+{
+    Plotter plotter(geometry);
+
+    // slice that extends past the geometry in x
+    plotter.slice(Space_Vector(0.0, 0.0, 0.5), Space_Vector(4.0, 0.0, 0.0),
+                  Space_Vector(0.0, 2.0, 0.0), 4, 2);
+
+    const auto &cells = plotter.cells();
+    for (int j = 0; j < plotter.local_dims()[1]; ++j)
+    {
+        EXPECT_LE(0, cells[0 + 4 * j]);
+        EXPECT_LE(0, cells[1 + 4 * j]);
+        EXPECT_EQ(-1, cells[2 + 4 * j]);
+        EXPECT_EQ(-1, cells[3 + 4 * j]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_PlotterTest, voxelize)
+{
+    Plotter plotter(geometry);
+
+    plotter.voxelize(geometry->get_extents(), 2, 2, 4);
+
+    // voxels are decomposed along z
+    const auto &local = plotter.local_dims();
+    EXPECT_EQ(2, local[0]);
+    EXPECT_EQ(2, local[1]);
+
+    const auto &cells = plotter.cells();
+    ASSERT_EQ(4 * local[2], cells.size());
+    for (int k = 0; k < local[2]; ++k)
+    {
+        for (int n = 0; n < 4; ++n)
+        {
+            EXPECT_EQ(n, cells[n + 4 * k]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_PlotterTest, volumes)
+{
+    Plotter plotter(geometry);
+    EXPECT_TRUE(plotter.volumes().empty());
+
+    profugus::Volume_Estimator<Geometry_t> estimator(geometry);
+    estimator.calc_volumes(10000);
+    plotter.set_volumes(estimator.volumes(), estimator.errors());
+
+    const auto &volumes = plotter.volumes();
+    const auto &errors  = plotter.volume_errors();
+    ASSERT_EQ(4, volumes.size());
+    ASSERT_EQ(4, errors.size());
+    for (int c = 0; c < 4; ++c)
+    {
+        EXPECT_EQ(estimator.volumes()[c], volumes[c]);
+        EXPECT_EQ(estimator.errors()[c], errors[c]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstGeometry_Plotter.cc
+//---------------------------------------------------------------------------//
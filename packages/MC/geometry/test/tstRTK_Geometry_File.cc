@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/test/tstRTK_Geometry_File.cc
+ * \author agent
+ * \date   Mon Oct 19 02:47:22 2026
+ * \brief  RTK_Geometry_File unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+#include "gtest/utils_gtest.hh"
+
+#include "utils/Constants.hh"
+#include "rng/RNG_Control.hh"
+#include "../RTK_Geometry_File.hh"
+
+using profugus::geometry::INSIDE;
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+class RTK_Geometry_FileTest : public ::testing::Test
+{
+  protected:
+    typedef profugus::RTK_Geometry_File File;
+    typedef File::Geometry_t            Geometry_t;
+    typedef File::SP_Geometry           SP_Geometry;
+    typedef File::Core_t                Core_t;
+    typedef File::Lattice_t             Lattice_t;
+    typedef File::Pin_Cell_t            Pin_Cell_t;
+    typedef Geometry_t::Space_Vector    Space_Vector;
+    typedef Geometry_t::Geo_State_t     State;
+
+  protected:
+    void SetUp()
+    {
+        // 2 fuel pin types and a water box
+        auto pin1 = std::make_shared<Pin_Cell_t>(1, 0.54, 3, 1.26, 14.28);
+        auto pin2 = std::make_shared<Pin_Cell_t>(2, 0.54, 3, 1.26, 14.28);
+        auto box  = std::make_shared<Pin_Cell_t>(3, 2.52, 14.28);
+
+        // 3 lattices
+        auto lat1 = std::make_shared<Lattice_t>(2, 2, 1, 1);
+        auto lat2 = std::make_shared<Lattice_t>(2, 2, 1, 1);
+        auto lat3 = std::make_shared<Lattice_t>(1, 1, 1, 1);
+        lat1->assign_object(pin1, 0);
+        lat2->assign_object(pin2, 0);
+        lat3->assign_object(box, 0);
+        lat1->complete(0.0, 0.0, 0.0);
+        lat2->complete(0.0, 0.0, 0.0);
+        lat3->complete(0.0, 0.0, 0.0);
+
+        // 3x3x2 core with 4 objects (object 0 unassigned)
+        auto core = std::make_shared<Core_t>(3, 3, 2, 4);
+        core->assign_object(lat1, 1);
+        core->assign_object(lat2, 2);
+        core->assign_object(lat3, 3);
+
+        for (int k = 0; k < 2; ++k)
+            for (int j = 0; j < 3; ++j)
+                for (int i = 0; i < 3; ++i)
+                    core->id(i, j, k) = 3;
+        core->id(0, 0, 0) = 1;
+        core->id(1, 0, 0) = 2;
+        core->id(0, 1, 0) = 2;
+        core->id(1, 1, 0) = 1;
+
+        core->set_reflecting(def::Vec_Int{1, 0, 1, 0, 1, 0});
+        core->complete(0.0, 0.0, 0.0);
+
+        geometry = std::make_shared<Geometry_t>(core);
+    }
+
+  protected:
+    SP_Geometry geometry;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RTK_Geometry_FileTest, round_trip)
+{
+    File file;
+    file.write(*geometry, "core.rtk");
+    auto compiled = file.read("core.rtk");
+    ASSERT_TRUE(static_cast<bool>(compiled));
+
+    // cells and volumes
+    EXPECT_EQ(geometry->num_cells(), compiled->num_cells());
+    EXPECT_VEC_EQ(geometry->cell_volumes(), compiled->cell_volumes());
+
+    // extents
+    auto ref = geometry->get_extents();
+    auto box = compiled->get_extents();
+    for (int d = 0; d < 3; ++d)
+    {
+        EXPECT_EQ(ref.lower()[d], box.lower()[d]);
+        EXPECT_EQ(ref.upper()[d], box.upper()[d]);
+    }
+
+    // track random rays through both geometries
+    profugus::RNG_Control control(4305834);
+    auto rng = control.rng();
+
+    State        a, b;
+    Space_Vector r, omega;
+    double       costheta, phi;
+    for (int n = 0; n < 100; ++n)
+    {
+        r[def::X] = rng.ran() * 7.56;
+        r[def::Y] = rng.ran() * 7.56;
+        r[def::Z] = rng.ran() * 28.56;
+
+        costheta = 1.0 - 2.0 * rng.ran();
+        phi      = profugus::constants::two_pi * rng.ran();
+        omega[def::X] = std::sqrt(1.0 - costheta * costheta) * std::cos(phi);
+        omega[def::Y] = std::sqrt(1.0 - costheta * costheta) * std::sin(phi);
+        omega[def::Z] = costheta;
+
+        geometry->initialize(r, omega, a);
+        compiled->initialize(r, omega, b);
+
+        while (geometry->boundary_state(a) == INSIDE)
+        {
+            ASSERT_EQ(INSIDE, compiled->boundary_state(b));
+            EXPECT_EQ(geometry->cell(a), compiled->cell(b));
+            EXPECT_EQ(geometry->matid(a), compiled->matid(b));
+            EXPECT_EQ(geometry->distance_to_boundary(a),
+                      compiled->distance_to_boundary(b));
+
+            geometry->move_to_surface(a);
+            compiled->move_to_surface(b);
+        }
+        EXPECT_EQ(geometry->boundary_state(a), compiled->boundary_state(b));
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(RTK_Geometry_FileTest, output)
+{
+    File file;
+    file.write(*geometry, "core_output.rtk");
+    auto compiled = file.read("core_output.rtk");
+
+    std::ostringstream ref, out;
+    geometry->output(ref);
+    compiled->output(out);
+    EXPECT_EQ(ref.str(), out.str());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(RTK_Geometry_FileTest, signature)
+{
+    File file;
+
+    // no file
+    EXPECT_FALSE(file.signature("core_missing.rtk").first);
+
+    auto a = File::hash("<ParameterList name=\"a\"/>");
+    auto b = File::hash("<ParameterList name=\"b\"/>");
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a, File::hash("<ParameterList name=\"a\"/>"));
+
+    // every domain sees the complete file after write returns
+    file.write(*geometry, "core_signed.rtk", a);
+
+    auto stored = file.signature("core_signed.rtk");
+    EXPECT_TRUE(stored.first);
+    EXPECT_EQ(a, stored.second);
+    EXPECT_NE(b, stored.second);
+
+    auto compiled = file.read("core_signed.rtk");
+    EXPECT_EQ(geometry->num_cells(), compiled->num_cells());
+    EXPECT_VEC_EQ(geometry->cell_volumes(), compiled->cell_volumes());
+
+    // rewriting with a new signature replaces the file on every domain
+    file.write(*geometry, "core_signed.rtk", b);
+    stored = file.signature("core_signed.rtk");
+    EXPECT_TRUE(stored.first);
+    EXPECT_EQ(b, stored.second);
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstRTK_Geometry_File.cc
+//---------------------------------------------------------------------------//
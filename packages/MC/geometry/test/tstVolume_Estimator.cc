@@ -0,0 +1,122 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/geometry/test/tstVolume_Estimator.cc
+ * \author agent
+ * \date   Mon Oct 19 02:44:04 2026
+ * \brief  Volume_Estimator unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <memory>
+
+#include "gtest/utils_gtest.hh"
+
+#include "../Volume_Estimator.hh"
+#include "../RTK_Geometry.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+class Volume_EstimatorTest : public ::testing::Test
+{
+  protected:
+    typedef profugus::Lattice                          Geometry_t;
+    typedef std::shared_ptr<Geometry_t>                SP_Geometry;
+    typedef Geometry_t::Array_t                        Lattice_t;
+    typedef Lattice_t::Object_t                        Pin_Cell_t;
+    typedef profugus::Volume_Estimator<Geometry_t>     Estimator;
+
+  protected:
+    void SetUp()
+    {
+        // 2x2x1 lattice of 2 pin types and a box
+        auto pin1 = std::make_shared<Pin_Cell_t>(1, 0.54, 5, 1.26, 14.28);
+        auto pin2 = std::make_shared<Pin_Cell_t>(2, 0.45, 5, 1.26, 14.28);
+        auto box  = std::make_shared<Pin_Cell_t>(5, 1.26, 14.28);
+
+        auto lat = std::make_shared<Lattice_t>(2, 2, 1, 3);
+        lat->assign_object(pin1, 0);
+        lat->assign_object(pin2, 1);
+        lat->assign_object(box,  2);
+
+        lat->id(0, 0, 0) = 0;
+        lat->id(1, 0, 0) = 1;
+        lat->id(0, 1, 0) = 2;
+        lat->id(1, 1, 0) = 0;
+
+        lat->complete(0.0, 0.0, 0.0);
+
+        geometry = std::make_shared<Geometry_t>(lat);
+    }
+
+  protected:
+    SP_Geometry geometry;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(Volume_EstimatorTest, sweep)
+{
+    Estimator estimator(geometry);
+    estimator.calc_volumes(100000);
+    EXPECT_FALSE(estimator.from_cache());
+
+    const auto &ref     = geometry->cell_volumes();
+    const auto &volumes = estimator.volumes();
+    const auto &errors  = estimator.errors();
+    ASSERT_EQ(ref.size(), volumes.size());
+    ASSERT_EQ(ref.size(), errors.size());
+
+    double total = 0.0;
+    for (int c = 0; c < ref.size(); ++c)
+    {
+        // the estimates should be within 5 sigma of the analytic volumes
+        EXPECT_GT(errors[c], 0.0);
+        EXPECT_LT(errors[c], 0.02);
+        EXPECT_NEAR(ref[c], volumes[c], 5.0 * errors[c] * volumes[c]);
+        total += volumes[c];
+    }
+
+    // every ray crosses the whole box, so the total volume is exact
+    EXPECT_SOFTEQ(2.52 * 2.52 * 14.28, total, 1.0e-10);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Volume_EstimatorTest, set_volumes)
+{
+    Estimator estimator(geometry);
+    estimator.calc_volumes(1000);
+
+    geometry->set_cell_volumes(estimator.volumes());
+    for (int c = 0; c < geometry->num_cells(); ++c)
+    {
+        EXPECT_EQ(estimator.volumes()[c], geometry->cell_volume(c));
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Volume_EstimatorTest, hash)
+{
+    Estimator a(geometry), b(geometry);
+    EXPECT_EQ(a.hash(), b.hash());
+
+    // a different geometry gives a different hash
+    auto pin = std::make_shared<Pin_Cell_t>(1, 0.50, 5, 1.26, 14.28);
+    auto lat = std::make_shared<Lattice_t>(1, 1, 1, 1);
+    lat->assign_object(pin, 0);
+    lat->complete(0.0, 0.0, 0.0);
+
+    Estimator c(std::make_shared<Geometry_t>(lat));
+    EXPECT_NE(a.hash(), c.hash());
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstVolume_Estimator.cc
+//---------------------------------------------------------------------------//
@@ -28,6 +28,24 @@ namespace profugus
  *
  * This class does no communication; it takes a particle and transports it
  * until it leaves the domain.
+ *
+ * \section delta_tracking Delta-Tracking
+ *
+ * Particles in a user-specified range of groups can optionally be tracked
+ * with Woodcock delta-tracking.  Flights are sampled against the group-wise
+ * majorant cross section, \f$\Sigma_{\mathrm{maj}}\f$, provided by the
+ * physics, and the particle is only located in the geometry at the end of
+ * each flight.  A tentative collision is accepted as a real collision with
+ * probability \f$\Sigma_t/\Sigma_{\mathrm{maj}}\f$; otherwise the collision
+ * is virtual and the particle continues in the same direction.  This avoids
+ * the distance-to-boundary and surface-crossing calculations in finely
+ * subdivided regions where most steps end on geometric boundaries.
+ *
+ * In delta-tracking mode path-length tallies are scored with a collision
+ * estimator, \f$w/\Sigma_{\mathrm{maj}}\f$ at every tentative collision
+ * site (Tallier::collision).  A flight that reaches the bounding box of the
+ * geometry is uncollided, so the particle is streamed through the geometry
+ * to its outer boundary, where it escapes or reflects.
  */
 /*!
  * \example mc/test/tstDomain_Transporter.cc
@@ -97,12 +115,21 @@ class Domain_Transporter
     // Set fission site sampling.
     void set(SP_Fission_Sites fission_sites, double keff);
 
+    // Use delta-tracking for groups in the range [g_first, g_last].
+    void set_delta_tracking(int g_first, int g_last);
+
     // Transport a particle through the domain.
     void transport(Particle_t &particle, Bank_t &bank);
 
     //! Return the number of sampled fission sites.
     int num_sampled_fission_sites() const { return d_num_fission_sites; }
 
+    //! Query if delta-tracking is on for a given group.
+    bool delta_tracking(int g) const
+    {
+        return d_delta_tracking && g >= d_delta_first && g <= d_delta_last;
+    }
+
   private:
     // >>> IMPLEMENTATION
 
@@ -115,6 +142,13 @@ class Domain_Transporter
     // Total cross section in region.
     double d_xs_tot;
 
+    // Delta-tracking flag and group range.
+    bool d_delta_tracking;
+    int  d_delta_first, d_delta_last;
+
+    // Lower and upper extents of the geometry (for delta-tracking).
+    Space_Vector d_lower, d_upper;
+
     // Flag indicating that fission sites should be sampled.
     bool d_sample_fission_sites;
 
@@ -127,6 +161,19 @@ class Domain_Transporter
     // Process collisions and boundaries.
     void process_boundary(Particle_t &particle, Bank_t &bank);
     void process_collision(Particle_t &particle, Bank_t &bank);
+
+    // Collide a particle at its current location.
+    void collide(Particle_t &particle, Bank_t &bank);
+
+    // Sample a delta-tracking flight.
+    bool delta_flight(Particle_t &particle, Bank_t &bank);
+
+    // Stream an uncollided particle to the outer boundary.
+    void stream_to_boundary(Particle_t &particle, Bank_t &bank);
+
+    // Distance to the geometry extents along a ray.
+    double distance_to_extents(const Space_Vector &r,
+                               const Space_Vector &omega) const;
 };
 
 } // end namespace profugus
@@ -12,6 +12,7 @@
 #define MC_mc_Domain_Transporter_t_hh
 
 #include <cmath>
+#include <algorithm>
 
 #include "harness/DBC.hh"
 #include "harness/Diagnostics.hh"
@@ -30,7 +31,10 @@ namespace profugus
  */
 template <class Geometry>
 Domain_Transporter<Geometry>::Domain_Transporter()
-    : d_sample_fission_sites(false)
+    : d_delta_tracking(false)
+    , d_delta_first(0)
+    , d_delta_last(-1)
+    , d_sample_fission_sites(false)
     , d_keff(0.0)
 {
 }
@@ -54,6 +58,11 @@ void Domain_Transporter<Geometry>::set(SP_Geometry geometry,
     d_geometry = geometry;
     d_physics  = physics;
 
+    // store the extents of the geometry for delta-tracking
+    Bounding_Box extents = d_geometry->get_extents();
+    d_lower = extents.lower();
+    d_upper = extents.upper();
+
     if (d_var_reduction)
     {
         d_var_reduction->set(d_geometry);
@@ -123,6 +132,29 @@ void Domain_Transporter<Geometry>::set(SP_Fission_Sites fission_sites,
     d_num_fission_sites = 0;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Use delta-tracking for a range of groups.
+ *
+ * \param g_first first group that is delta-tracked
+ * \param g_last last group (inclusive) that is delta-tracked
+ */
+template <class Geometry>
+void Domain_Transporter<Geometry>::set_delta_tracking(int g_first,
+                                                      int g_last)
+{
+    REQUIRE(d_physics);
+    REQUIRE(g_first >= 0);
+    REQUIRE(g_first <= g_last);
+    REQUIRE(g_last < d_physics->num_groups());
+
+    d_delta_tracking = true;
+    d_delta_first    = g_first;
+    d_delta_last     = g_last;
+
+    ENSURE(delta_tracking(g_first) && delta_tracking(g_last));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Transport a particle through the domain.
@@ -150,6 +182,13 @@ void Domain_Transporter<Geometry>::transport(Particle_t &particle,
     // another domain
     while (particle.alive())
     {
+        // sample delta-tracking flights in the majorant groups
+        if (delta_tracking(particle.group()))
+        {
+            if (delta_flight(particle, bank))
+                continue;
+        }
+
         // calculate distance to collision in mean-free-paths
         d_dist_mfp = -std::log(particle.rng().ran());
 
@@ -300,6 +339,19 @@ void Domain_Transporter<Geometry>::process_collision(Particle_t &particle,
     // move the particle to the collision site
     d_geometry->move_to_point(d_step.step(), particle.geo_state());
 
+    // process the collision
+    collide(particle, bank);
+}
+
+//---------------------------------------------------------------------------//
+
+template <class Geometry>
+void Domain_Transporter<Geometry>::collide(Particle_t &particle,
+                                           Bank_t     &bank)
+{
+    REQUIRE(d_var_reduction);
+    REQUIRE(particle.event() == events::COLLISION);
+
     // sample fission sites
     if (d_sample_fission_sites)
     {
@@ -316,6 +368,123 @@ void Domain_Transporter<Geometry>::process_collision(Particle_t &particle,
     d_var_reduction->post_collision(particle, bank);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sample a delta-tracking flight to the next tentative collision.
+ *
+ * A flight that reaches the extents of the geometry is uncollided; the
+ * particle is streamed (without collisions) to the outer boundary, where it
+ * escapes or reflects.  Flights after a reflection are sampled from the
+ * reflecting surface.
+ *
+ * \return false if the majorant is zero, in which case the particle must be
+ * surface-tracked; true otherwise
+ */
+template <class Geometry>
+bool Domain_Transporter<Geometry>::delta_flight(Particle_t &particle,
+                                                Bank_t     &bank)
+{
+    REQUIRE(particle.alive());
+    REQUIRE(delta_tracking(particle.group()));
+
+    // particle state
+    Geo_State_t &geo_state = particle.geo_state();
+
+    // majorant cross section in this group
+    double xs_maj = d_physics->majorant(particle.group());
+    if (xs_maj <= 0.0)
+        return false;
+
+    // sample distance to the next tentative collision
+    d_dist_col = -std::log(particle.rng().ran()) / xs_maj;
+
+    // current position and direction
+    Space_Vector r     = d_geometry->position(geo_state);
+    Space_Vector omega = d_geometry->direction(geo_state);
+
+    // the flight leaves the extents uncollided
+    if (d_dist_col >= distance_to_extents(r, omega))
+    {
+        stream_to_boundary(particle, bank);
+        return true;
+    }
+
+    // move to the tentative collision site and locate the particle
+    r[def::X] += d_dist_col * omega[def::X];
+    r[def::Y] += d_dist_col * omega[def::Y];
+    r[def::Z] += d_dist_col * omega[def::Z];
+    d_geometry->initialize(r, omega, geo_state);
+    particle.set_matid(d_geometry->matid(geo_state));
+
+    // collision estimator of the flux at the tentative collision site
+    d_tallier->collision(1.0 / xs_maj, particle);
+
+    // total interaction cross section at the collision site
+    d_xs_tot = d_physics->total(physics::TOTAL, particle);
+    CHECK(d_xs_tot >= 0.0);
+    CHECK(d_xs_tot <= xs_maj);
+
+    // accept a real collision with probability sigma_t / sigma_maj
+    if (particle.rng().ran() * xs_maj < d_xs_tot)
+    {
+        particle.set_event(events::COLLISION);
+        collide(particle, bank);
+    }
+    else
+    {
+        // add a virtual collision diagnostic
+        DIAGNOSTICS_TWO(integers["virtual_collision"]++);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Stream a particle without collisions to the outer boundary.
+ *
+ * Internal surfaces are crossed as in surface-tracking (surface tallies and
+ * variance reduction are applied); streaming stops when the particle
+ * escapes, reflects, or is killed at a surface.
+ */
+template <class Geometry>
+void Domain_Transporter<Geometry>::stream_to_boundary(Particle_t &particle,
+                                                      Bank_t     &bank)
+{
+    Geo_State_t &geo_state = particle.geo_state();
+
+    int state = geometry::INSIDE;
+    while (state == geometry::INSIDE && particle.alive())
+    {
+        d_geometry->distance_to_boundary(geo_state);
+        particle.set_event(events::BOUNDARY);
+        process_boundary(particle, bank);
+        state = d_geometry->boundary_state(geo_state);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Distance from a point inside the geometry to its extents.
+ */
+template <class Geometry>
+double Domain_Transporter<Geometry>::distance_to_extents(
+    const Space_Vector &r,
+    const Space_Vector &omega) const
+{
+    double dist = constants::huge;
+
+    for (int d = 0; d < 3; ++d)
+    {
+        if (omega[d] > 0.0)
+            dist = std::min(dist, (d_upper[d] - r[d]) / omega[d]);
+        else if (omega[d] < 0.0)
+            dist = std::min(dist, (d_lower[d] - r[d]) / omega[d]);
+    }
+
+    return dist;
+}
+
 } // end namespace profugus
 
 #endif // MC_mc_Domain_Transporter_t_hh
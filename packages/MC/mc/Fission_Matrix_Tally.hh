@@ -152,6 +152,9 @@ class Fission_Matrix_Tally : public Compound_Tally<Geometry>
 
         //! Track particle and accumulate particle data.
         void accumulate(double step, const Particle_t &p);
+
+        //! Accumulate a collision estimate at the particle location.
+        void collision(double flux, const Particle_t &p);
     };
 
   public:
@@ -333,6 +333,43 @@ void Fission_Matrix_Tally<Geometry>::PL_Tally::accumulate(
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Accumulate a collision estimate at the particle location.
+ *
+ * The estimate is scored in the fission matrix mesh cell containing the
+ * particle; unlike accumulate() the particle is not tracked.
+ */
+template <class Geometry>
+void Fission_Matrix_Tally<Geometry>::PL_Tally::collision(
+        double            flux,
+        const Particle_t &p)
+{
+    using geometry::INSIDE;
+
+    // return if we haven't started tallying yet
+    if (d_data->d_cycle_start > d_data->d_cycle_ctr)
+        return;
+
+    REQUIRE(p.metadata().name(d_data->d_birth_idx) == "fm_birth_cell");
+
+    // locate the particle in the fission-matrix mesh
+    const auto &geo_state = p.geo_state();
+    d_data->d_fm_mesh->initialize(d_data->d_geometry->position(geo_state),
+                                  d_data->d_geometry->direction(geo_state),
+                                  d_fm_state);
+    if (d_data->d_fm_mesh->boundary_state(d_fm_state) != INSIDE)
+        return;
+
+    // fission matrix element (i,j) for the current cell and birth cell
+    int i = d_data->d_fm_mesh->cell(d_fm_state);
+    int j = p.metadata().template access<int>(d_data->d_birth_idx);
+    CHECK(i >= 0 && i < d_data->d_fm_mesh->num_cells());
+
+    d_data->d_numerator[Idx(i, j)] +=
+        flux * p.wt() * this->b_physics->total(physics::NU_FISSION, p);
+}
+
 } // end namespace profugus
 
 #endif // MC_mc_Fission_Matrix_Tally_t_hh
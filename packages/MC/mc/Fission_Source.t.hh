@@ -455,15 +455,8 @@ int Fission_Source<Geometry>::sample_geometry(Space_Vector       &r,
         CHECK(d_fis_dist.empty());
 
         // Sanity check that some fissionable material exists
-        std::vector<int> matids;
-        b_physics->xs().get_matids(matids);
-        CHECK( matids.size() > 0 );
-        bool fission_found = false;
-        for( auto matid : matids )
-        {
-            fission_found = fission_found | b_physics->is_fissionable(matid);
-        }
-        INSIST(fission_found,"No fissionable material found in problem.");
+        INSIST(b_physics->any_fissionable(),
+               "No fissionable material found in problem.");
 
         // sample the geometry until a fission site is found (if there is no
         // fission in a given domain the number of particles on that domain is
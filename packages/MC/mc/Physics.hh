@@ -18,9 +18,12 @@
 #include "Teuchos_ParameterList.hpp"
 
 #include "harness/DBC.hh"
+#include "comm/Shared_Array.hh"
 #include "utils/Definitions.hh"
 #include "utils/Static_Map.hh"
+#include "utils/LRU_Cache.hh"
 #include "xs/XS.hh"
+#include "xs/Mix_Table.hh"
 #include "Definitions.hh"
 #include "Group_Bounds.hh"
 #include "Particle.hh"
@@ -42,6 +45,24 @@ namespace profugus
  *
  * \arg \c check_balance (bool) check for balanced scattering tables (default:
  * false)
+ *
+ * \arg \c mix_cache_size (int) maximum number of (mixture, group) cross
+ * sections that are cached when a Mix_Table is used (default: 4096)
+ *
+ * \section mixed_physics Material Mixing
+ *
+ * When the physics is constructed with a Mix_Table, the material ids in the
+ * geometry are mixed material ids (rows of the table) and the cross section
+ * database contains the pure (unmixed) materials.  Macroscopic mixture cross
+ * sections are computed on the fly for each (mixture, group) and kept in a
+ * bounded least-recently-used cache, so the memory scales with the number of
+ * pure materials instead of the number of mixtures.  At a collision the
+ * scattering constituent is sampled from the mixture; at a fission site the
+ * fissioning constituent is sampled and stored in the site.
+ *
+ * The xs() database always contains the pure materials, so clients that
+ * read it directly with geometric material ids (eg. fission matrix
+ * acceleration) require unmixed materials.
  */
 /*!
  * \example mc_physics/test/tstPhysics.cc
@@ -69,6 +90,8 @@ class Physics
     typedef Teuchos::ParameterList              ParameterList_t;
     typedef Teuchos::RCP<ParameterList_t>       RCP_Std_DB;
     typedef typename Geometry_t::Space_Vector   Space_Vector;
+    typedef Mix_Table                           Mix_Table_t;
+    typedef std::shared_ptr<const Mix_Table_t>  SP_Mix_Table;
     //@}
 
     //! Fission site structure for storing fission sites in k-code.
@@ -81,6 +104,18 @@ class Physics
     //! Fission_Site container.
     typedef std::vector<Fission_Site> Fission_Site_Container;
 
+    //! Macroscopic cross sections of a mixture in a group.
+    struct Mixture_XS
+    {
+        double total;
+        double scatter;
+        double fission;
+        double nu_fission;
+    };
+
+    //! Cache of mixture cross sections keyed by (mixed matid, group).
+    typedef LRU_Cache<std::size_t, Mixture_XS> Mixture_Cache;
+
   private:
     // >>> DATA
 
@@ -90,10 +125,16 @@ class Physics
     // Geometry.
     SP_Geometry d_geometry;
 
+    // Mix table (null if materials are unmixed).
+    SP_Mix_Table d_mix;
+
   public:
     // Constructor that auto-creates group bounds.
     explicit Physics(RCP_Std_DB db, RCP_XS mat);
 
+    // Constructor for mixed materials.
+    Physics(RCP_Std_DB db, RCP_XS mat, SP_Mix_Table mix);
+
     // >>> PUBLIC TRANSPORT INTERFACE
 
     //! Set the geometry.
@@ -140,9 +181,16 @@ class Physics
     // Return whether a given material is fissionable
     bool is_fissionable(unsigned int matid) const
     {
-        return d_fissionable[d_mid2l[matid]];
+        return d_mix ? d_mix_fissionable[matid]
+                     : d_fissionable[d_mid2l[matid]];
     }
 
+    // Return whether any material is fissionable.
+    bool any_fissionable() const;
+
+    // Release node-shared cross sections (collective).
+    void free_shared();
+
     // >>> FISSION SITE CONTAINER OPERATIONS
 
     //! Fission site position.
@@ -156,19 +204,32 @@ class Physics
     //! Get cross section database.
     const XS_t& xs() const { return *d_mat; }
 
+    //! Get the mix table (null if materials are unmixed).
+    SP_Mix_Table mix_table() const { return d_mix; }
+
+    //! Get the mixture cross section cache.
+    const Mixture_Cache& mixture_cache() const { return d_mix_cache; }
+
     //! Number of discrete energy groups
     int num_groups() const { return d_Ng; }
 
     //! Group boundaries
     const Group_Bounds& group_bounds() const { return d_gb; }
 
+    //! Majorant (maximum total) cross section over all geometric materials
+    //! (mixture rows when mixing) in group g.
+    double majorant(int g) const
+    {
+        REQUIRE(g >= 0 && g < d_Ng);
+        return d_majorant[g];
+    }
+
   private:
     // >>> IMPLEMENTATION
 
     // Private types.
     typedef def::Vec_Dbl         Vec_Dbl;
     typedef def::Vec_Int         Vec_Int;
-    typedef std::vector<Vec_Dbl> Vec_Vec_Dbl;
 
     // Boolean for implicit capture.
     bool d_implicit_capture;
@@ -185,15 +246,46 @@ class Physics
     // Matid-to-local hash such that d_mid2l[matid] = [0,N).
     Static_Map<unsigned int, unsigned int> d_mid2l;
 
-    // Total scattering for each group and material.
-    Vec_Vec_Dbl d_scatter;
+    // Total scattering for each material and group [m][g] (node-shared when
+    // the cross sections are shared).
+    Shared_Array<double> d_scatter;
 
     // Fissionable bool by local matid.
     std::vector<bool> d_fissionable;
 
+    // Maximum total cross section over all materials for each group.
+    Vec_Dbl d_majorant;
+
     // Material id of current region.
     int d_matid;
 
+    // Fissionable bool by mixed matid.
+    std::vector<bool> d_mix_fissionable;
+
+    // Cached mixture cross sections.
+    Mixture_Cache d_mix_cache;
+
+    // Offset of group g of local material m in d_scatter (computed in
+    // size_t so that large libraries do not overflow).
+    std::size_t xs_index(int m, int g) const
+    {
+        return static_cast<std::size_t>(m) * d_Ng + g;
+    }
+
+    // Check a geometric (unmixed or mixed) matid.
+    bool valid_matid(unsigned int matid) const
+    {
+        return d_mix ? matid < static_cast<unsigned int>(d_mix->num_rows())
+                     : d_mat->has(matid);
+    }
+
+    // Get the macroscopic cross sections of a mixture in group g.
+    const Mixture_XS& mixture_xs(unsigned int matid, int g);
+
+    // Sample a pure constituent of a mixture.
+    int sample_constituent(unsigned int matid, int g,
+                           physics::Reaction_Type type, double rnd) const;
+
     // Sample a group.
     int sample_group(int matid, int g, double rnd) const;
 
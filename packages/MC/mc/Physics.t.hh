@@ -32,13 +32,32 @@ namespace profugus
 template <class Geometry>
 Physics<Geometry>::Physics(RCP_Std_DB db,
                            RCP_XS     mat)
+    : Physics(db, mat, SP_Mix_Table())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor for mixed materials.
+ *
+ * \param db physics parameters
+ * \param mat cross sections of the pure (unmixed) materials
+ * \param mix completed mix table whose rows are the mixed matids used in the
+ * geometry and whose columns are matids in \a mat; if null the geometry
+ * uses the matids in \a mat directly
+ */
+template <class Geometry>
+Physics<Geometry>::Physics(RCP_Std_DB   db,
+                           RCP_XS       mat,
+                           SP_Mix_Table mix)
     : d_mat(mat)
+    , d_mix(mix)
     , d_Ng(d_mat->num_groups())
     , d_Nm(d_mat->num_mat())
     , d_gb(Vec_Dbl(mat->bounds().values(),
                    mat->bounds().values() + mat->bounds().length()))
-    , d_scatter(d_Nm)
     , d_fissionable(d_Nm)
+    , d_majorant(d_Ng, 0.0)
 {
     REQUIRE(!db.is_null());
     REQUIRE(!d_mat.is_null());
@@ -71,6 +90,9 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
     d_mid2l.complete();
     CHECK(d_mid2l.size() == d_Nm);
 
+    // allocate the total scattering
+    d_scatter.allocate(xs_index(d_Nm, 0), 0.0);
+
     // calculate total scattering over all groups for each material and
     // determine if fission is available for a given material
     for (auto matid : matids)
@@ -79,8 +101,8 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
         int m = d_mid2l[static_cast<unsigned int>(matid)];
         CHECK(m < d_Nm);
 
-        // size the group vector for this material
-        d_scatter[m].resize(d_Ng, 0.0);
+        // total scattering for this material
+        double *scatter = &d_scatter[xs_index(m, 0)];
 
         // get the P0 scattering matrix for this material
         const auto &sig_s = d_mat->matrix(matid, 0);
@@ -98,7 +120,7 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
             // add up the scattering
             for (int gp = 0; gp < d_Ng; ++gp)
             {
-                d_scatter[m][g] += column[gp];
+                scatter[g] += column[gp];
             }
         }
 
@@ -107,14 +129,14 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
         {
             for (int g = 0; g < d_Ng; g++)
             {
-                if (d_scatter[m][g] > d_mat->vector(matid, XS_t::TOTAL)[g])
+                if (scatter[g] > d_mat->vector(matid, XS_t::TOTAL)[g])
                 {
                     std::ostringstream mm;
                     mm << "Scattering greater than total "
                        << "for material" << m << " in group " << g
                        << ". Total xs is "
                        << d_mat->vector(matid, XS_t::TOTAL)[g]
-                       << " and scatter is " << d_scatter[m][g];
+                       << " and scatter is " << scatter[g];
 
                     // terminate if we are running analog
                     if (!d_implicit_capture)
@@ -129,6 +151,59 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
         // see if this material is fissionable by checking Chi
         d_fissionable[m] = d_mat->vector(matid, XS_t::CHI).normOne() > 0.0 ?
                            true : false;
+
+        // update the group-wise majorant cross sections
+        const auto &sig_t = d_mat->vector(matid, XS_t::TOTAL);
+        for (int g = 0; g < d_Ng; ++g)
+        {
+            d_majorant[g] = std::max(d_majorant[g], sig_t[g]);
+        }
+    }
+
+    // hold one copy of the total scattering per node when the cross sections
+    // are shared
+    if (d_mat->is_shared())
+    {
+        d_scatter.share();
+    }
+
+    // setup mixtures; the geometry only contains mixed materials, so the
+    // majorant is taken over the rows of the mix table
+    if (d_mix)
+    {
+        REQUIRE(d_mix->completed());
+
+        d_mix_fissionable.resize(d_mix->num_rows(), false);
+        std::fill(d_majorant.begin(), d_majorant.end(), 0.0);
+        Vec_Dbl mixed_t(d_Ng);
+        for (int r = 0; r < d_mix->num_rows(); ++r)
+        {
+            std::fill(mixed_t.begin(), mixed_t.end(), 0.0);
+            for (const auto &mf : d_mix->row(r))
+            {
+                VALIDATE(d_mat->has(mf.first), "Mixed material " << r
+                         << " contains material " << mf.first << " that is "
+                         << "not in the cross section database.");
+
+                if (mf.second > 0.0 && d_fissionable[d_mid2l[mf.first]])
+                    d_mix_fissionable[r] = true;
+
+                // add this constituent to the mixture total
+                const auto &sig_t = d_mat->vector(mf.first, XS_t::TOTAL);
+                for (int g = 0; g < d_Ng; ++g)
+                {
+                    mixed_t[g] += mf.second * sig_t[g];
+                }
+            }
+
+            // update the group-wise majorant cross sections
+            for (int g = 0; g < d_Ng; ++g)
+            {
+                d_majorant[g] = std::max(d_majorant[g], mixed_t[g]);
+            }
+        }
+
+        d_mix_cache.set_capacity(db->get("mix_cache_size", 4096));
     }
 
     ENSURE(d_Nm > 0);
@@ -180,15 +255,24 @@ void Physics<Geometry>::collide(Particle_t &particle,
 
     // get the material id of the current region
     d_matid = particle.matid();
-    CHECK(d_mid2l[static_cast<unsigned int>(d_matid)] < d_Nm);
+    CHECK(valid_matid(d_matid));
     CHECK(d_geometry->matid(particle.geo_state()) == d_matid);
 
     // get the group index
     int group = particle.group();
 
     // calculate the scattering cross section ratio
-    double c = d_scatter[d_mid2l[d_matid]][group] /
-               d_mat->vector(d_matid, XS_t::TOTAL)[group];
+    double c = 0.0;
+    if (d_mix)
+    {
+        const Mixture_XS &mixed = mixture_xs(d_matid, group);
+        c = mixed.scatter / mixed.total;
+    }
+    else
+    {
+        c = d_scatter[xs_index(d_mid2l[d_matid], group)] /
+            d_mat->vector(d_matid, XS_t::TOTAL)[group];
+    }
     CHECK(!d_implicit_capture ? c <= 1.0 : c >= 0.0);
 
     // we need to do analog transport if the particle is c = 0.0 regardless of
@@ -226,8 +310,16 @@ void Physics<Geometry>::collide(Particle_t &particle,
     // process scattering events
     if (particle.event() != events::ABSORPTION)
     {
+        // sample the scattering constituent of a mixture
+        int matid = d_matid;
+        if (d_mix)
+        {
+            matid = sample_constituent(d_matid, group, physics::SCATTERING,
+                                       particle.rng().ran());
+        }
+
         // determine new group of particle
-        group = sample_group(d_matid, group, particle.rng().ran());
+        group = sample_group(matid, group, particle.rng().ran());
         CHECK(group >= 0 && group < d_Ng);
 
         // set the group
@@ -256,7 +348,30 @@ double Physics<Geometry>::total(physics::Reaction_Type  type,
 
     // get the matid from the particle
     unsigned int matid = p.matid();
-    CHECK(d_mat->has(matid));
+    CHECK(valid_matid(matid));
+
+    // mixtures
+    if (d_mix)
+    {
+        const Mixture_XS &mixed = mixture_xs(matid, p.group());
+        switch (type)
+        {
+            case physics::TOTAL:
+                return mixed.total;
+
+            case physics::SCATTERING:
+                return mixed.scatter;
+
+            case physics::FISSION:
+                return mixed.fission;
+
+            case physics::NU_FISSION:
+                return mixed.nu_fission;
+
+            default:
+                return 0.0;
+        }
+    }
 
     // return the approprate reaction type
     switch (type)
@@ -265,7 +380,7 @@ double Physics<Geometry>::total(physics::Reaction_Type  type,
             return d_mat->vector(matid, XS_t::TOTAL)[p.group()];
 
         case physics::SCATTERING:
-            return d_scatter[d_mid2l[matid]][p.group()];
+            return d_scatter[xs_index(d_mid2l[matid], p.group())];
 
         case physics::FISSION:
             return d_mat->vector(matid, XS_t::SIG_F)[p.group()];
@@ -297,7 +412,7 @@ template <class Geometry>
 bool Physics<Geometry>::initialize_fission(unsigned int  matid,
                                            Particle_t   &p)
 {
-    REQUIRE(d_mat->has(matid));
+    REQUIRE(valid_matid(matid));
 
     // sampled flag
     bool sampled = false;
@@ -305,6 +420,13 @@ bool Physics<Geometry>::initialize_fission(unsigned int  matid,
     // only do sampling if this is a fissionable material
     if (is_fissionable(matid))
     {
+        // sample a fissionable constituent of a mixture
+        if (d_mix)
+        {
+            matid = sample_constituent(matid, -1, physics::NU_FISSION,
+                                       p.rng().ran());
+        }
+
         // sample the fission group
         int group = sample_fission_group(matid, p.rng().ran());
         sampled   = true;
@@ -339,6 +461,9 @@ bool Physics<Geometry>::initialize_fission(unsigned int  matid,
  * and \e n is the number of fission events at the site rounded to the nearest
  * integer.
  *
+ * In a mixture the fissioning constituent is sampled for each site and
+ * stored as the site material.
+ *
  * \return the number of fission events added at the site
  */
 template <class Geometry>
@@ -347,7 +472,7 @@ int Physics<Geometry>::sample_fission_site(const Particle_t       &p,
                                            double                  keff)
 {
     REQUIRE(d_geometry);
-    REQUIRE(d_mat->has(p.matid()));
+    REQUIRE(valid_matid(p.matid()));
 
     // material id
     unsigned int matid = p.matid();
@@ -363,17 +488,29 @@ int Physics<Geometry>::sample_fission_site(const Particle_t       &p,
 
     // calculate the number of fission sites (random number samples to nearest
     // integer)
-    int n = static_cast<int>(
-        p.wt() *
-        d_mat->vector(matid, XS_t::NU_SIG_F)[group] /
-        d_mat->vector(matid, XS_t::TOTAL)[group] /
-        keff + p.rng().ran());
+    double ratio = 0.0;
+    if (d_mix)
+    {
+        const Mixture_XS &mixed = mixture_xs(matid, group);
+        ratio = mixed.nu_fission / mixed.total;
+    }
+    else
+    {
+        ratio = d_mat->vector(matid, XS_t::NU_SIG_F)[group] /
+                d_mat->vector(matid, XS_t::TOTAL)[group];
+    }
+    int n = static_cast<int>(p.wt() * ratio / keff + p.rng().ran());
 
     // add sites to the fission site container
     for (int i = 0; i < n; ++i)
     {
         Fission_Site site;
         site.m = matid;
+        if (d_mix)
+        {
+            site.m = sample_constituent(matid, group, physics::NU_FISSION,
+                                        p.rng().ran());
+        }
         site.r = d_geometry->position(p.geo_state());
         fsc.push_back(site);
     }
@@ -393,13 +530,15 @@ int Physics<Geometry>::sample_fission_site(const Particle_t       &p,
  *
  * \return true if physics state initialized; false if no particles are left
  * at the site
+ *
+ * The site material is always a pure (unmixed) material.
  */
 template <class Geometry>
 bool Physics<Geometry>::initialize_fission(Fission_Site &fs,
                                            Particle_t   &p)
 {
     REQUIRE(d_mat->has(fs.m));
-    REQUIRE(is_fissionable(fs.m));
+    REQUIRE(d_fissionable[d_mid2l[fs.m]]);
 
     // sample the fission group
     int group = sample_fission_group(fs.m, p.rng().ran());
@@ -412,8 +551,140 @@ bool Physics<Geometry>::initialize_fission(Fission_Site &fs,
     return true;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return whether any material is fissionable.
+ */
+template <class Geometry>
+bool Physics<Geometry>::any_fissionable() const
+{
+    const auto &fissionable = d_mix ? d_mix_fissionable : d_fissionable;
+    return std::find(fissionable.begin(), fissionable.end(), true) !=
+        fissionable.end();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Release node-shared cross sections.
+ *
+ * This call is collective over the current communicator and does nothing if
+ * the cross sections are not shared.  The physics cannot be used afterwards.
+ */
+template <class Geometry>
+void Physics<Geometry>::free_shared()
+{
+    if (d_scatter.shared())
+    {
+        d_scatter.free();
+    }
+    if (d_mat->is_shared())
+    {
+        d_mat->free_shared();
+    }
+}
+
 //---------------------------------------------------------------------------//
 // PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the macroscopic cross sections of a mixture in group g.
+ *
+ * The cross sections are volume-fraction weighted sums over the pure
+ * constituents.  They are calculated on the first request and cached.
+ */
+template <class Geometry>
+auto Physics<Geometry>::mixture_xs(unsigned int matid,
+                                   int          g) -> const Mixture_XS&
+{
+    REQUIRE(d_mix);
+    REQUIRE(valid_matid(matid));
+    REQUIRE(g >= 0 && g < d_Ng);
+
+    std::size_t key = static_cast<std::size_t>(matid) * d_Ng + g;
+
+    // return cached data
+    if (const Mixture_XS *cached = d_mix_cache.find(key))
+        return *cached;
+
+    // otherwise calculate it
+    Mixture_XS mixed = {0.0, 0.0, 0.0, 0.0};
+    for (const auto &mf : d_mix->row(matid))
+    {
+        const auto pure = static_cast<unsigned int>(mf.first);
+        const double f  = mf.second;
+
+        mixed.total      += f * d_mat->vector(pure, XS_t::TOTAL)[g];
+        mixed.scatter    += f * d_scatter[xs_index(d_mid2l[pure], g)];
+        mixed.fission    += f * d_mat->vector(pure, XS_t::SIG_F)[g];
+        mixed.nu_fission += f * d_mat->vector(pure, XS_t::NU_SIG_F)[g];
+    }
+
+    return d_mix_cache.insert(key, mixed);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sample a pure constituent of a mixture.
+ *
+ * Constituents are sampled in proportion to their contribution to the
+ * mixture's scattering (\c physics::SCATTERING) or nu-fission (\c
+ * physics::NU_FISSION) cross section in group g.  If g is negative
+ * fissionable constituents are sampled by volume fraction.
+ */
+template <class Geometry>
+int Physics<Geometry>::sample_constituent(unsigned int           matid,
+                                          int                    g,
+                                          physics::Reaction_Type type,
+                                          double                 rnd) const
+{
+    REQUIRE(d_mix);
+    REQUIRE(valid_matid(matid));
+    REQUIRE(g < d_Ng);
+    REQUIRE(type == physics::SCATTERING || type == physics::NU_FISSION);
+    REQUIRE(rnd >= 0.0 && rnd < 1.0);
+
+    auto row = d_mix->row(matid);
+    CHECK(!row.empty());
+
+    // weight of each constituent
+    auto weight = [this, g, type](unsigned int pure, double f) -> double
+    {
+        int m = d_mid2l[pure];
+        if (type == physics::SCATTERING)
+            return f * d_scatter[xs_index(m, g)];
+        if (g < 0)
+            return d_fissionable[m] ? f : 0.0;
+        return f * d_mat->vector(pure, XS_t::NU_SIG_F)[g];
+    };
+
+    double total = 0.0;
+    for (const auto &mf : row)
+    {
+        total += weight(mf.first, mf.second);
+    }
+    CHECK(total > 0.0);
+
+    // sample the constituent
+    double cdf = 0.0, w = 0.0;
+    int    last = -1;
+    rnd *= total;
+    for (const auto &mf : row)
+    {
+        w = weight(mf.first, mf.second);
+        if (w > 0.0)
+        {
+            cdf  += w;
+            last  = mf.first;
+            if (rnd <= cdf)
+                return last;
+        }
+    }
+
+    // roundoff
+    CHECK(last >= 0);
+    return last;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Sample a group after a scattering event.
@@ -434,15 +705,19 @@ int Physics<Geometry>::sample_group(int    matid,
     double cdf = 0.0;
 
     // total out-scattering for this cell and group
-    double total = 1.0 / d_scatter[d_mid2l[matid]][g];
+    double total = 1.0 / d_scatter[xs_index(d_mid2l[matid], g)];
 
     // get the P0 scattering cross section matrix the g column (which is the
     // outscatter) for this group (g->g' is the {A_(g'g) g'=0,Ng} entries of
     // the inscatter matrix
     const auto *scat_g = d_mat->matrix(matid, 0)[g];
 
+    // only the nonzero band of the outscatter needs to be sampled
+    int gp_first = 0, gp_last = 0;
+    d_mat->scatter_band(matid, 0, g, gp_first, gp_last);
+
     // sample g'
-    for (int gp = 0; gp < d_Ng; ++gp)
+    for (int gp = gp_first; gp <= gp_last; ++gp)
     {
         // calculate the cdf for scattering to this group
         cdf += scat_g[gp] * total;
@@ -470,7 +745,7 @@ int Physics<Geometry>::sample_fission_group(unsigned int matid,
                                             double       rnd) const
 {
     REQUIRE(d_mat->has(matid));
-    REQUIRE(is_fissionable(matid));
+    REQUIRE(d_fissionable[d_mid2l[matid]]);
 
     // running cdf; we make the cdf on the fly because nearly all of the
     // emission is in the first couple of groups so its not worth storing for
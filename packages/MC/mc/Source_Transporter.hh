@@ -33,6 +33,16 @@ namespace profugus
  *
  * It solves the fixed source problem using a domain replication (DR) parallel
  * strategy.  In DR the entire mesh is replicated across all domains.
+ *
+ * \section db_source_transporter Standard DB Entries for Source_Transporter
+ *
+ * \arg \c mc_diag_frac (double) fraction of histories between diagnostic
+ * output (default: 1.1)
+ *
+ * \arg \c delta_tracking (bool) use Woodcock delta-tracking (default: false)
+ *
+ * \arg \c delta_tracking_groups (Array<int>) first and last (inclusive)
+ * groups that are delta-tracked (default: all groups)
  */
 /*!
  * \example mc/test/tstSource_Transporter.cc
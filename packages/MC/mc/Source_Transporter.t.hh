@@ -47,6 +47,20 @@ Source_Transporter<Geometry>::Source_Transporter(RCP_Std_DB  db,
 
     // set the output frequency for particle transport diagnostics
     d_print_fraction = db->get("mc_diag_frac", 1.1);
+
+    // setup delta-tracking over the requested range of groups
+    if (db->get("delta_tracking", false))
+    {
+        Teuchos::Array<int> all_groups(2, 0);
+        all_groups[1] = d_physics->num_groups() - 1;
+
+        const auto &groups = db->get("delta_tracking_groups", all_groups);
+        VALIDATE(groups.size() == 2, "delta_tracking_groups must contain "
+                 << "the first and last groups, but has size "
+                 << groups.size());
+
+        d_transporter.set_delta_tracking(groups[0], groups[1]);
+    }
 }
 
 //---------------------------------------------------------------------------//
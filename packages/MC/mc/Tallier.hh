@@ -129,6 +129,9 @@ class Tallier
     // Process path-length tally events.
     void path_length(double step, const Particle_t &p);
 
+    // Process collision estimates of path-length tallies.
+    void collision(double flux, const Particle_t &p);
+
     // Tally any source events.
     void source(const Particle_t &p);
 
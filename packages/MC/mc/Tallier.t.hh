@@ -228,6 +228,34 @@ void Tallier<Geometry>::path_length(double            step,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Process collision estimates of path-length tallies.
+ *
+ * This is used by delta-tracking, where the track length is estimated at
+ * tentative collision sites rather than known along a step.
+ *
+ * \param flux track-length estimate (eg. 1/majorant)
+ * \param p particle
+ */
+template <class Geometry>
+void Tallier<Geometry>::collision(double            flux,
+                                  const Particle_t &p)
+{
+    REQUIRE(d_build_phase == BUILT);
+    REQUIRE(flux >= 0.0);
+
+    if (!num_pathlength_tallies())
+        return;
+
+    SCOPED_TIMER_3("MC::Tallier.collision");
+
+    for (auto t : d_pl)
+    {
+        t->collision(flux, p);
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Tally any source events.
@@ -147,6 +147,14 @@ class Pathlength_Tally : public Tally<Geometry>
 
     //! Track particle and tally.
     virtual void accumulate(double step, const Particle_t &p) = 0;
+
+    //! Tally a collision estimate of the track length at the particle
+    //! location (delta-tracking); tallies that score at the particle
+    //! location treat it as a step.
+    virtual void collision(double flux, const Particle_t &p)
+    {
+        accumulate(flux, p);
+    }
 };
 
 //---------------------------------------------------------------------------//
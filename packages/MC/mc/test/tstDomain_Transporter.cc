@@ -50,6 +50,67 @@ class Domain_TransporterTest : public TransporterTestBase
 
 //---------------------------------------------------------------------------//
 
+class Absorber_Domain_TransporterTest : public Domain_TransporterTest
+{
+  protected:
+
+    // Same materials as the base, without scattering or fission.
+    void init_physics()
+    {
+        const int ng = num_groups();
+
+        RCP_XS xs(Teuchos::rcp(new XS_t()));
+        xs->set(0, ng);
+
+        XS_t::OneDArray tot1(ng, 10.0);
+        XS_t::OneDArray tot2(ng, 1.5);
+        XS_t::OneDArray tot3(ng, 1.1);
+        XS_t::TwoDArray sct(ng, ng, 0.0);
+
+        xs->set_bounds(XS_t::OneDArray(group_bounds->group_bounds()));
+        xs->add(1, XS_t::TOTAL, tot1);
+        xs->add(2, XS_t::TOTAL, tot2);
+        xs->add(3, XS_t::TOTAL, tot3);
+        xs->add(1, 0, sct);
+        xs->add(2, 0, sct);
+        xs->add(3, 0, sct);
+        xs->complete();
+
+        physics = std::make_shared<Physics_t>(db, xs);
+    }
+
+    // Transport Np particles from r along omega and return the number that
+    // escape (the others are absorbed).
+    int escapes(Transporter &transporter, const Vector &r,
+                const Vector &omega, int Np)
+    {
+        Particle_t p;
+        Bank_t     bank;
+        p.set_rng(rcon->rng(15));
+
+        int esc = 0;
+        for (int n = 0; n < Np; ++n)
+        {
+            p.set_wt(1.0);
+            geometry->initialize(r, omega, p.geo_state());
+            p.set_matid(geometry->matid(p.geo_state()));
+            physics->initialize(1.1, p);
+
+            p.live();
+            transporter.transport(p, bank);
+            EXPECT_TRUE(!p.alive());
+
+            if (p.event() == profugus::events::ESCAPE)
+                ++esc;
+            else
+                EXPECT_EQ(profugus::events::ABSORPTION, p.event());
+        }
+        return esc;
+    }
+};
+
+//---------------------------------------------------------------------------//
+
 class Reflecting_Domain_TransporterTest : public TransporterTestBase
 {
   protected:
@@ -207,6 +268,51 @@ TEST_F(Domain_TransporterTest, transport)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(Absorber_Domain_TransporterTest, delta_tracking)
+{
+    Transporter analog;
+    analog.set(geometry, physics);
+    analog.set(var_red);
+    analog.set(tallier);
+
+    Transporter delta;
+    delta.set(geometry, physics);
+    delta.set(var_red);
+    delta.set(tallier);
+
+    // delta-track all groups
+    EXPECT_FALSE(delta.delta_tracking(0));
+    delta.set_delta_tracking(0, num_groups() - 1);
+    for (int g = 0; g < num_groups(); ++g)
+    {
+        EXPECT_TRUE(delta.delta_tracking(g));
+        EXPECT_EQ(10.0, physics->majorant(g));
+    }
+
+    // particles start on the axis of the central guide tube (sigma_t = 1.5,
+    // far below the majorant) and stream upward and out of the top of the
+    // core after 1/3 cm inside the tube; the escape probability of a pure
+    // absorber is exactly exp(-sigma_t * l) = exp(-0.5)
+    Vector omega(0.6, 0.0, 0.8);
+    Vector r(1.89, 1.89, 14.28 - 0.8 / 3.0);
+    double ref = exp(-0.5);
+
+    int    Np    = 10000;
+    double sigma = sqrt(ref * (1.0 - ref) / Np);
+
+    double p_a = static_cast<double>(escapes(analog, r, omega, Np)) / Np;
+    double p_d = static_cast<double>(escapes(delta, r, omega, Np)) / Np;
+
+    cout << "Escape probability = " << ref << ", surface-tracking = " << p_a
+         << ", delta-tracking = " << p_d << endl;
+
+    // discarding flights that reach the boundary would give exp(-1.0)
+    EXPECT_LT(fabs(p_a - ref), 4.0 * sigma);
+    EXPECT_LT(fabs(p_d - ref), 4.0 * sigma);
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(Reflecting_Domain_TransporterTest, transport)
 {
     Transporter transporter;
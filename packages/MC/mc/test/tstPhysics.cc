@@ -819,6 +819,112 @@ TYPED_TEST(PhysicsTest, fission_sampling)
     EXPECT_EQ(0, physics.sample_fission_site(*p, fsites, 0.1));
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(PhysicsTest, mixing)
+{
+    typedef typename TestFixture::Particle               Particle;
+    typedef typename TestFixture::SP_Particle            SP_Particle;
+    typedef typename TestFixture::Physics_t              Physics_t;
+    typedef typename TestFixture::Space_Vector           Space_Vector;
+    typedef typename TestFixture::Fission_Site_Container FSC;
+
+    using profugus::physics::TOTAL;
+    using profugus::physics::SCATTERING;
+    using profugus::physics::FISSION;
+    using profugus::physics::NU_FISSION;
+
+    // mixed material 0 is pure 0, 1 is 1:3 of 0 and 1, 2 is pure 1
+    auto mix = std::make_shared<profugus::Mix_Table>();
+    mix->start_row();
+    mix->extend_row(0, 1.0);
+    mix->start_row();
+    mix->extend_row(0, 1.0);
+    mix->extend_row(1, 3.0);
+    mix->start_row();
+    mix->extend_row(1, 1.0);
+    mix->complete();
+
+    this->db->set("mix_cache_size", 4);
+    Physics_t physics(this->db, this->xs, mix);
+    physics.set_geometry(this->geometry);
+
+    EXPECT_FALSE(physics.is_fissionable(0));
+    EXPECT_TRUE(physics.is_fissionable(1));
+    EXPECT_TRUE(physics.is_fissionable(2));
+    EXPECT_TRUE(physics.any_fissionable());
+    EXPECT_EQ(4, physics.mixture_cache().capacity());
+
+    double t[] = {5.2, 11.4, 18.2, 29.9, 27.3};
+    double s[] = {2.6, 8.3, 13.7, 17.8, 12.0};
+    double f[] = {0.1, 0.4, 1.8, 5.7, 9.8};
+
+    // the majorant is over the mixtures; pure material 1 has the largest
+    // total
+    for (int g = 0; g < 5; ++g)
+    {
+        EXPECT_SOFTEQ(t[g] + f[g], physics.majorant(g), 1.e-12);
+    }
+
+    // a geometry that only contains material 0 has a tighter majorant than
+    // the pure materials
+    {
+        auto light = std::make_shared<profugus::Mix_Table>();
+        light->start_row();
+        light->extend_row(0, 1.0);
+        light->complete();
+
+        Physics_t lp(this->db, this->xs, light);
+        for (int g = 0; g < 5; ++g)
+        {
+            EXPECT_SOFTEQ(t[g], lp.majorant(g), 1.e-12);
+        }
+    }
+
+    SP_Particle p(make_shared<Particle>());
+    p->set_matid(1);
+    for (int g = 0; g < 5; ++g)
+    {
+        p->set_group(g);
+        EXPECT_SOFTEQ(t[g] + 0.75 * f[g], physics.total(TOTAL, *p), 1.e-12);
+        EXPECT_SOFTEQ(s[g], physics.total(SCATTERING, *p), 1.e-12);
+        EXPECT_SOFTEQ(0.75 * f[g], physics.total(FISSION, *p), 1.e-12);
+        EXPECT_SOFTEQ(1.8 * f[g], physics.total(NU_FISSION, *p), 1.e-12);
+    }
+
+    // each (mixture, group) was calculated once and only the last 4 are
+    // cached
+    EXPECT_EQ(4, physics.mixture_cache().size());
+    EXPECT_EQ(15, physics.mixture_cache().hits());
+    EXPECT_EQ(5, physics.mixture_cache().misses());
+
+    p->set_matid(2);
+    p->set_group(3);
+    EXPECT_SOFTEQ(t[3] + f[3], physics.total(TOTAL, *p), 1.e-12);
+
+    // fission sites in the mixture are made on the fissionable constituent
+    FSC fsites;
+    this->geometry->initialize(Space_Vector(1.1, 0.5, 6.2),
+                               Space_Vector(1.0, 1.0, 1.0),
+                               p->geo_state());
+    p->set_matid(1);
+    p->set_rng(this->rng);
+    p->set_wt(1.0);
+    p->set_group(4);
+    int n = physics.sample_fission_site(*p, fsites, 0.1);
+    EXPECT_GT(n, 0);
+    for (const auto &site : fsites)
+    {
+        EXPECT_EQ(1, site.m);
+        EXPECT_TRUE(physics.initialize_fission(site, *p));
+    }
+
+    // the fission spectrum of a mixture is sampled from its fissionable
+    // constituents
+    EXPECT_TRUE(physics.initialize_fission(1, *p));
+    EXPECT_FALSE(physics.initialize_fission(0, *p));
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstPhysics.cc
 //---------------------------------------------------------------------------//
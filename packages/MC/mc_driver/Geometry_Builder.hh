@@ -12,6 +12,8 @@
 #define MC_mc_driver_Geometry_Builder_hh
 
 #include <memory>
+#include <map>
+#include <utility>
 #include <unordered_map>
 
 #include "geometry/RTK_Geometry.hh"
@@ -29,6 +31,32 @@ namespace mc
 /*!
  * \class Geometry_Builder
  * \brief Build profugus Geometry
+ *
+ * The RTK core builder shares radial objects (assemblies and pins) that have
+ * the same input id and height across all axial levels, so each unique
+ * radial object is stored once regardless of the number of axial levels that
+ * reference it.
+ *
+ * If the \c "extrude uniform levels" (bool) entry in the CORE block is true
+ * (default: false), consecutive axial levels with identical core maps are
+ * fused into a single extruded level whose height is the sum of the level
+ * heights.  Particles then cross no internal axial planes inside an
+ * axially-uniform segment; the axial distance in each pin-cell is a single
+ * division on the whole segment.  Note that this reduces the number of cells
+ * (tally regions) in the geometry to one per segment.
+ *
+ * If the PROBLEM block contains a \c "volume_db" sublist, the analytic RTK
+ * cell volumes (which do not account for vessel-bisected pin-cells) are
+ * replaced by stochastic estimates from profugus::Volume_Estimator.  The
+ * sublist takes \c "num_rays" (int, default 1000000), \c "seed" (int), and
+ * \c "cache" (string, default \c <problem_name>_volumes.h5).
+ *
+ * If the PROBLEM block contains a \c "compiled_geometry" (string) file name,
+ * the core is read from that compiled geometry file (see
+ * profugus::RTK_Geometry_File) when it exists and was built from the same
+ * input, skipping the XML blocks entirely; otherwise the core is built from
+ * XML and the file is (re)written.  The file stores a hash of the complete
+ * input parameter list, so editing the input invalidates it.
  */
 //===========================================================================//
 template <class Geometry>
@@ -82,7 +110,8 @@ class Geometry_Builder<profugus::Core>
     typedef Teuchos::TwoDArray<double>  TwoDArray_dbl;
 
     // General typedefs.
-    typedef std::unordered_map<int, SP_Lattice>  Lattice_Hash;
+    typedef std::pair<int, double>               Key;
+    typedef std::map<Key, int>                   Object_Index;
     typedef std::unordered_map<int, SP_Pin_Cell> Pin_Hash;
 
     RCP_ParameterList d_db;
@@ -90,7 +119,11 @@ class Geometry_Builder<profugus::Core>
     RCP_ParameterList d_assblydb;
     RCP_ParameterList d_pindb;
 
+    // Unique pins keyed on (input pin id, height).
+    std::map<Key, SP_Pin_Cell> d_pins;
+
     SP_Lattice build_axial_lattice(const TwoDArray_int &map, double height);
+    SP_Pin_Cell build_pin(int pid, double height);
 };
 
 // Specialization for Mesh_Geometry
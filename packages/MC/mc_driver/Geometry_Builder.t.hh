@@ -11,6 +11,14 @@
 #ifndef MC_mc_driver_Geometry_Builder_t_hh
 #define MC_mc_driver_Geometry_Builder_t_hh
 
+#include <sstream>
+
+#include "Teuchos_XMLParameterListHelpers.hpp"
+
+#include "comm/global.hh"
+
+#include "geometry/RTK_Geometry_File.hh"
+#include "geometry/Volume_Estimator.hh"
 #include "Geometry_Builder.hh"
 
 namespace mc
@@ -22,6 +30,35 @@ auto Geometry_Builder<profugus::Core>::build(
     // validate the parameter list
     INSIST(master->isSublist("PROBLEM"),
             "PROBLEM block not defined in input.");
+
+    // read the compiled geometry if it has already been written from the
+    // same input; the master decides and broadcasts so that every domain
+    // takes the same branch
+    std::string compiled;
+    profugus::RTK_Geometry_File::Signature signature = 0;
+    if (Teuchos::sublist(master, "PROBLEM")->isParameter("compiled_geometry"))
+    {
+        compiled = Teuchos::sublist(master, "PROBLEM")->get<std::string>(
+            "compiled_geometry");
+
+        int current = 0;
+        if (profugus::node() == 0)
+        {
+            std::ostringstream xml;
+            Teuchos::writeParameterListToXmlOStream(*master, xml);
+            signature = profugus::RTK_Geometry_File::hash(xml.str());
+
+            auto stored = profugus::RTK_Geometry_File().signature(compiled);
+            current = stored.first && stored.second == signature;
+        }
+        profugus::broadcast(&current, 1, 0);
+
+        if (current)
+        {
+            return profugus::RTK_Geometry_File().read(compiled);
+        }
+    }
+
     INSIST(master->isSublist("CORE"),
             "CORE block not defined in input.");
     INSIST(master->isSublist("ASSEMBLIES"),
@@ -42,42 +79,61 @@ auto Geometry_Builder<profugus::Core>::build(
     // get the axial list and heights
     const auto &axial_list   = d_coredb->get<OneDArray_str>("axial list");
     const auto &axial_height = d_coredb->get<OneDArray_dbl>("axial height");
+    CHECK(axial_height.size() == axial_list.size());
+
+    // fuse consecutive axial levels that have identical core maps into
+    // single extruded levels if requested
+    bool extrude = d_coredb->get("extrude uniform levels", false);
+
+    // core map names and heights of each (possibly fused) axial level
+    std::vector<std::string> level_map;
+    std::vector<double>      level_height;
+    for (int k = 0; k < axial_list.size(); ++k)
+    {
+        CHECK(d_coredb->isParameter(axial_list[k]));
+
+        if (extrude && !level_map.empty() &&
+            d_coredb->get<TwoDArray_int>(axial_list[k]) ==
+            d_coredb->get<TwoDArray_int>(level_map.back()))
+        {
+            level_height.back() += axial_height[k];
+        }
+        else
+        {
+            level_map.push_back(axial_list[k]);
+            level_height.push_back(axial_height[k]);
+        }
+    }
+    CHECK(level_map.size() == level_height.size());
 
     // build the core (all axial core maps have the same radial dimensions, so
-    // we can just use the first core map here) -> calculate the maximum
-    // number of objects we may have (most of these will probably not be
-    // needed)
-    const auto &base_map = d_coredb->get<TwoDArray_int>(axial_list[0]);
+    // we can just use the first core map here)
+    const auto &base_map = d_coredb->get<TwoDArray_int>(level_map[0]);
 
     // get the core dimensions (radially in assemblies, axially in levels);
     // remember the twoD arrays are entered [j][i] (i moves fastest in
     // COLUMN-MAJOR---FORTRAN---style, so it goes in the column index)
     int num_x     = base_map.getNumCols();
     int num_y     = base_map.getNumRows();
-    int num_axial = axial_list.size();
-    CHECK(axial_height.size() == num_axial);
+    int num_axial = level_map.size();
 
     // get the assembly list
     const auto &assbly_list = d_assblydb->get<OneDArray_str>("assembly list");
 
-    // make a hash of the assemblies that need to be built; we build unique
-    // assemblies on each *axial* level
-    std::vector<Lattice_Hash> assemblies(num_axial);
-    int                       aid = 0;
-
-    // map of assembly ids to rtk-ids on each axial level
-    std::vector<std::unordered_map<int, int>> a2rtk(num_axial);
+    // unique assemblies are built once for each (assembly id, height) pair
+    // and shared between all axial levels that reference them
+    std::vector<SP_Lattice> assemblies;
+    Object_Index            a2rtk;
+    int                     aid = 0;
 
-    // number of unique assemblies in core
-    int num_assemblies = 0;
+    // clear any pins from a previous build
+    d_pins.clear();
 
     // iterate through the core and build each assembly by axial level
     for (int k = 0; k < num_axial; ++k)
     {
-        CHECK(d_coredb->isParameter(axial_list[k]));
-
         // get the core map at this axial level
-        const auto &core_map = d_coredb->get<TwoDArray_int>(axial_list[k]);
+        const auto &core_map = d_coredb->get<TwoDArray_int>(level_map[k]);
         CHECK(core_map.getNumCols() == num_x);
         CHECK(core_map.getNumRows() == num_y);
 
@@ -92,67 +148,59 @@ auto Geometry_Builder<profugus::Core>::build(
                 CHECK(aid < assbly_list.size());
                 CHECK(d_assblydb->isParameter(assbly_list[aid]));
 
-                // get the assembly map for this lattice
-                const auto &assbly_map = d_assblydb->get<TwoDArray_int>(
-                    assbly_list[aid]);
-
                 // build the lattice if we have not added it already
-                if (!assemblies[k].count(aid))
+                Key key(aid, level_height[k]);
+                if (!a2rtk.count(key))
                 {
-                    SP_Lattice lattice = build_axial_lattice(
-                        assbly_map, axial_height[k]);
-
-                    // add it to the hash table
-                    assemblies[k].emplace(aid, lattice);
+                    // get the assembly map for this lattice
+                    const auto &assbly_map = d_assblydb->get<TwoDArray_int>(
+                        assbly_list[aid]);
 
                     // map the assembly id to rtk id
-                    a2rtk[k].emplace(aid, assemblies[k].size() - 1);
+                    a2rtk.emplace(key, assemblies.size());
+
+                    // add it to the list of unique assemblies
+                    assemblies.push_back(
+                        build_axial_lattice(assbly_map, level_height[k]));
                 }
 
-                CHECK(assemblies[k].count(aid));
+                CHECK(a2rtk.count(key));
             }
         }
-        CHECK(assemblies[k].size() == a2rtk[k].size());
-
-        // add up the number of unique assemblies (on each axial level)
-        num_assemblies += assemblies[k].size();
     }
+    CHECK(assemblies.size() == a2rtk.size());
+
+    // number of unique assemblies in core
+    int num_assemblies = assemblies.size();
 
     // make the core
     SP_Core core(std::make_shared<Core_t>(
                      num_x, num_y, num_axial, num_assemblies));
 
-    // now add the assemblies to the core
-    int axial_offset = 0;
-    for (int k = 0; k < num_axial; ++k)
+    // assign the assemblies
+    for (int n = 0; n < num_assemblies; ++n)
     {
-        // assign the assemblies
-        for (const auto &a : assemblies[k])
-        {
-            CHECK(a.second);
-            CHECK(a2rtk[k][a.first] + axial_offset >= 0 &&
-                   a2rtk[k][a.first] + axial_offset < num_assemblies);
-            core->assign_object(a.second, a2rtk[k][a.first] + axial_offset);
-        }
+        CHECK(assemblies[n]);
+        core->assign_object(assemblies[n], n);
+    }
 
+    // now add the assembly ids to the core
+    for (int k = 0; k < num_axial; ++k)
+    {
         // get the core map at this axial level
-        const auto &map = d_coredb->get<TwoDArray_int>(axial_list[k]);
+        const auto &map = d_coredb->get<TwoDArray_int>(level_map[k]);
 
-        // assign the RTK pin ids to the core
+        // assign the RTK assembly ids to the core
         for (int j = 0; j < num_y; ++j)
         {
             for (int i = 0; i < num_x; ++i)
             {
-                CHECK(a2rtk[k][map(j, i)] + axial_offset >= 0 &&
-                       a2rtk[k][map(j, i)] + axial_offset < num_assemblies);
-                core->id(i, j, k) = a2rtk[k][map(j, i)] + axial_offset;
+                Key key(map(j, i), level_height[k]);
+                CHECK(a2rtk[key] >= 0 && a2rtk[key] < num_assemblies);
+                core->id(i, j, k) = a2rtk[key];
             }
         }
-
-        // update the axial offset
-        axial_offset += assemblies[k].size();
     }
-    CHECK(axial_offset == num_assemblies);
 
     // set the boundary conditions
     def::Vec_Int boundary(6, 0);
@@ -170,7 +218,31 @@ auto Geometry_Builder<profugus::Core>::build(
     core->complete(0.0, 0.0, 0.0);
 
     // make the geometry
-    return std::make_shared<Geom_t>(core);
+    auto geometry = std::make_shared<Geom_t>(core);
+
+    // replace the analytic volumes with stochastic estimates
+    if (d_db->isSublist("volume_db"))
+    {
+        auto &vdb = d_db->sublist("volume_db");
+
+        std::string cache = vdb.get(
+            "cache", d_db->get("problem_name", std::string("MC")) +
+            "_volumes.h5");
+
+        profugus::Volume_Estimator<Geom_t> estimator(geometry);
+        estimator.calc_volumes(vdb.get("num_rays", 1000000), cache,
+                               vdb.get("seed", 5417));
+        geometry->set_cell_volumes(estimator.volumes());
+    }
+
+    // write the compiled geometry for subsequent runs (only the signature
+    // on the master is used)
+    if (!compiled.empty())
+    {
+        profugus::RTK_Geometry_File().write(*geometry, compiled, signature);
+    }
+
+    return geometry;
 }
 
 auto Geometry_Builder<profugus::Core>::build_axial_lattice(
@@ -207,37 +279,15 @@ auto Geometry_Builder<profugus::Core>::build_axial_lattice(
             // build the pin if we haven't already
             if (!pins.count(pid))
             {
-                // get the pin-sublist
-                const auto &pindb = d_pindb->sublist(pin_list[pid]);
-                CHECK(pindb.isParameter("pitch"));
-                CHECK(pindb.isParameter("matid"));
-
-                // get the pin pitch and overall pin matid
-                double pitch  = pindb.get<double>("pitch");
-                int pin_matid = pindb.get<int>("matid");
-
-                // make empty inner cylinders
-                Pin_Cell_t::Vec_Dbl r;
-                Pin_Cell_t::Vec_Int ids;
-
-                // see if the pin has any internal cylinders
-                if (pindb.isParameter("radii"))
+                // use the pin built for another assembly at this height if
+                // it exists
+                Key key(pid, height);
+                if (!d_pins.count(key))
                 {
-                    CHECK(pindb.isParameter("radial matids"));
-                    const auto &radii  = pindb.get<OneDArray_dbl>("radii");
-                    const auto &matids = pindb.get<OneDArray_int>(
-                        "radial matids");
-
-                    r.insert(r.end(), radii.begin(), radii.end());
-                    ids.insert(ids.end(), matids.begin(), matids.end());
-
-                    CHECK(r.size() == radii.size());
-                    CHECK(ids.size() == matids.size());
+                    d_pins.emplace(key, build_pin(pid, height));
                 }
-
-                // build the pin
-                SP_Pin_Cell pin(std::make_shared<Pin_Cell_t>(
-                                    ids, r, pin_matid, pitch, height));
+                SP_Pin_Cell pin = d_pins[key];
+                CHECK(pin);
 
                 // add it
                 pins.emplace(pid, pin);
@@ -277,6 +327,48 @@ auto Geometry_Builder<profugus::Core>::build_axial_lattice(
     return lattice;
 }
 
+auto Geometry_Builder<profugus::Core>::build_pin(
+        int    pid,
+        double height) -> SP_Pin_Cell
+{
+    REQUIRE(d_pindb->isParameter("pin list"));
+
+    // get the pin list from the pindb
+    const auto &pin_list = d_pindb->get<OneDArray_str>("pin list");
+    CHECK(pid < pin_list.size());
+    CHECK(d_pindb->isSublist(pin_list[pid]));
+
+    // get the pin-sublist
+    const auto &pindb = d_pindb->sublist(pin_list[pid]);
+    CHECK(pindb.isParameter("pitch"));
+    CHECK(pindb.isParameter("matid"));
+
+    // get the pin pitch and overall pin matid
+    double pitch  = pindb.get<double>("pitch");
+    int pin_matid = pindb.get<int>("matid");
+
+    // make empty inner cylinders
+    Pin_Cell_t::Vec_Dbl r;
+    Pin_Cell_t::Vec_Int ids;
+
+    // see if the pin has any internal cylinders
+    if (pindb.isParameter("radii"))
+    {
+        CHECK(pindb.isParameter("radial matids"));
+        const auto &radii  = pindb.get<OneDArray_dbl>("radii");
+        const auto &matids = pindb.get<OneDArray_int>("radial matids");
+
+        r.insert(r.end(), radii.begin(), radii.end());
+        ids.insert(ids.end(), matids.begin(), matids.end());
+
+        CHECK(r.size() == radii.size());
+        CHECK(ids.size() == matids.size());
+    }
+
+    // build the pin
+    return std::make_shared<Pin_Cell_t>(ids, r, pin_matid, pitch, height);
+}
+
 auto Geometry_Builder<profugus::Mesh_Geometry>::build(
     RCP_ParameterList master) -> SP_Geometry
 {
@@ -90,6 +90,9 @@ class Manager : public Manager_Base
     // Output.
     void output();
 
+    // Release node-shared memory (collective).
+    void release();
+
   private:
     // >>> IMPLEMENTATION
 
@@ -97,6 +100,9 @@ class Manager : public Manager_Base
     template<class T>
     void build_anderson(SP_Transporter transporter, SP_Fission_Source source);
 
+    // Plot the geometry.
+    void plot_geometry(RCP_ParameterList db);
+
     // Processor.
     int d_node, d_nodes;
 
@@ -22,6 +22,8 @@
 #include "utils/Serial_HDF5_Writer.hh"
 #include "utils/Parallel_HDF5_Writer.hh"
 #include "solvers/LinAlgTypedefs.hh"
+#include "geometry/Geometry_Plotter.hh"
+#include "geometry/Volume_Estimator.hh"
 #include "mc/Fission_Source.hh"
 #include "mc/KDE_Fission_Source.hh"
 #include "mc/Uniform_Source.hh"
@@ -54,6 +56,84 @@ void Manager<Geometry>::build_anderson(SP_Transporter    transporter,
     d_keff_solver = anderson;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Plot the geometry and (optionally) estimate cell volumes.
+ *
+ * The following entries in the \c plot_geometry sublist are used:
+ * - \c type ("slice" or "voxels", default "slice")
+ * - \c axis (string, normal of the slice plane: "x", "y" or "z", default
+ *   "z")
+ * - \c intercept (double, location of the slice plane, default midplane)
+ * - \c num_pixels (Array<int> of size 2, default {512, 512})
+ * - \c num_voxels (Array<int> of size 3, default {64, 64, 64})
+ * - \c volume_rays (int, rays used to estimate the cell volumes with
+ *   Volume_Estimator, default 0 for no volumes)
+ *
+ * The output is written to \c <problem_name>_plot.h5.
+ */
+template <class Geometry>
+void Manager<Geometry>::plot_geometry(RCP_ParameterList db)
+{
+    using def::X; using def::Y; using def::Z;
+
+    SCOPED_TIMER("Manager.plot_geometry");
+
+    typedef profugus::Geometry_Plotter<Geom_t> Plotter;
+    typedef typename Plotter::Space_Vector     Space_Vector;
+    typedef Teuchos::Array<int>                OneDArray_int;
+
+    Plotter plotter(d_geometry);
+
+    // extents of the geometry
+    auto box = d_geometry->get_extents();
+    const Space_Vector &lower = box.lower();
+    const Space_Vector &upper = box.upper();
+
+    auto type = db->get("type", std::string("slice"));
+    VALIDATE(type == "slice" || type == "voxels",
+             "Invalid plot type " << type);
+
+    if (type == "slice")
+    {
+        // normal axis of the plane and the in-plane axes
+        auto axis = db->get("axis", std::string("z"));
+        VALIDATE(axis == "x" || axis == "y" || axis == "z",
+                 "Invalid slice axis " << axis);
+        int n = axis == "x" ? X : (axis == "y" ? Y : Z);
+        int a = n == X ? Y : X;
+        int b = n == Z ? Y : Z;
+
+        auto pixels = db->get("num_pixels", OneDArray_int(2, 512));
+        VALIDATE(pixels.size() == 2, "num_pixels must have 2 entries");
+
+        Space_Vector corner(lower), u(0.0, 0.0, 0.0), v(0.0, 0.0, 0.0);
+        corner[n] = db->get("intercept", 0.5 * (lower[n] + upper[n]));
+        u[a]      = upper[a] - lower[a];
+        v[b]      = upper[b] - lower[b];
+
+        plotter.slice(corner, u, v, pixels[0], pixels[1]);
+    }
+    else
+    {
+        auto voxels = db->get("num_voxels", OneDArray_int(3, 64));
+        VALIDATE(voxels.size() == 3, "num_voxels must have 3 entries");
+
+        plotter.voxelize(box, voxels[0], voxels[1], voxels[2]);
+    }
+
+    // estimate volumes
+    int rays = db->get("volume_rays", 0);
+    if (rays > 0)
+    {
+        profugus::Volume_Estimator<Geom_t> estimator(d_geometry);
+        estimator.calc_volumes(rays);
+        plotter.set_volumes(estimator.volumes(), estimator.errors());
+    }
+
+    plotter.write(d_problem_name + "_plot.h5");
+}
+
 //---------------------------------------------------------------------------//
 // CONSTRUCTOR
 //---------------------------------------------------------------------------//
@@ -114,6 +194,12 @@ void Manager<Geometry>::setup(RCP_ParameterList master)
         }
     }
 
+    // plot the geometry
+    if (d_db->isSublist("plot_geometry"))
+    {
+        plot_geometry(Teuchos::sublist(d_db, "plot_geometry"));
+    }
+
     // get the variance reduction
     auto var_reduction = builder.get_var_reduction();
     CHECK(var_reduction);
@@ -332,6 +418,22 @@ void Manager<Geometry>::output()
 #endif // USE_HDF5
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Release node-shared memory.
+ *
+ * This call is collective and must be made before the manager is destroyed
+ * when the cross sections are shared ("shared_xs").
+ */
+template <class Geometry>
+void Manager<Geometry>::release()
+{
+    if (d_physics)
+    {
+        d_physics->free_shared();
+    }
+}
+
 } // end namespace mc
 
 #endif // MC_mc_driver_Manager_t_hh
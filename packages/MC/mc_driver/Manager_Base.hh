@@ -44,6 +44,9 @@ class Manager_Base
 
       // Output data.
       virtual void output() = 0;
+
+      // Release collective resources before profugus::finalize().
+      virtual void release() {}
 };
 
 } // end namespace mc
@@ -173,6 +173,13 @@ void Problem_Builder<Geometry>::build_physics()
     CHECK(xs->num_mat() == matids.size());
     CHECK(xs->num_groups() == 1 + (g_last - g_first));
 
+    // optionally hold a single copy of the cross sections on each
+    // shared-memory node
+    if (d_db->get("shared_xs", false))
+    {
+        xs->share();
+    }
+
     // make the physics
     d_physics = std::make_shared<Physics_t>(d_db, xs);
 
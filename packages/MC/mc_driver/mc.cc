@@ -119,6 +119,9 @@ int main(int argc, char *argv[])
 
         // output
         manager->output();
+
+        // release node-shared memory while all domains are still here
+        manager->release();
     }
     catch (const profugus::assertion &a)
     {
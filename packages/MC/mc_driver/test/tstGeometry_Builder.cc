@@ -0,0 +1,254 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc_driver/test/tstGeometry_Builder.cc
+ * \author agent
+ * \date   Mon Oct 19 05:08:22 2026
+ * \brief  Geometry_Builder unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <string>
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_TwoDArray.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "gtest/utils_gtest.hh"
+
+#include "../Geometry_Builder.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+class Geometry_BuilderTest : public ::testing::Test
+{
+  protected:
+    typedef mc::Geometry_Builder<profugus::Core> Builder;
+    typedef Builder::SP_Geometry                 SP_Geometry;
+    typedef Builder::RCP_ParameterList           RCP_ParameterList;
+    typedef profugus::Core::Array_t              Core_t;
+    typedef Core_t::Object_t                     Lattice_t;
+    typedef Lattice_t::Object_t                  Pin_Cell_t;
+    typedef Teuchos::Array<std::string>          OneDArray_str;
+    typedef Teuchos::Array<double>               OneDArray_dbl;
+    typedef Teuchos::Array<int>                  OneDArray_int;
+    typedef Teuchos::TwoDArray<int>              TwoDArray_int;
+
+  protected:
+    // 2x2 core of 2x2 assemblies with 4 axial levels; the first 3 levels
+    // have the same core map, and level 2 is shorter than the others
+    void SetUp()
+    {
+        master = Teuchos::rcp(new Teuchos::ParameterList("test"));
+
+        auto &problem = master->sublist("PROBLEM");
+        problem.set("boundary", std::string("vacuum"));
+
+        // 2 fuel pins and a water pin
+        auto &pins = master->sublist("PINS");
+        OneDArray_str pin_list(3);
+        pin_list[0] = "fuel1";
+        pin_list[1] = "fuel2";
+        pin_list[2] = "water";
+        pins.set("pin list", pin_list);
+        {
+            auto &p = pins.sublist("fuel1");
+            p.set("pitch", 1.26);
+            p.set("matid", 2);
+            p.set("radii", OneDArray_dbl(1, 0.54));
+            p.set("radial matids", OneDArray_int(1, 0));
+        }
+        {
+            auto &p = pins.sublist("fuel2");
+            p.set("pitch", 1.26);
+            p.set("matid", 2);
+            p.set("radii", OneDArray_dbl(1, 0.54));
+            p.set("radial matids", OneDArray_int(1, 1));
+        }
+        {
+            auto &p = pins.sublist("water");
+            p.set("pitch", 1.26);
+            p.set("matid", 2);
+        }
+
+        // assembly A has pins 0 and 1, assembly B has pins 0 and 2 (pin 0
+        // is shared between the assemblies)
+        auto &assemblies = master->sublist("ASSEMBLIES");
+        OneDArray_str assbly_list(2);
+        assbly_list[0] = "A";
+        assbly_list[1] = "B";
+        assemblies.set("assembly list", assbly_list);
+        {
+            TwoDArray_int a(2, 2, 0);
+            a(0, 1) = 1;
+            a(1, 0) = 1;
+            assemblies.set("A", a);
+
+            TwoDArray_int b(2, 2, 0);
+            b(0, 1) = 2;
+            b(1, 0) = 2;
+            assemblies.set("B", b);
+        }
+
+        // core maps
+        auto &core = master->sublist("CORE");
+        {
+            TwoDArray_int c0(2, 2, 0);
+            c0(0, 1) = 1;
+            c0(1, 0) = 1;
+
+            TwoDArray_int c1(2, 2, 1);
+
+            core.set("core_0", c0);
+            core.set("core_1", c1);
+        }
+        OneDArray_str axial_list(4, "core_0");
+        axial_list[3] = "core_1";
+        core.set("axial list", axial_list);
+
+        OneDArray_dbl axial_height(4, 10.0);
+        axial_height[2] = 5.0;
+        core.set("axial height", axial_height);
+    }
+
+    const Core_t& build()
+    {
+        geometry = builder.build(master);
+        EXPECT_TRUE(static_cast<bool>(geometry));
+        return geometry->array();
+    }
+
+  protected:
+    RCP_ParameterList master;
+    Builder           builder;
+    SP_Geometry       geometry;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_BuilderTest, Shared_Objects)
+{
+    const Core_t &core = build();
+
+    EXPECT_EQ(2, core.size(0));
+    EXPECT_EQ(2, core.size(1));
+    EXPECT_EQ(4, core.size(2));
+    EXPECT_SOFTEQ(35.0, core.height(), 1.0e-12);
+
+    // one assembly per unique (assembly id, height): (A,10), (B,10), (A,5),
+    // (B,5)
+    EXPECT_EQ(4, core.num_objects());
+
+    // levels 0 and 1 have the same map and height, so they share the
+    // assemblies
+    for (int j = 0; j < 2; ++j)
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            EXPECT_EQ(core.id(i, j, 0), core.id(i, j, 1));
+            EXPECT_EQ(&core.object(i, j, 0), &core.object(i, j, 1));
+        }
+    }
+
+    // level 2 has the same map but a different height, so it has its own
+    // assemblies
+    EXPECT_NE(core.id(0, 0, 0), core.id(0, 0, 2));
+    EXPECT_NE(core.id(1, 0, 0), core.id(1, 0, 2));
+    EXPECT_SOFTEQ(10.0, core.object(0, 0, 0).height(), 1.0e-12);
+    EXPECT_SOFTEQ(5.0, core.object(0, 0, 2).height(), 1.0e-12);
+
+    // B on level 3 is the (B,10) assembly of level 0
+    EXPECT_EQ(core.id(1, 0, 0), core.id(0, 0, 3));
+    EXPECT_EQ(core.id(1, 0, 0), core.id(1, 1, 3));
+
+    // pin 0 is shared between assemblies A and B at the same height
+    const Lattice_t &a10 = core.object(0, 0, 0);
+    const Lattice_t &b10 = core.object(1, 0, 0);
+    const Lattice_t &a5  = core.object(0, 0, 2);
+    const Lattice_t &b5  = core.object(1, 0, 2);
+    EXPECT_EQ(&a10.object(0, 0, 0), &b10.object(0, 0, 0));
+    EXPECT_EQ(&a5.object(0, 0, 0), &b5.object(0, 0, 0));
+
+    // but not between heights
+    EXPECT_NE(&a10.object(0, 0, 0), &a5.object(0, 0, 0));
+    EXPECT_SOFTEQ(10.0, a10.object(0, 0, 0).height(), 1.0e-12);
+    EXPECT_SOFTEQ(5.0, a5.object(0, 0, 0).height(), 1.0e-12);
+
+    // the other pins are distinct
+    EXPECT_NE(&a10.object(1, 0, 0), &b10.object(1, 0, 0));
+    EXPECT_EQ(2, a10.num_objects());
+    EXPECT_EQ(2, b10.num_objects());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_BuilderTest, Extrude_Uniform_Levels)
+{
+    master->sublist("CORE").set("extrude uniform levels", true);
+
+    const Core_t &core = build();
+
+    // levels 0-2 are fused into a single 25 cm level
+    EXPECT_EQ(2, core.size(0));
+    EXPECT_EQ(2, core.size(1));
+    EXPECT_EQ(2, core.size(2));
+    EXPECT_SOFTEQ(35.0, core.height(), 1.0e-12);
+
+    // unique assemblies: (A,25), (B,25), (B,10)
+    EXPECT_EQ(3, core.num_objects());
+
+    for (int j = 0; j < 2; ++j)
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            EXPECT_SOFTEQ(25.0, core.object(i, j, 0).height(), 1.0e-12);
+            EXPECT_SOFTEQ(10.0, core.object(i, j, 1).height(), 1.0e-12);
+
+            // the pins in each assembly have the level height
+            const Lattice_t &lat = core.object(i, j, 0);
+            EXPECT_SOFTEQ(25.0, lat.object(0, 0, 0).height(), 1.0e-12);
+            EXPECT_SOFTEQ(25.0, lat.object(1, 0, 0).height(), 1.0e-12);
+        }
+    }
+
+    // assembly layout of each fused level
+    EXPECT_NE(core.id(0, 0, 0), core.id(1, 0, 0));
+    EXPECT_EQ(core.id(0, 0, 0), core.id(1, 1, 0));
+    EXPECT_NE(core.id(1, 0, 0), core.id(0, 0, 1));
+    EXPECT_EQ(core.id(0, 0, 1), core.id(1, 1, 1));
+
+    // pin 0 is shared between A and B in the fused level
+    EXPECT_EQ(&core.object(0, 0, 0).object(0, 0, 0),
+              &core.object(1, 0, 0).object(0, 0, 0));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Geometry_BuilderTest, Extrude_Distinct_Maps)
+{
+    // no consecutive levels with the same map: nothing is fused
+    auto &core_db = master->sublist("CORE");
+    core_db.set("extrude uniform levels", true);
+    OneDArray_str axial_list(4, "core_0");
+    axial_list[1] = "core_1";
+    axial_list[3] = "core_1";
+    core_db.set("axial list", axial_list);
+
+    const Core_t &core = build();
+
+    EXPECT_EQ(4, core.size(2));
+    EXPECT_SOFTEQ(35.0, core.height(), 1.0e-12);
+
+    // (A,10), (B,10), (A,5), (B,5); the core_1 levels share (B,10)
+    EXPECT_EQ(4, core.num_objects());
+    EXPECT_EQ(core.id(0, 0, 1), core.id(0, 0, 3));
+    EXPECT_EQ(&core.object(0, 0, 1), &core.object(0, 0, 3));
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstGeometry_Builder.cc
+//---------------------------------------------------------------------------//
@@ -9,29 +9,125 @@
 //---------------------------------------------------------------------------//
 
 #include <numeric>
+#include <string>
+#include <vector>
+
 #include "Energy_Collapse.hh"
 
 namespace profugus
 {
 
+//---------------------------------------------------------------------------//
+// UNNAMED NAMESPACE
+//---------------------------------------------------------------------------//
+
+namespace
+{
+
+// Make a cache key from the fine cross sections, group map, and weights.
+std::string make_key(const XS                       &xs,
+                     const Energy_Collapse::Vec_Int &collapse_vec,
+                     const Energy_Collapse::Vec_Dbl &weights)
+{
+    const XS *address = &xs;
+
+    std::string key;
+    key.append(reinterpret_cast<const char *>(&address), sizeof(address));
+    key.append(reinterpret_cast<const char *>(collapse_vec.data()),
+               collapse_vec.size() * sizeof(int));
+    key.append(reinterpret_cast<const char *>(weights.data()),
+               weights.size() * sizeof(double));
+    return key;
+}
+
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
 //---------------------------------------------------------------------------//
 /*!
  * \brief Collapse material database from fine to coarse.
+ *
+ * Each coarse scattering matrix is \f$ R\,S\,W \f$ normalized by the sum of
+ * the weights in each coarse group, where \e S is the fine matrix, \e R
+ * sums fine groups into coarse groups, and \e W weights the fine groups in
+ * each coarse group.  The
+ * products are dense (BLAS) matrix multiplies and the materials are
+ * collapsed in parallel over threads.
+ *
+ * If a cache is given, collapsing the same fine cross sections with the
+ * same group map and weights returns the previously collapsed cross
+ * sections.
  */
 Energy_Collapse::RCP_Mat_DB Energy_Collapse::collapse_all_mats(
     RCP_Mat_DB     fine_mat,
     const Vec_Int &collapse_vec,
-    const Vec_Dbl &weights)
+    const Vec_Dbl &weights,
+    RCP_Cache      cache)
 {
-    typedef Vec_Int::const_iterator mat_iter;
-    typedef Mat_DB_t::XS_t          XS;
-
     REQUIRE( fine_mat->xs().num_groups() == weights.size() );
     REQUIRE( fine_mat->xs().num_groups() ==
              std::accumulate(collapse_vec.begin(),collapse_vec.end(),0) );
     REQUIRE( fine_mat->xs().num_groups() >= 2 );
 
-    int fine_grps   = fine_mat->xs().num_groups();
+    Mat_DB_t::RCP_XS xsc;
+
+    // look for previously collapsed cross sections
+    std::string key;
+    if (!cache.is_null())
+    {
+        key = make_key(fine_mat->xs(), collapse_vec, weights);
+        Cached_XS *cached = cache->find(key);
+        if (cached && cached->fine.is_valid_ptr() &&
+            cached->fine.get() == &fine_mat->xs())
+        {
+            xsc = cached->coarse;
+        }
+    }
+
+    // otherwise collapse the cross sections
+    if (xsc.is_null())
+    {
+        xsc = collapse_xs(fine_mat->xs(), collapse_vec, weights);
+
+        if (!cache.is_null())
+        {
+            Cached_XS cached = {fine_mat->get_xs().create_weak(), xsc};
+            if (Cached_XS *stale = cache->find(key))
+                *stale = cached;
+            else
+                cache->insert(key, cached);
+        }
+    }
+    CHECK(!xsc.is_null());
+
+    // make the coarse mat-db
+    RCP_Mat_DB coarse_mat = Teuchos::rcp(new Mat_DB_t);
+    coarse_mat->set(xsc, fine_mat->num_cells());
+
+    // Assign matids to cells
+    for (int cell = 0, Nc = fine_mat->num_cells(); cell < Nc; ++cell)
+    {
+        coarse_mat->matid(cell) = fine_mat->matid(cell);
+    }
+
+    return coarse_mat;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Collapse the cross sections.
+ */
+Energy_Collapse::RCP_XS Energy_Collapse::collapse_xs(
+    const XS_t    &xs,
+    const Vec_Int &collapse_vec,
+    const Vec_Dbl &weights)
+{
+    typedef XS_t::Matrix Matrix;
+
+    int fine_grps   = xs.num_groups();
     int coarse_grps = collapse_vec.size();
 
     // Get starting fine group indices for each coarse group
@@ -43,108 +139,107 @@ Energy_Collapse::RCP_Mat_DB Energy_Collapse::collapse_all_mats(
                          start_ind.begin()+1);
     }
 
-    // get the cross sections from the fine_mat
-    const XS &xs = fine_mat->xs();
+    // build the restriction (R) and weighting (W) operators and the sum of
+    // the weights in each coarse group
+    Matrix  R(coarse_grps, fine_grps, true);
+    Matrix  W(fine_grps, coarse_grps, true);
+    Vec_Dbl g_sum(coarse_grps, 0.0);
+    for (int gc = 0; gc < coarse_grps; ++gc)
+    {
+        // Get fine first and last for this coarse
+        int g_first = start_ind[gc];
+        int g_last  = g_first + collapse_vec[gc];
+
+        for (int gf = g_first; gf < g_last; ++gf)
+        {
+            R(gc, gf)  = 1.0;
+            W(gf, gc)  = weights[gf];
+            g_sum[gc] += weights[gf];
+        }
+        CHECK(g_sum[gc] > 0.0);
+    }
 
     // get the matids in the database
     Vec_Int matids;
     xs.get_matids(matids);
-
-    // material id
-    int m = 0;
+    int Nm = matids.size();
 
     // pn order
     int pn_order = xs.pn_order();
+    int Nn       = pn_order + 1;
 
-    // create coarse group cross sections
-    Mat_DB_t::RCP_XS xsc = Teuchos::rcp(new XS);
-    xsc->set(pn_order, coarse_grps);
-
-    // coarse group totals
-    XS::OneDArray totc(coarse_grps, 0.0);
-    XS::TwoDArray sctc(coarse_grps, coarse_grps, 0.0);
+    // coarse group totals and scattering for each material
+    std::vector<XS_t::OneDArray> totc(Nm);
+    std::vector<XS_t::TwoDArray> sctc(Nm * Nn);
 
     // Process each material in original
-    for (mat_iter mitr = matids.begin(); mitr != matids.end(); ++mitr)
+#pragma omp parallel
     {
-        // set the material id
-        m = *mitr;
-
-        // get the total cross sections for the fine group
-        const XS::Vector &totf = xs.vector(m, XS::TOTAL);
+        // work matrices
+        Matrix SW(fine_grps, coarse_grps);
+        Matrix RSW(coarse_grps, coarse_grps);
 
-        // loop over coarse groups
-        for (int gc = 0; gc < coarse_grps; ++gc)
+#pragma omp for schedule(dynamic)
+        for (int n = 0; n < Nm; ++n)
         {
-            // Get fine first and last for this coarse
-            int g_first = start_ind[gc];
-            int g_last  = g_first + collapse_vec[gc];
-
-            // Process total cross section
-            double sigma = 0.0;
-            double g_sum = 0.0;
-            for (int gf = g_first; gf < g_last; ++gf)
-            {
-                sigma += totf[gf] * weights[gf];
-                g_sum += weights[gf];
-            }
-            sigma    /= g_sum;
-            totc[gc]  = sigma;
-        }
+            int m = matids[n];
 
-        // add the coarse total cross sections
-        xsc->add(m, XS::TOTAL, totc);
-
-        // add the scattering cross sections
-        for (int l = 0; l <= pn_order; ++l)
-        {
-            // get the scattering cross section for the fine group
-            const XS::Matrix &sctf = xs.matrix(m, l);
+            // coarse total cross sections
+            const XS_t::Vector &totf = xs.vector(m, XS_t::TOTAL);
 
+            totc[n].assign(coarse_grps, 0.0);
             for (int gc = 0; gc < coarse_grps; ++gc)
             {
-                // Get fine first and last for this coarse
                 int g_first = start_ind[gc];
                 int g_last  = g_first + collapse_vec[gc];
+                for (int gf = g_first; gf < g_last; ++gf)
+                {
+                    totc[n][gc] += totf[gf] * weights[gf];
+                }
+                totc[n][gc] /= g_sum[gc];
+            }
 
-                for (int gpc = 0; gpc < coarse_grps; ++gpc)
+            // coarse scattering cross sections (R S W)
+            for (int l = 0; l < Nn; ++l)
+            {
+                const Matrix &sctf = xs.matrix(m, l);
+
+                SW.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0,
+                            sctf, W, 0.0);
+                RSW.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0,
+                             R, SW, 0.0);
+
+                XS_t::TwoDArray &s = sctc[n * Nn + l];
+                s.resizeRows(coarse_grps);
+                s.resizeCols(coarse_grps);
+                for (int gc = 0; gc < coarse_grps; ++gc)
                 {
-                    int gp_first  = start_ind[gpc];
-                    int gp_last   = gp_first + collapse_vec[gpc];
-                    double sig_s  = 0.0;
-                    double gp_sum = 0.0;
-                    for (int gpf = gp_first; gpf < gp_last; ++gpf)
+                    for (int gpc = 0; gpc < coarse_grps; ++gpc)
                     {
-                        gp_sum += weights[gpf];
-                        for (int gf = g_first; gf < g_last; ++gf)
-                        {
-                            sig_s += sctf(gf, gpf) * weights[gpf];
-                        }
+                        s(gc, gpc) = RSW(gc, gpc) / g_sum[gpc];
                     }
-                    sig_s         /= gp_sum;
-                    sctc(gc, gpc)  = sig_s;
                 }
             }
-
-            // add the coarse scattering cross sections
-            xsc->add(m, l, sctc);
         }
     }
 
-    // complete the coarse cross sections
-    xsc->complete();
-
-    // make the coarse mat-db
-    RCP_Mat_DB coarse_mat = Teuchos::rcp(new Mat_DB_t);
-    coarse_mat->set(xsc, fine_mat->num_cells());
+    // create coarse group cross sections
+    RCP_XS xsc = Teuchos::rcp(new XS_t);
+    xsc->set(pn_order, coarse_grps);
 
-    // Assign matids to cells
-    for (int cell = 0, Nc = fine_mat->num_cells(); cell < Nc; ++cell)
+    for (int n = 0; n < Nm; ++n)
     {
-        coarse_mat->matid(cell) = fine_mat->matid(cell);
+        xsc->add(matids[n], XS_t::TOTAL, totc[n]);
+        for (int l = 0; l < Nn; ++l)
+        {
+            xsc->add(matids[n], l, sctc[n * Nn + l]);
+        }
     }
 
-    return coarse_mat;
+    // complete the coarse cross sections
+    xsc->complete();
+
+    return xsc;
 }
 
 } // end namespace profugus
@@ -11,9 +11,12 @@
 #ifndef Matprop_xs_Energy_Collapse_hh
 #define Matprop_xs_Energy_Collapse_hh
 
+#include <string>
+
 #include "Teuchos_RCP.hpp"
 
 #include "utils/Definitions.hh"
+#include "utils/LRU_Cache.hh"
 #include "Mat_DB.hh"
 
 namespace profugus
@@ -27,6 +30,11 @@ namespace profugus
  * Create a Mat_DB from an existing Mat_DB with a collapsed energy group
  * structure.
  *
+ * Collapsed cross sections can optionally be cached in a Cache supplied by
+ * the caller; the cache is keyed on the fine cross sections, the group map,
+ * and the weighting spectrum.  There is no process-wide cache, and a Cache
+ * must not be used by more than one thread at a time.
+ *
  * \sa Energy_Collapse.cc for detailed descriptions.
  */
 /*!
@@ -43,10 +51,28 @@ class Energy_Collapse
     //! Typedefs.
     typedef Mat_DB                 Mat_DB_t;
     typedef Teuchos::RCP<Mat_DB_t> RCP_Mat_DB;
+    typedef Mat_DB_t::XS_t         XS_t;
+    typedef Mat_DB_t::RCP_XS       RCP_XS;
     typedef def::Vec_Int           Vec_Int;
     typedef def::Vec_Dbl           Vec_Dbl;
     //@}
 
+    //! Cached coarse cross sections.
+    struct Cached_XS
+    {
+        // Fine cross sections (weak, used to detect reuse of the address).
+        Teuchos::RCP<const XS_t> fine;
+
+        // Collapsed cross sections.
+        RCP_XS coarse;
+    };
+
+    //@{
+    //! Cache of collapsed cross sections.
+    typedef LRU_Cache<std::string, Cached_XS> Cache;
+    typedef Teuchos::RCP<Cache>               RCP_Cache;
+    //@}
+
   private:
     // Prevent construction
     Energy_Collapse() { /* * */ }
@@ -54,7 +80,13 @@ class Energy_Collapse
   public:
     static RCP_Mat_DB collapse_all_mats(RCP_Mat_DB     fine_mat,
                                         const Vec_Int &collapse_vec,
-                                        const Vec_Dbl &weights);
+                                        const Vec_Dbl &weights,
+                                        RCP_Cache      cache = Teuchos::null);
+
+  private:
+    // Collapse the cross sections.
+    static RCP_XS collapse_xs(const XS_t &xs, const Vec_Int &collapse_vec,
+                              const Vec_Dbl &weights);
 };
 
 } // end namespace profugus
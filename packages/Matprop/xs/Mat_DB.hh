@@ -84,6 +84,9 @@ class Mat_DB
     //! Get the cross section database.
     const XS_t& xs() const { REQUIRE(!d_xs.is_null()); return *d_xs; }
 
+    //! Get the cross section database RCP.
+    RCP_XS get_xs() const { return d_xs; }
+
     //! Get the matids.
     const Vec_Int& matids() const { return d_matids; }
 
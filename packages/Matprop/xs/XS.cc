@@ -39,7 +39,8 @@ XS::XS()
  *
  * \param num_groups number of energy groups
  *
- * All existing data is cleared in this call.
+ * All existing data is cleared in this call; if the data is shared this
+ * call is collective.
  */
 void XS::set(int Pn_order,
              int num_groups)
@@ -52,17 +53,17 @@ void XS::set(int Pn_order,
     d_Nm = 0;
 
     // clear data
-    d_totals.clear();
-    d_scatter.clear();
+    d_index.clear();
+    d_vectors.clear();
+    d_matrices.clear();
+    d_totals.free();
+    d_scatter.free();
+    d_bands.free();
     d_inst_totals.clear();
     d_inst_scat.clear();
 
-    // resize totals
-    d_totals.resize(END_XS_TYPES);
+    // resize the staged totals and scattering moments
     d_inst_totals.resize(END_XS_TYPES);
-
-    // resize scattering order vector
-    d_scatter.resize(d_pn + 1);
     d_inst_scat.resize(d_pn + 1);
 
     // resize velocities
@@ -113,20 +114,11 @@ void XS::add(int              matid,
 {
     REQUIRE(data.size() == d_Ng);
     REQUIRE(type < END_XS_TYPES);
-    REQUIRE(d_totals.size() == END_XS_TYPES);
     REQUIRE(d_inst_totals.size() == END_XS_TYPES);
     REQUIRE(!d_inst_totals[type].count(matid));
 
-    // make a new denseVector to hold the data
-    RCP_Vector v = Teuchos::rcp(
-        new Vector(Teuchos::Copy, const_cast<double*>(data.getRawPtr()),
-                   data.size()));
-
-    // insert into hash table based on type
-    d_totals[type].insert(Hash_Vector::value_type(matid, v));
-
-    // indicate that this data has been inserted
-    d_inst_totals[type].insert(matid);
+    // stage the data until the arenas are built
+    d_inst_totals[type][matid].assign(data.begin(), data.end());
 
     ENSURE(d_inst_totals[type].count(matid));
 }
@@ -142,12 +134,12 @@ void XS::add(int              matid,
     REQUIRE(data.getNumRows() == data.getNumCols());
     REQUIRE(data.getNumRows() == d_Ng);
     REQUIRE(pn <= d_pn);
-    REQUIRE(d_scatter.size() == d_pn + 1);
-    REQUIRE(!d_inst_scat[d_pn].count(matid));
+    REQUIRE(d_inst_scat.size() == d_pn + 1);
+    REQUIRE(!d_inst_scat[pn].count(matid));
 
-    // make a new matrix to hold data
-    RCP_Matrix m = Teuchos::rcp(new Matrix(d_Ng, d_Ng, true));
-    Matrix    &s = *m;
+    // stage the data until the arenas are built
+    Vec_Dbl &s = d_inst_scat[pn][matid];
+    s.resize(d_Ng * d_Ng);
 
     // the 2Darray is internally ROW-MAJOR, whereas Matrix is COLUMN-MAJOR, so
     // we have to do element-by-element copy
@@ -155,75 +147,155 @@ void XS::add(int              matid,
     {
         for (int i = 0; i < d_Ng; ++i)
         {
-            s(i, j) = data(i, j);
+            s[i + j * d_Ng] = data(i, j);
         }
     }
 
-    // insert into the hash table
-    d_scatter[pn].insert(Hash_Matrix::value_type(matid, m));
-
-    // indicate that this data has been inserted
-    d_inst_scat[pn].insert(matid);
-
     ENSURE(d_inst_scat[pn].count(matid));
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * \brief Complete assignment.
+ *
+ * The staged data is copied into the contiguous arenas; data that has not
+ * been added is zero.
  */
 void XS::complete()
 {
-    // make null data for non-inserted data
-    RCP_Vector vnull = Teuchos::rcp(new Vector(d_Ng, true));
-    RCP_Matrix mnull = Teuchos::rcp(new Matrix(d_Ng, d_Ng, true));
+    REQUIRE(d_inst_totals.size() == END_XS_TYPES);
+    REQUIRE(d_inst_scat.size() == d_pn + 1);
 
-    // iterate through inserted totals and add nulls for non-inserted data
-    for (set_iter itr = d_inst_totals[TOTAL].begin();
-         itr != d_inst_totals[TOTAL].end(); ++itr)
-    {
-        // get the inserted matid
-        int matid = *itr;
+    const Staged &totals = d_inst_totals[TOTAL];
 
-        // add null data to fields that haven't been assigned
-        for (int type = 1; type < END_XS_TYPES; ++type)
+    // index the materials (every material must have a total cross section)
+    d_Nm = totals.size();
+    int m = 0;
+    for (const auto &mat : totals)
+    {
+        d_index.insert(Hash_Index::value_type(mat.first, m++));
+    }
+    d_index.complete();
+    CHECK(d_index.size() == d_Nm);
+
+    // number of moments and size of each scattering matrix; arena sizes and
+    // offsets are computed in size_t because they overflow int for large
+    // libraries (eg. 4e4 materials with 252 groups)
+    std::size_t Nn = d_pn + 1;
+    std::size_t Ng = d_Ng;
+    std::size_t Nm = d_Nm;
+    std::size_t N2 = Ng * Ng;
+
+    // allocate the arenas
+    d_totals.allocate(END_XS_TYPES * Nm * Ng, 0.0);
+    d_scatter.allocate(Nn * Nm * N2, 0.0);
+    d_bands.allocate(2 * Nn * Nm * Ng, 0);
+
+    // fill the totals
+    for (int type = 0; type < END_XS_TYPES; ++type)
+    {
+        m = 0;
+        for (const auto &mat : totals)
         {
-            if (!d_inst_totals[type].count(matid))
+            double *data = d_totals.data() + (type * Nm + m) * Ng;
+
+            auto itr = d_inst_totals[type].find(mat.first);
+            if (itr != d_inst_totals[type].end())
             {
-                d_totals[type].insert(Hash_Vector::value_type(matid, vnull));
+                std::copy(itr->second.begin(), itr->second.end(), data);
             }
+            ++m;
         }
+    }
 
-        // add null data to scattering that haven't been assigned
-        for (int n = 0; n < d_pn + 1; ++n)
+    // fill the scattering and find the nonzero bands
+    for (std::size_t n = 0; n < Nn; ++n)
+    {
+        m = 0;
+        for (const auto &mat : totals)
         {
-            if (!d_inst_scat[n].count(matid))
+            double *data = d_scatter.data() + (n * Nm + m) * N2;
+            int    *band = d_bands.data() + 2 * (n * Nm + m) * Ng;
+
+            auto itr = d_inst_scat[n].find(mat.first);
+            if (itr != d_inst_scat[n].end())
             {
-                d_scatter[n].insert(Hash_Matrix::value_type(matid, mnull));
+                std::copy(itr->second.begin(), itr->second.end(), data);
             }
-        }
-    }
 
-    // store the size
-    d_Nm = d_totals[TOTAL].size();
+            for (int j = 0; j < d_Ng; ++j)
+            {
+                const double *col = data + j * d_Ng;
 
-    // complete all hash-tables
-    for (int type = 0; type < END_XS_TYPES; ++type)
-    {
-        d_totals[type].complete();
-        ENSURE(d_totals[type].size() == d_Nm);
-    }
-    for (int n = 0; n < d_pn + 1; ++n)
-    {
-        d_scatter[n].complete();
-        ENSURE(d_scatter[n].size() == d_Nm);
+                int first = 0, last = d_Ng - 1;
+                while (first < d_Ng && col[first] == 0.0)
+                    ++first;
+                while (last >= first && col[last] == 0.0)
+                    --last;
+
+                band[2 * j]     = first;
+                band[2 * j + 1] = last;
+            }
+            ++m;
+        }
     }
 
-    // clear work sets
+    make_views();
+
+    // clear work data
     d_inst_totals.clear();
     d_inst_scat.clear();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move the data into node-shared memory.
+ *
+ * This call is collective over the current communicator.  The arenas are
+ * copied into shared windows by the master domain on each node, and the
+ * local copies are released on every domain.  The data must be identical on
+ * all domains, which it is when the cross sections are built from a
+ * broadcast XS_Builder.
+ */
+void XS::share()
+{
+    REQUIRE(d_index.completed());
+    REQUIRE(!is_shared());
+
+    d_totals.share();
+    d_scatter.share();
+    d_bands.share();
+
+    make_views();
+
+    ENSURE(is_shared());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Release node-shared memory.
+ *
+ * This call is collective over the current communicator.  The cross
+ * sections are empty afterwards and must be rebuilt with set(), add(), and
+ * complete() before they are used again.
+ */
+void XS::free_shared()
+{
+    REQUIRE(is_shared());
+
+    d_index.clear();
+    d_vectors.clear();
+    d_matrices.clear();
+
+    d_totals.free();
+    d_scatter.free();
+    d_bands.free();
+
+    d_Nm = 0;
+
+    ENSURE(!is_shared());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Get the material ids in the database.
@@ -233,19 +305,57 @@ void XS::complete()
  */
 void XS::get_matids(Vec_Int &matids) const
 {
-    REQUIRE(d_totals[TOTAL].size() == d_Nm);
+    REQUIRE(d_index.size() == d_Nm);
 
     // size the input vector
     matids.resize(d_Nm);
 
     Vec_Int::iterator id_itr = matids.begin();
-    for (hash_iter mitr = d_totals[TOTAL].begin();
-         mitr != d_totals[TOTAL].end(); ++mitr, ++id_itr)
+    for (hash_iter mitr = d_index.begin();
+         mitr != d_index.end(); ++mitr, ++id_itr)
     {
         *id_itr = mitr->first;
     }
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Make the vector and matrix views into the arenas.
+ *
+ * The views are only exposed as const, so they are safe to make into
+ * (read-only) shared arenas.
+ */
+void XS::make_views()
+{
+    std::size_t Nn = d_pn + 1;
+    std::size_t Ng = d_Ng;
+    std::size_t Nm = d_Nm;
+    std::size_t N2 = Ng * Ng;
+
+    double *totals  = d_totals.data();
+    double *scatter = d_scatter.data();
+
+    d_vectors.clear();
+    d_vectors.reserve(END_XS_TYPES * Nm);
+    for (std::size_t n = 0; n < END_XS_TYPES * Nm; ++n)
+    {
+        d_vectors.emplace_back(Teuchos::View, totals + n * Ng, d_Ng);
+    }
+
+    d_matrices.clear();
+    d_matrices.reserve(Nn * Nm);
+    for (std::size_t n = 0; n < Nn * Nm; ++n)
+    {
+        d_matrices.emplace_back(
+            Teuchos::View, scatter + n * N2, d_Ng, d_Ng, d_Ng);
+    }
+
+    ENSURE(d_vectors.size() == END_XS_TYPES * d_Nm);
+    ENSURE(d_matrices.size() == Nn * d_Nm);
+}
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
@@ -17,9 +17,10 @@
 #include "Teuchos_Array.hpp"
 #include "Teuchos_TwoDArray.hpp"
 
-#include <set>
+#include <map>
 #include <vector>
 #include "harness/DBC.hh"
+#include "comm/Shared_Array.hh"
 #include "utils/Static_Map.hh"
 
 namespace profugus
@@ -29,6 +30,28 @@ namespace profugus
 /*!
  * \class XS
  * \brief Cross-section container class.
+ *
+ * Cross sections are added material-by-material and stored in contiguous
+ * arenas when complete() is called:
+ * - totals are stored [type][material][group];
+ * - scattering is stored [moment][material][g'][g], ie. each material's
+ *   scattering matrix is column-major so that the out-scatter from group g'
+ *   (column g') is contiguous.
+ * .
+ * The vector() and matrix() accessors return non-owning (Teuchos::View)
+ * vectors and matrices into the arenas.  Data that is not added for a
+ * material is zero.  Because of the views an XS cannot be copied; it is
+ * shared through Teuchos::RCP.
+ *
+ * The nonzero band of each column of the scattering matrices is also stored
+ * so that the zero upscatter and downscatter blocks can be skipped (see
+ * scatter_band()).
+ *
+ * After complete(), share() may be called (collectively) to move the arenas
+ * into MPI-3 shared windows so that one copy of the cross sections is held
+ * on each shared-memory node instead of one copy per domain.  Shared cross
+ * sections must be released with the collective free_shared() before they
+ * are destroyed and before profugus::finalize() is called.
  */
 /*!
  * \example xs/test/tstXS.cc
@@ -45,10 +68,10 @@ class XS
     typedef std::vector<int>                        Vec_Int;
     typedef Teuchos::SerialDenseVector<int, double> Vector;
     typedef Teuchos::SerialDenseMatrix<int, double> Matrix;
-    typedef Teuchos::RCP<Vector>                    RCP_Vector;
-    typedef Teuchos::RCP<Matrix>                    RCP_Matrix;
-    typedef Static_Map<int, RCP_Vector>             Hash_Vector;
-    typedef Static_Map<int, RCP_Matrix>             Hash_Matrix;
+    typedef std::vector<double>                     Vec_Dbl;
+    typedef Shared_Array<double>                    Arena_Dbl;
+    typedef Shared_Array<int>                       Arena_Int;
+    typedef Static_Map<int, int>                    Hash_Index;
     typedef Teuchos::Array<double>                  OneDArray;
     typedef Teuchos::TwoDArray<double>              TwoDArray;
     //@}
@@ -75,11 +98,19 @@ class XS
     // Final number of materials.
     int d_Nm;
 
-    // Hash table of totals.
-    std::vector<Hash_Vector> d_totals;
+    // Index of each material in the arenas.
+    Hash_Index d_index;
 
-    // Hash table of scattering (vector dimensioned over number of moments).
-    std::vector<Hash_Matrix> d_scatter;
+    // Contiguous totals [type][mat][g] and scattering [n][mat][g'][g].
+    Arena_Dbl d_totals;
+    Arena_Dbl d_scatter;
+
+    // Views into the arenas ([type][mat] and [n][mat]).
+    std::vector<Vector> d_vectors;
+    std::vector<Matrix> d_matrices;
+
+    // First and last nonzero rows of each scattering column [n][mat][g'].
+    Arena_Int d_bands;
 
     // Group velocities in cm/s.
     Vector d_v;
@@ -90,6 +121,11 @@ class XS
   public:
     XS();
 
+    // Disallow copy and assignment (the views point into the arenas of the
+    // object they were made for).
+    XS(const XS &) = delete;
+    XS& operator=(const XS &) = delete;
+
     // >>> SETTING XS DATA
 
     // Set number of groups and Pn order that is stored.
@@ -110,6 +146,12 @@ class XS
     // Complete assignment.
     void complete();
 
+    // Move the data into node-shared memory (collective).
+    void share();
+
+    // Release node-shared memory (collective).
+    void free_shared();
+
     // >>> ACCESSORS
 
     //! Pn order of data.
@@ -121,6 +163,9 @@ class XS
     //! Number of materials in database (invalid until complete() called).
     int num_mat() const { return d_Nm; }
 
+    //! True if the data is held in node-shared memory.
+    bool is_shared() const { return d_totals.shared(); }
+
     // Get the material ids in the database.
     void get_matids(Vec_Int &matids) const;
 
@@ -139,16 +184,23 @@ class XS
     // Return the 2-D data matrix for a given matid and Pn order.
     inline const Matrix& matrix(int matid, int pn) const;
 
+    // Get the nonzero band of scattering out of group g.
+    inline void scatter_band(int matid, int pn, int g, int &first,
+                             int &last) const;
+
   private:
     // >>> IMPLEMENTATION
 
-    typedef std::set<int>               Set_Int;
-    typedef std::vector<Set_Int>        Vec_Set;
-    typedef Set_Int::const_iterator     set_iter;
-    typedef Hash_Vector::const_iterator hash_iter;
+    typedef std::map<int, Vec_Dbl>     Staged;
+    typedef std::vector<Staged>        Vec_Staged;
+    typedef Hash_Index::const_iterator hash_iter;
+
+    // Make the vector and matrix views into the arenas.
+    void make_views();
 
-    Vec_Set d_inst_totals;
-    Vec_Set d_inst_scat;
+    // Data added before complete() is called.
+    Vec_Staged d_inst_totals;
+    Vec_Staged d_inst_scat;
 };
 
 } // end namespace profugus
@@ -20,8 +20,8 @@ namespace profugus
  */
 bool XS::has(int matid) const
 {
-    REQUIRE(!d_totals.empty());
-    return d_totals[TOTAL].exists(matid);
+    REQUIRE(d_index.completed());
+    return d_index.exists(matid);
 }
 
 //---------------------------------------------------------------------------//
@@ -31,9 +31,9 @@ bool XS::has(int matid) const
 const XS::Vector& XS::vector(int matid,
                              int type) const
 {
-    REQUIRE(type < d_totals.size());
-    REQUIRE(d_totals[type].exists(matid));
-    return *d_totals[type][matid];
+    REQUIRE(type < END_XS_TYPES);
+    REQUIRE(d_index.exists(matid));
+    return d_vectors[type * d_Nm + d_index[matid]];
 }
 
 //---------------------------------------------------------------------------//
@@ -43,9 +43,32 @@ const XS::Vector& XS::vector(int matid,
 const XS::Matrix& XS::matrix(int matid,
                              int pn) const
 {
-    REQUIRE(pn < d_scatter.size());
-    REQUIRE(d_scatter[pn].exists(matid));
-    return *d_scatter[pn][matid];
+    REQUIRE(pn <= d_pn);
+    REQUIRE(d_index.exists(matid));
+    return d_matrices[pn * d_Nm + d_index[matid]];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the nonzero band of scattering out of group g.
+ *
+ * On return, \c matrix(matid,pn)(g',g) is zero for \c g'<first and \c
+ * g'>last.  If there is no scattering out of g then \c last<first.
+ */
+void XS::scatter_band(int  matid,
+                      int  pn,
+                      int  g,
+                      int &first,
+                      int &last) const
+{
+    REQUIRE(pn <= d_pn);
+    REQUIRE(g >= 0 && g < d_Ng);
+    REQUIRE(d_index.exists(matid));
+
+    std::size_t mat  = static_cast<std::size_t>(pn) * d_Nm + d_index[matid];
+    const int  *band = d_bands.data() + 2 * (mat * d_Ng + g);
+    first = band[0];
+    last  = band[1];
 }
 
 } // end namespace profugus
@@ -8,9 +8,16 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
 #include "Teuchos_XMLParameterListHelpers.hpp"
 
 #include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "utils/Serial_HDF5_Writer.hh"
+#include "utils/HDF5_Reader.hh"
 #include "XS_Builder.hh"
 
 namespace profugus
@@ -60,9 +67,21 @@ XS_Builder::XS_Builder()
 //---------------------------------------------------------------------------//
 /*!
  * \brief Open an xml file of cross sections and broadcast the data.
+ *
+ * If the file has a \c .h5 extension it is opened as an HDF5 library on
+ * every domain instead (nothing is broadcast).
  */
 void XS_Builder::open_and_broadcast(const std_string &xml_file)
 {
+    // HDF5 libraries
+    if (xml_file.size() > 3 &&
+        xml_file.compare(xml_file.size() - 3, 3, ".h5") == 0)
+    {
+        open_hdf5(xml_file);
+        return;
+    }
+    d_h5_file.clear();
+
     // make the new parameterlist
     d_plxs = Teuchos::rcp(new ParameterList("cross sections"));
 
@@ -158,6 +177,13 @@ void XS_Builder::build(const Matid_Map &map,
     REQUIRE(1 + g_last - g_first <= d_num_groups);
     REQUIRE(pn_order <= d_pn_order);
 
+    // read the cross sections from the HDF5 library
+    if (!d_h5_file.empty())
+    {
+        build_hdf5(map, pn_order, g_first, g_last);
+        return;
+    }
+
     // number of groups in the produced XS
     int num_groups = 1 + g_last - g_first;
     CHECK(num_groups >= 0);
@@ -252,6 +278,297 @@ void XS_Builder::build(const Matid_Map &map,
     d_xs->complete();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the open (XML) cross section library to an HDF5 file.
+ *
+ * This converts XML libraries to the HDF5 library format.  The file is
+ * written by the master domain, one material at a time.  This must be
+ * called on all domains.
+ */
+void XS_Builder::write_hdf5(const std_string &h5_file) const
+{
+    REQUIRE(!d_plxs.is_null());
+
+#ifdef USE_HDF5
+    if (profugus::node() == 0)
+    {
+        int Nm = d_matids.size();
+        int Nt = XS::END_XS_TYPES;
+        int Nn = d_pn_order + 1;
+        int G  = d_num_groups;
+
+        Serial_HDF5_Writer writer;
+        writer.open(h5_file);
+
+        // library description
+        writer.write("num groups", G);
+        writer.write("pn order", d_pn_order);
+        writer.write("num materials", Nm);
+        if (!d_velocity.empty())
+        {
+            writer.write("group v", def::Vec_Dbl(d_velocity.begin(),
+                                                 d_velocity.end()));
+        }
+        if (!d_bounds.empty())
+        {
+            writer.write("bounds", def::Vec_Dbl(d_bounds.begin(),
+                                                d_bounds.end()));
+        }
+
+        std::ostringstream names;
+        for (const auto &name : d_matids)
+        {
+            names << name << "\n";
+        }
+        writer.write("materials", names.str());
+
+        // make the cross section datasets
+        HDF5_IO::Decomp td(3), sd(4);
+        td.order = HDF5_IO::ROW_MAJOR;
+        sd.order = HDF5_IO::ROW_MAJOR;
+
+        td.global[0] = Nm; td.global[1] = Nt; td.global[2] = G;
+        sd.global[0] = Nm; sd.global[1] = Nn;
+        sd.global[2] = G;  sd.global[3] = G;
+        td.local     = td.global;
+        sd.local     = sd.global;
+        td.local[0]  = 1;
+        sd.local[0]  = 1;
+
+        writer.create_incremental_dataspace<double>("totals", td);
+        writer.create_incremental_dataspace<double>("scattering", sd);
+
+        // flags for the data that is present for each material
+        def::Vec_Int has_totals(Nm * Nt, 0), has_scattering(Nm * Nn, 0);
+
+        // write each material
+        def::Vec_Dbl totals(Nt * G), scattering(Nn * G * G);
+        for (int m = 0; m < Nm; ++m)
+        {
+            const ParameterList &mpl = d_plxs->sublist(d_matids[m]);
+
+            std::fill(totals.begin(), totals.end(), 0.0);
+            for (int t = 0; t < Nt; ++t)
+            {
+                if (mpl.isParameter(totals_labels[t]))
+                {
+                    const OneDArray &sigma =
+                        mpl.get<OneDArray>(totals_labels[t]);
+                    CHECK(sigma.size() == G);
+                    std::copy(sigma.begin(), sigma.end(),
+                              totals.begin() + t * G);
+                    has_totals[m * Nt + t] = 1;
+                }
+            }
+
+            std::fill(scattering.begin(), scattering.end(), 0.0);
+            for (int n = 0; n < Nn; ++n)
+            {
+                if (mpl.isParameter(scat_labels[n]))
+                {
+                    const TwoDArray &sigma =
+                        mpl.get<TwoDArray>(scat_labels[n]);
+                    for (int g = 0; g < G; ++g)
+                    {
+                        for (int gp = 0; gp < G; ++gp)
+                        {
+                            scattering[(n * G + g) * G + gp] = sigma(g, gp);
+                        }
+                    }
+                    has_scattering[m * Nn + n] = 1;
+                }
+            }
+
+            td.offset[0] = m;
+            sd.offset[0] = m;
+            writer.write_incremental_data("totals", td, totals.data());
+            writer.write_incremental_data("scattering", sd, scattering.data());
+        }
+
+        writer.write("has totals", has_totals);
+        writer.write("has scattering", has_scattering);
+        writer.close();
+    }
+
+    // the file is complete on every domain after this call
+    profugus::global_barrier();
+#else
+    VALIDATE(false, "HDF5 is required to write " << h5_file);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Open an HDF5 cross section library.
+ *
+ * Only the library description is read; every domain reads it
+ * independently.
+ */
+void XS_Builder::open_hdf5(const std_string &h5_file)
+{
+#ifdef USE_HDF5
+    d_h5_file = h5_file;
+    d_plxs    = RCP_ParameterList();
+
+    // every domain reads the file
+    HDF5_Reader reader;
+    reader.open(d_h5_file, profugus::node());
+
+    reader.read("pn order", d_pn_order);
+    reader.read("num groups", d_num_groups);
+
+    def::Vec_Dbl data;
+    d_velocity.clear();
+    if (reader.query("group v"))
+    {
+        reader.read("group v", data);
+        d_velocity.assign(data.begin(), data.end());
+        CHECK(d_velocity.size() == d_num_groups);
+    }
+
+    d_bounds.clear();
+    if (reader.query("bounds"))
+    {
+        reader.read("bounds", data);
+        d_bounds.assign(data.begin(), data.end());
+        CHECK(d_bounds.size() == d_num_groups + 1);
+    }
+
+    // get the materials in the file
+    std_string names;
+    reader.read("materials", names);
+    reader.close();
+
+    d_matids.clear();
+    std::istringstream in(names);
+    for (std_string name; std::getline(in, name); )
+    {
+        d_matids.push_back(name);
+    }
+
+    ENSURE(d_matids.size() > 0);
+#else
+    VALIDATE(false, "HDF5 is required to read " << h5_file);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the cross sections from the HDF5 library.
+ *
+ * Each material reads only its hyperslab of the requested moments and
+ * groups.
+ */
+void XS_Builder::build_hdf5(const Matid_Map &map,
+                            int              pn_order,
+                            int              g_first,
+                            int              g_last)
+{
+    REQUIRE(!d_h5_file.empty());
+
+#ifdef USE_HDF5
+    int Nm = d_matids.size();
+    int Nt = XS::END_XS_TYPES;
+    int Nn = d_pn_order + 1;
+    int G  = d_num_groups;
+    int Ng = 1 + g_last - g_first;
+
+    // make a new xs database
+    d_xs = Teuchos::rcp(new XS);
+    d_xs->set(pn_order, Ng);
+
+    // truncate and add the velocities and bounds
+    if (!d_velocity.empty())
+    {
+        d_xs->set_velocities(OneDArray(d_velocity.begin() + g_first,
+                                       d_velocity.begin() + g_last + 1));
+    }
+    if (!d_bounds.empty())
+    {
+        d_xs->set_bounds(OneDArray(d_bounds.begin() + g_first,
+                                   d_bounds.begin() + g_last + 2));
+    }
+
+    // index of each material in the file
+    std::unordered_map<std_string, int> index;
+    for (int m = 0; m < Nm; ++m)
+    {
+        index[d_matids[m]] = m;
+    }
+
+    HDF5_Reader reader;
+    reader.open(d_h5_file, profugus::node());
+
+    def::Vec_Int has_totals, has_scattering;
+    reader.read("has totals", has_totals);
+    reader.read("has scattering", has_scattering);
+    CHECK(has_totals.size() == Nm * Nt);
+    CHECK(has_scattering.size() == Nm * Nn);
+
+    // hyperslabs of the requested groups and moments
+    HDF5_IO::Decomp td(3), sd(4);
+    td.order = HDF5_IO::ROW_MAJOR;
+    sd.order = HDF5_IO::ROW_MAJOR;
+
+    td.global[0] = Nm; td.global[1] = Nt; td.global[2] = G;
+    sd.global[0] = Nm; sd.global[1] = Nn; sd.global[2] = G; sd.global[3] = G;
+    td.local[0]  = 1;  td.local[1]  = Nt; td.local[2]  = Ng;
+    sd.local[0]  = 1;  sd.local[1]  = pn_order + 1;
+    sd.local[2]  = Ng; sd.local[3]  = Ng;
+    td.offset[2] = g_first;
+    sd.offset[2] = g_first;
+    sd.offset[3] = g_first;
+
+    def::Vec_Dbl totals(Nt * Ng), scattering((pn_order + 1) * Ng * Ng);
+    for (Matid_Map::const_iterator itr = map.begin();
+         itr != map.end(); ++itr)
+    {
+        int matid = itr->first;
+        VALIDATE(index.count(itr->second), "Material " << itr->second
+                 << " is not in " << d_h5_file);
+        int m = index[itr->second];
+
+        // totals
+        td.offset[0] = m;
+        reader.read("totals", td, totals.data());
+        for (int t = 0; t < Nt; ++t)
+        {
+            if (has_totals[m * Nt + t])
+            {
+                d_xs->add(matid, t, OneDArray(totals.begin() + t * Ng,
+                                              totals.begin() + (t+1) * Ng));
+            }
+        }
+
+        // scattering
+        sd.offset[0] = m;
+        reader.read("scattering", sd, scattering.data());
+        for (int n = 0; n <= pn_order; ++n)
+        {
+            if (has_scattering[m * Nn + n])
+            {
+                TwoDArray sigma(Ng, Ng, 0.0);
+                for (int g = 0; g < Ng; ++g)
+                {
+                    for (int gp = 0; gp < Ng; ++gp)
+                    {
+                        sigma(g, gp) = scattering[(n * Ng + g) * Ng + gp];
+                    }
+                }
+                d_xs->add(matid, n, sigma);
+            }
+        }
+    }
+    reader.close();
+
+    // complete the cross sections
+    d_xs->complete();
+#endif
+}
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
@@ -28,6 +28,25 @@ namespace profugus
 /*!
  * \class XS_Builder
  * \brief Build an XS from input.
+ *
+ * Cross section libraries can be read from XML (the authoring format) or
+ * from HDF5 files (any file with a \c .h5 extension).  XML libraries are
+ * parsed on the master domain and broadcast as a Teuchos::ParameterList.
+ * HDF5 libraries are read independently on every domain, and build() reads
+ * only the requested materials, moments, and group range from the file
+ * using hyperslabs, so large libraries are never read or broadcast whole.
+ *
+ * The HDF5 library layout is
+ * - \c "num groups", \c "pn order", \c "num materials" (int);
+ * - \c "group v", \c "bounds" (optional, double arrays);
+ * - \c "materials" (string, newline-separated material names; the position
+ *   of a name is the index of the material in the datasets below);
+ * - \c "totals" (double, \f$[N_m][N_t][G]\f$ row-major) and \c "has totals"
+ *   (int, \f$[N_m][N_t]\f$ flags for the XS::XS_Types present);
+ * - \c "scattering" (double, \f$[N_m][P_n+1][G][G]\f$ row-major) and
+ *   \c "has scattering" (int, \f$[N_m][P_n+1]\f$ flags).
+ * .
+ * An open XML library can be converted to this format with write_hdf5().
  */
 /*!
  * \example xs/test/tstXS_Builder.cc
@@ -58,8 +77,11 @@ class XS_Builder
     // Constructor.
     XS_Builder();
 
-    // Open and broadcast an XML cross section file.
-    void open_and_broadcast(const std_string &xml_file);
+    // Open and broadcast an XML (or open an HDF5) cross section file.
+    void open_and_broadcast(const std_string &xs_file);
+
+    // Write the open cross section library to an HDF5 file.
+    void write_hdf5(const std_string &h5_file) const;
 
     // Build the cross sections.
     void build(const Matid_Map &map);
@@ -109,6 +131,16 @@ class XS_Builder
 
     // Materials in the file.
     Vec_Str d_matids;
+
+    // HDF5 library file (empty if the library is XML).
+    std_string d_h5_file;
+
+    // Open an HDF5 cross section file.
+    void open_hdf5(const std_string &h5_file);
+
+    // Build the cross sections from the HDF5 file.
+    void build_hdf5(const Matid_Map &map, int pn_order, int g_first,
+                    int g_last);
 };
 
 } // end namespace profugus
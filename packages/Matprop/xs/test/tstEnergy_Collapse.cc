@@ -187,6 +187,55 @@ TEST_F(Energy_Collapse_Test, Multi_Material)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(Energy_Collapse_Test, cache)
+{
+    RCP_Mat_DB mat_db = Teuchos::rcp(new Mat_DB_t);
+    mat_db->set(xs, 2);
+
+    Vec_Int steer(2, 4);
+    Vec_Dbl weights(8, 1.0);
+
+    Energy_Collapse::RCP_Cache cache =
+        Teuchos::rcp(new Energy_Collapse::Cache(4));
+
+    RCP_Mat_DB a = Energy_Collapse::collapse_all_mats(
+        mat_db, steer, weights, cache);
+    RCP_Mat_DB b = Energy_Collapse::collapse_all_mats(
+        mat_db, steer, weights, cache);
+
+    // the collapsed cross sections are shared
+    EXPECT_EQ(&a->xs(), &b->xs());
+    EXPECT_NE(a.get(), b.get());
+    EXPECT_EQ(1, cache->hits());
+
+    // different weights are collapsed again
+    weights[0] = 2.0;
+    RCP_Mat_DB c = Energy_Collapse::collapse_all_mats(
+        mat_db, steer, weights, cache);
+    EXPECT_NE(&a->xs(), &c->xs());
+    EXPECT_DOUBLE_EQ((2.0 + 11.0 + 21.0 + 31.0) / 5.0,
+                     c->xs().vector(0, XS_t::TOTAL)[0]);
+
+    // another cache does not see these cross sections
+    Energy_Collapse::RCP_Cache other =
+        Teuchos::rcp(new Energy_Collapse::Cache(4));
+    RCP_Mat_DB d = Energy_Collapse::collapse_all_mats(
+        mat_db, steer, weights, other);
+    EXPECT_NE(&c->xs(), &d->xs());
+    EXPECT_EQ(1, other->size());
+
+    // without a cache the cross sections are always collapsed
+    RCP_Mat_DB e = Energy_Collapse::collapse_all_mats(mat_db, steer, weights);
+    EXPECT_NE(&d->xs(), &e->xs());
+    for (int gc = 0; gc < 2; ++gc)
+    {
+        EXPECT_EQ(d->xs().vector(1, XS_t::TOTAL)[gc],
+                  e->xs().vector(1, XS_t::TOTAL)[gc]);
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                        end of tstEnergy_Collapse.cc
 //---------------------------------------------------------------------------//
@@ -367,6 +367,87 @@ TEST_F(XS_Test, scat_assignment)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(XS_Test, scatter_bands)
+{
+    xs.add(1, XS::TOTAL, m1_sig);
+    xs.add(1, 0, m1_sigs0);
+    xs.add(5, XS::TOTAL, m5_sig);
+    xs.complete();
+
+    int first = 0, last = 0;
+
+    // nonzero rows of each column of the m1 P0 matrix
+    int ref_first[] = {0, 1, 2, 2};
+    for (int g = 0; g < 4; ++g)
+    {
+        xs.scatter_band(1, 0, g, first, last);
+        EXPECT_EQ(ref_first[g], first);
+        EXPECT_EQ(3, last);
+    }
+
+    // no scattering data
+    for (int g = 0; g < 4; ++g)
+    {
+        xs.scatter_band(1, 1, g, first, last);
+        EXPECT_LT(last, first);
+        xs.scatter_band(5, 0, g, first, last);
+        EXPECT_LT(last, first);
+    }
+
+    // the matrices are views into contiguous storage
+    const Matrix &p0 = xs.matrix(1, 0);
+    EXPECT_EQ(4, p0.stride());
+    EXPECT_EQ(&p0(0, 0) + 4, &p0(0, 1));
+    EXPECT_EQ(0.9, p0[1][2]);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(XS_Test, share)
+{
+    xs.add(1, XS::TOTAL, m1_sig);
+    xs.add(1, 0, m1_sigs0);
+    xs.add(1, 1, m1_sigs1);
+    xs.add(5, XS::TOTAL, m5_sig);
+    xs.add(5, XS::SIG_F, sigf);
+    xs.add(5, 0, m5_sigs0);
+    xs.complete();
+    EXPECT_FALSE(xs.is_shared());
+
+    // copy the data before sharing
+    Vector t1(xs.vector(1, XS::TOTAL)), f5(xs.vector(5, XS::SIG_F));
+    Matrix s1(xs.matrix(1, 1)), s5(xs.matrix(5, 0));
+
+    int first = 0, last = 0;
+    xs.scatter_band(1, 0, 1, first, last);
+    int ref_first = first, ref_last = last;
+
+    xs.share();
+    EXPECT_TRUE(xs.is_shared());
+
+    EXPECT_EQ(2, xs.num_mat());
+    EXPECT_TRUE(t1 == xs.vector(1, XS::TOTAL));
+    EXPECT_TRUE(f5 == xs.vector(5, XS::SIG_F));
+    EXPECT_TRUE(s1 == xs.matrix(1, 1));
+    EXPECT_TRUE(s5 == xs.matrix(5, 0));
+
+    xs.scatter_band(1, 0, 1, first, last);
+    EXPECT_EQ(ref_first, first);
+    EXPECT_EQ(ref_last, last);
+
+    // the views are still into contiguous storage
+    const Matrix &p0 = xs.matrix(1, 0);
+    EXPECT_EQ(&p0(0, 0) + 4, &p0(0, 1));
+    EXPECT_EQ(0.9, p0[1][2]);
+
+    // shared memory is released collectively before destruction
+    xs.free_shared();
+    EXPECT_FALSE(xs.is_shared());
+    EXPECT_EQ(0, xs.num_mat());
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstXS.cc
 //---------------------------------------------------------------------------//
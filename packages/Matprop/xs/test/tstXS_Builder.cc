@@ -8,8 +8,10 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <Utils/config.h>
 #include "gtest/utils_gtest.hh"
 
+#include "comm/global.hh"
 #include "../XS_Builder.hh"
 
 //---------------------------------------------------------------------------//
@@ -505,6 +507,90 @@ TEST_F(XS_Builder_Test, load_5GP1_P0_G13)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+#ifdef USE_HDF5
+
+TEST_F(XS_Builder_Test, hdf5_library)
+{
+    // convert the xml library to hdf5
+    builder.open_and_broadcast("xs5GP1.xml");
+    builder.write_hdf5("xs5GP1.h5");
+
+    XS_Builder h5;
+    h5.open_and_broadcast("xs5GP1.h5");
+    EXPECT_EQ(5, h5.num_groups());
+    EXPECT_EQ(1, h5.pn_order());
+
+    const Vec_Str &mats = h5.materials();
+    EXPECT_EQ(3, mats.size());
+    EXPECT_EQ("mat 1", mats[0]);
+    EXPECT_EQ("mat 4", mats[1]);
+    EXPECT_EQ("mat 5", mats[2]);
+
+    Matid_Map map;
+    map.insert(Matid_Map::value_type(1, std_string("mat 4")));
+    map.insert(Matid_Map::value_type(2, std_string("mat 5")));
+    map.complete();
+
+    // compare full and truncated (P0, groups 1-3) reads with the xml
+    // library
+    int pn[]      = {1, 0};
+    int g_first[] = {0, 1};
+    int g_last[]  = {4, 3};
+    for (int n = 0; n < 2; ++n)
+    {
+        builder.build(map, pn[n], g_first[n], g_last[n]);
+        h5.build(map, pn[n], g_first[n], g_last[n]);
+
+        RCP_XS ref = builder.get_xs();
+        RCP_XS xs  = h5.get_xs();
+        EXPECT_FALSE(xs.is_null());
+
+        EXPECT_EQ(ref->pn_order(), xs->pn_order());
+        EXPECT_EQ(ref->num_groups(), xs->num_groups());
+        EXPECT_EQ(2, xs->num_mat());
+
+        const auto &rb = ref->bounds();
+        const auto &b  = xs->bounds();
+        ASSERT_EQ(rb.length(), b.length());
+        for (int g = 0; g < b.length(); ++g)
+        {
+            EXPECT_EQ(rb(g), b(g));
+        }
+
+        for (int m = 1; m <= 2; ++m)
+        {
+            for (int t = 0; t < XS_t::END_XS_TYPES; ++t)
+            {
+                const Vector &r = ref->vector(m, t);
+                const Vector &v = xs->vector(m, t);
+                ASSERT_EQ(r.length(), v.length());
+                for (int g = 0; g < v.length(); ++g)
+                {
+                    EXPECT_EQ(r(g), v(g));
+                }
+            }
+
+            for (int l = 0; l <= xs->pn_order(); ++l)
+            {
+                const Matrix &r = ref->matrix(m, l);
+                const Matrix &s = xs->matrix(m, l);
+                ASSERT_EQ(r.numRows(), s.numRows());
+                for (int g = 0; g < s.numRows(); ++g)
+                {
+                    for (int gp = 0; gp < s.numCols(); ++gp)
+                    {
+                        EXPECT_EQ(r(g, gp), s(g, gp));
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // USE_HDF5
+
 //---------------------------------------------------------------------------//
 //                 end of tstXS_Builder.cc
 //---------------------------------------------------------------------------//
@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Matprop/xs/xs_convert.cc
+ * \author agent
+ * \date   Mon Oct 19 02:50:54 2026
+ * \brief  Convert XML cross section libraries to HDF5 libraries.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <iostream>
+#include <algorithm>
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "utils/Definitions.hh"
+#include "XS_Builder.hh"
+
+// Parallel specs.
+int node = 0;
+
+//---------------------------------------------------------------------------//
+// Print instructions on how to run the converter
+
+void print_usage()
+{
+    if (node == 0)
+    {
+        std::cout << "Usage: xs_convert -i XMLFILE -o H5FILE" << std::endl;
+        std::cout << "Converts the XMLFILE cross section library to the "
+                  << "HDF5 library H5FILE." << std::endl;
+    }
+    profugus::finalize();
+    exit(1);
+}
+
+//---------------------------------------------------------------------------//
+// Get the argument following a flag
+
+std::string get_argument(const def::Vec_String &arguments,
+                         const std::string     &flag)
+{
+    auto iter = std::find(arguments.begin(), arguments.end(), flag);
+    if (iter == arguments.end() || iter == arguments.end() - 1 ||
+        (iter + 1)->empty())
+    {
+        if (node == 0)
+        {
+            std::cout << std::endl << "ERROR: Missing argument to " << flag
+                      << "." << std::endl << std::endl;
+        }
+        print_usage();
+    }
+
+    return *(iter + 1);
+}
+
+//---------------------------------------------------------------------------//
+
+int main(int argc, char *argv[])
+{
+    profugus::initialize(argc, argv);
+    node = profugus::node();
+
+    // process input arguments
+    def::Vec_String arguments(argv + 1, argv + argc);
+    if (std::find(arguments.begin(), arguments.end(), "-h") != arguments.end()
+        || std::find(arguments.begin(), arguments.end(), "--help") !=
+        arguments.end())
+    {
+        print_usage();
+    }
+
+    std::string xml_file = get_argument(arguments, "-i");
+    std::string h5_file  = get_argument(arguments, "-o");
+
+    try
+    {
+        profugus::XS_Builder builder;
+        builder.open_and_broadcast(xml_file);
+        builder.write_hdf5(h5_file);
+
+        if (node == 0)
+        {
+            std::cout << "Wrote " << builder.materials().size()
+                      << " materials with " << builder.num_groups()
+                      << " groups and Pn order " << builder.pn_order()
+                      << " to " << h5_file << std::endl;
+        }
+    }
+    catch (const profugus::assertion &a)
+    {
+        std::cout << "Caught profugus assertion " << a.what() << std::endl;
+        exit(1);
+    }
+    catch (const std::exception &a)
+    {
+        std::cout << "Caught standard assertion " << a.what() << std::endl;
+        exit(1);
+    }
+
+    profugus::finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+//                 end of xs_convert.cc
+//---------------------------------------------------------------------------//
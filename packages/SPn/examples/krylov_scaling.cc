@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/examples/krylov_scaling.cc
+ * \author agent
+ * \date   Mon Oct 19 05:05:27 2026
+ * \brief  Krylov solver scaling benchmark on an SPN operator.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+/*
+ * Usage: xkrylov_scaling -i XMLFILE
+ *
+ * Builds the SPN operator of the problem in XMLFILE (see krylov_scaling.xml)
+ * and solves A x = 1 with every solver listed in the "krylov_benchmark"
+ * sublist of the PROBLEM block.  Each entry in "solvers" names a sublist
+ * that is given to LinearSolverBuilder, so Belos GMRES ("solver_type" =
+ * "belos") and the native pipelined solvers ("solver_type" = "profugus")
+ * are run on the same operator, preconditioner, and right-hand side.  One
+ * line per solver is written with the number of ranks, the iterations per
+ * solve, and the (slowest rank) time per solve and per iteration; run it on
+ * increasing rank counts (see krylov_scaling.sh) to get the scaling curves.
+ */
+//---------------------------------------------------------------------------//
+
+#include <cstdlib>
+#include <string>
+#include <iostream>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "harness/DBC.hh"
+#include "comm/Timer.hh"
+#include "comm/global.hh"
+#include "comm/P_Stream.hh"
+#include "utils/String_Functions.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "solvers/LinearSolverBuilder.hh"
+#include "solvers/PreconditionerBuilder.hh"
+#include "spn/Dimensions.hh"
+#include "spn/Linear_System_FV.hh"
+#include "spn/VectorTraits.hh"
+#include "spn_driver/Problem_Builder.hh"
+
+//---------------------------------------------------------------------------//
+// Run every solver in the benchmark list on the problem's SPN operator.
+
+template <class T>
+void run(const spn::Problem_Builder &builder)
+{
+    typedef typename T::MV                       MV;
+    typedef typename T::OP                       OP;
+    typedef profugus::LinearSolverBuilder<T>     Solver_Builder;
+    typedef Teuchos::RCP<Teuchos::ParameterList> RCP_ParameterList;
+
+    RCP_ParameterList db  = builder.problem_db();
+    RCP_ParameterList bdb = Teuchos::sublist(db, "krylov_benchmark");
+
+    // build the SPN operator
+    Teuchos::RCP<profugus::Dimensions> dim = Teuchos::rcp(
+        new profugus::Dimensions(db->get("SPn_order", 1)));
+    profugus::Linear_System_FV<T> system(
+        db, dim, builder.mat_db(), builder.mesh(), builder.indexer(),
+        builder.global_data());
+    system.build_Matrix();
+    Teuchos::RCP<OP> A = system.get_Operator();
+
+    // the same preconditioner is given to every solver
+    Teuchos::RCP<OP> P = profugus::PreconditionerBuilder<T>::
+                         build_preconditioner(
+                             A, Teuchos::sublist(bdb, "preconditioner"));
+
+    // solve A x = 1
+    Teuchos::RCP<MV> b = profugus::VectorTraits<T>::build_vector(
+        system.get_Map());
+    Teuchos::RCP<MV> x = profugus::VectorTraits<T>::build_vector(
+        system.get_Map());
+    profugus::VectorTraits<T>::put_scalar(b, 1.0);
+
+    int num_solves = bdb->get("num_solves", 3);
+    VALIDATE(num_solves > 0, "num_solves must be positive.");
+
+    const auto &names = bdb->get<Teuchos::Array<std::string> >("solvers");
+
+    profugus::pcout << profugus::left
+                    << profugus::setw(8) << "ranks"
+                    << profugus::setw(20) << "solver"
+                    << profugus::setw(12) << "iters"
+                    << profugus::setw(14) << "time/solve"
+                    << profugus::setw(14) << "time/iter"
+                    << "converged" << profugus::endl;
+
+    for (const auto &name : names)
+    {
+        VALIDATE(bdb->isSublist(name), "Missing solver sublist " << name);
+
+        auto solver =
+            Solver_Builder::build_solver(Teuchos::sublist(bdb, name));
+        solver->set_operator(A);
+        if (!P.is_null())
+            solver->set_preconditioner(P);
+
+        double time      = 0.0;
+        int    iters     = 0;
+        int    converged = 1;
+        for (int n = 0; n < num_solves; ++n)
+        {
+            profugus::VectorTraits<T>::put_scalar(x, 0.0);
+
+            profugus::global_barrier();
+            profugus::Timer timer;
+            timer.start();
+            solver->solve(x, b);
+            timer.stop();
+
+            time  += timer.TIMER_CLOCK();
+            iters += solver->num_iters();
+            converged = converged && solver->converged();
+        }
+
+        // report the slowest rank
+        profugus::global_max(time);
+
+        double per_solve = time / num_solves;
+        profugus::pcout << profugus::left
+                        << profugus::setw(8) << profugus::nodes()
+                        << profugus::setw(20) << name
+                        << profugus::setw(12)
+                        << static_cast<double>(iters) / num_solves
+                        << profugus::setw(14) << profugus::scientific
+                        << profugus::setprecision(4) << per_solve
+                        << profugus::setw(14)
+                        << (iters > 0 ? time / iters : 0.0)
+                        << (converged ? "yes" : "no") << profugus::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+int main(int argc, char *argv[])
+{
+    profugus::initialize(argc, argv);
+
+    if (argc != 3 || std::string(argv[1]) != "-i")
+    {
+        if (profugus::node() == 0)
+        {
+            std::cout << "Usage: xkrylov_scaling -i XMLFILE" << std::endl;
+        }
+        profugus::finalize();
+        return 1;
+    }
+
+    try
+    {
+        // build the problem (mesh, materials) from the input
+        spn::Problem_Builder builder;
+        builder.setup(argv[2]);
+
+        INSIST(builder.problem_db()->isSublist("krylov_benchmark"),
+               "PROBLEM block has no krylov_benchmark sublist.");
+
+        std::string implementation = profugus::lower(
+            builder.problem_db()->get("trilinos_implementation",
+                                      std::string("epetra")));
+
+        if (implementation == "epetra")
+            run<profugus::EpetraTypes>(builder);
+        else if (implementation == "tpetra")
+            run<profugus::TpetraTypes>(builder);
+        else
+            VALIDATE(false, "Invalid trilinos_implementation "
+                     << implementation);
+    }
+    catch (const profugus::assertion &a)
+    {
+        std::cout << "Caught profugus assertion " << a.what() << std::endl;
+        exit(1);
+    }
+    catch (const std::exception &a)
+    {
+        std::cout << "Caught standard assertion " << a.what() << std::endl;
+        exit(1);
+    }
+
+    profugus::finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+//                 end of krylov_scaling.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,41 @@
+#!/bin/sh
+##---------------------------------------------------------------------------##
+## SPn/examples/krylov_scaling.sh
+## agent
+## Mon Oct 19 05:05:27 2026
+##---------------------------------------------------------------------------##
+## Strong-scaling run of the Belos and native pipelined GMRES solvers on the
+## krylov_scaling.xml SPN operator.
+##
+## Usage: krylov_scaling.sh [XKRYLOV_SCALING] [RANKS...]
+##
+## Runs XKRYLOV_SCALING (default ./xkrylov_scaling) with mpirun on each rank
+## count (default 1 2 4 8 16 32 64) and collects the per-solver lines in
+## krylov_scaling.dat.  Set MPIRUN to override the launcher.
+##---------------------------------------------------------------------------##
+
+EXE=${1:-./xkrylov_scaling}
+[ $# -gt 0 ] && shift
+RANKS=${*:-"1 2 4 8 16 32 64"}
+MPIRUN=${MPIRUN:-mpirun}
+OUT=krylov_scaling.dat
+
+rm -f ${OUT}
+for n in ${RANKS}; do
+    echo ">>> ${n} ranks"
+    ${MPIRUN} -np ${n} ${EXE} -i krylov_scaling.xml > krylov_scaling_${n}.log \
+        || { echo "run on ${n} ranks failed; see krylov_scaling_${n}.log"; \
+             exit 1; }
+
+    # keep the header once and the solver rows from every run
+    if [ ! -f ${OUT} ]; then
+        grep '^ranks' krylov_scaling_${n}.log > ${OUT}
+    fi
+    grep "^${n} " krylov_scaling_${n}.log >> ${OUT}
+done
+
+cat ${OUT}
+
+##---------------------------------------------------------------------------##
+##                 end of krylov_scaling.sh
+##---------------------------------------------------------------------------##
@@ -237,8 +237,9 @@ void Mesh::build_mesh()
         d_Nb[d] = d_N[d];
     }
 
-    // Z block count is divided by number of k blocks (1 if 2D)
-    d_Nb[K] /= d_blocks[K];
+    // Z block count is divided by number of k blocks (1 if 2D); the last
+    // block holds the remainder
+    d_Nb[K] = (d_Nb[K] + d_blocks[K] - 1) / d_blocks[K];
 
     // >>> Calculate number of cells
     d_num_cells    = 1;
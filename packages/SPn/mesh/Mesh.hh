@@ -34,11 +34,13 @@ namespace profugus
  * \f]
  *
  * There are no separate domains in K; however, the user can define effective
- * blocks in K for added parallel efficiency.  The number of cells in each
- * "effective" parallel block is thus \f$ N_x\times N_y\times\mbox{int}(N_z /
- * \mbox{num\_K\_blocks})\f$.  All meshes in the decomposition must have the
- * same number of K blocks and \f$ N_z \f$ defined.  A current restriction is
- * that \f$ N_z\, \mbox{mod}\,\mbox{num\_K\_blocks} = 0 \f$.
+ * blocks in K for added parallel efficiency.  Every "effective" parallel
+ * block except the last has \f$ N_x\times N_y\times\lceil N_z /
+ * \mbox{num\_K\_blocks}\rceil\f$ cells; the last block holds the remaining
+ * \f$ N_z \f$ planes, so \f$ N_z \f$ need not be a multiple of
+ * num_K_blocks.  All meshes in the decomposition must have the same number
+ * of K blocks and \f$ N_z \f$ defined.  The SPN solver does not pipeline in
+ * K and requires a single K block.
  *
  */
 /*!
@@ -187,7 +189,8 @@ class Mesh
     //! Get number of cells in each dimension in each block in this mesh.
     const Dim_Vector& num_cells_block_dims() const { return d_Nb; }
 
-    //! Get number of cells in a given block along dimension \e (i,j,k).
+    //! Get number of cells in a given block along dimension \e (i,j,k)
+    //! (along \e k the last block may have fewer).
     size_type num_cells_block_dim(size_type ijk) const
     {
         REQUIRE(ijk < d_dimension); return d_Nb[ijk];
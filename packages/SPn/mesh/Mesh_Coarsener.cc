@@ -0,0 +1,182 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/mesh/Mesh_Coarsener.cc
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Mesh_Coarsener member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Mesh_Coarsener.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+Mesh_Coarsener::Mesh_Coarsener(RCP_Mesh        mesh,
+                               RCP_Indexer     indexer,
+                               RCP_Global_Data data)
+    : d_fine_mesh(mesh)
+    , d_fine_indexer(indexer)
+    , d_fine_data(data)
+{
+    REQUIRE(!d_fine_mesh.is_null());
+    REQUIRE(!d_fine_indexer.is_null());
+    REQUIRE(!d_fine_data.is_null());
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Whether the mesh can be coarsened.
+ *
+ * This only uses global data, so it returns the same answer on every domain.
+ */
+bool Mesh_Coarsener::coarsenable() const
+{
+    using def::I; using def::J; using def::K;
+
+    for (int d = I; d <= J; ++d)
+    {
+        const Vec_Int &num = d_fine_indexer->num_cells_per_block(d);
+        for (int b = 0; b < num.size(); ++b)
+        {
+            if (num[b] > 1)
+                return true;
+        }
+    }
+
+    return d_fine_mesh->dimension() == 3 && d_fine_data->num_cells(K) > 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the coarse mesh, indexer, and global data.
+ */
+void Mesh_Coarsener::build()
+{
+    using def::I; using def::J; using def::K;
+
+    const int dimension = d_fine_mesh->dimension();
+
+    // >>> COARSE CELLS PER BLOCK AND GLOBAL EDGES
+    def::Vec_Int num[2];
+    Vec_Dbl      global_edges[3];
+    for (int d = I; d <= J; ++d)
+    {
+        const Vec_Int &fine_num = d_fine_indexer->num_cells_per_block(d);
+        const Vec_Dbl &edges    = d_fine_data->edges(d);
+
+        int offset = 0;
+        for (int b = 0; b < fine_num.size(); ++b)
+        {
+            num[d].push_back(coarsen(fine_num[b]));
+            coarsen_edges(edges.begin() + offset, fine_num[b],
+                          global_edges[d]);
+            offset += fine_num[b];
+        }
+        CHECK(offset + 1 == edges.size());
+    }
+    if (dimension == 3)
+    {
+        coarsen_edges(d_fine_data->edges(K).begin(),
+                      d_fine_data->num_cells(K), global_edges[K]);
+    }
+
+    // >>> LOCAL EDGES
+    Vec_Dbl local_edges[3];
+    for (int d = 0; d < dimension; ++d)
+    {
+        coarsen_edges(d_fine_mesh->edges(d).begin(),
+                      d_fine_mesh->num_cells_dim(d), local_edges[d]);
+    }
+
+    // >>> BUILD THE MESH
+    if (dimension == 3)
+    {
+        // keep the number of pipelining blocks in k unless the last one
+        // would be empty on the coarse mesh
+        int num_k     = local_edges[K].size() - 1;
+        int k_blocks  = d_fine_mesh->block(K);
+        int per_block = (num_k + k_blocks - 1) / k_blocks;
+        k_blocks = (num_k + per_block - 1) / per_block;
+        CHECK(k_blocks > 0);
+
+        d_mesh = Teuchos::rcp(
+            new Mesh(local_edges[I], local_edges[J], local_edges[K],
+                     d_fine_mesh->block(I), d_fine_mesh->block(J), k_blocks));
+        d_data = Teuchos::rcp(
+            new Global_Mesh_Data(global_edges[I], global_edges[J],
+                                 global_edges[K]));
+    }
+    else
+    {
+        d_mesh = Teuchos::rcp(
+            new Mesh(local_edges[I], local_edges[J], d_fine_mesh->block(I),
+                     d_fine_mesh->block(J)));
+        d_data = Teuchos::rcp(
+            new Global_Mesh_Data(global_edges[I], global_edges[J]));
+    }
+
+    // >>> BUILD INDEXER
+    d_indexer = Teuchos::rcp(
+        new LG_Indexer(num[I], num[J], d_fine_indexer->num_sets()));
+    CHECK(d_indexer->num_cells(I) == d_mesh->num_cells_dim(I));
+    CHECK(d_indexer->num_cells(J) == d_mesh->num_cells_dim(J));
+
+    // >>> MAP FINE CELLS TO COARSE CELLS
+    d_coarse_cell.resize(d_fine_mesh->num_cells());
+    int i = 0, j = 0, k = 0;
+    for (int cell = 0; cell < d_fine_mesh->num_cells(); ++cell)
+    {
+        d_fine_indexer->l2l(cell, i, j, k);
+        d_coarse_cell[cell] = d_indexer->l2l(
+            i / 2, j / 2, dimension == 3 ? k / 2 : 0);
+    }
+
+    ENSURE(!d_mesh.is_null());
+    ENSURE(!d_data.is_null());
+    ENSURE(!d_indexer.is_null());
+    ENSURE(d_data->num_cells(I) == d_indexer->num_global(I));
+    ENSURE(d_data->num_cells(J) == d_indexer->num_global(J));
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Coarsen a range of edges.
+ *
+ * Every other edge of the \c num_cells+1 edges starting at \a first is
+ * appended to \a edges, always including the last edge.  If \a edges is not
+ * empty the first edge is assumed to be its last entry already.
+ */
+void Mesh_Coarsener::coarsen_edges(Vec_Dbl::const_iterator  first,
+                                   int                      num_cells,
+                                   Vec_Dbl                 &edges)
+{
+    REQUIRE(num_cells > 0);
+    REQUIRE(edges.empty() || edges.back() == *first);
+
+    if (edges.empty())
+        edges.push_back(*first);
+
+    for (int n = 2; n < num_cells; n += 2)
+    {
+        edges.push_back(first[n]);
+    }
+    edges.push_back(first[num_cells]);
+}
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Mesh_Coarsener.cc
+//---------------------------------------------------------------------------//
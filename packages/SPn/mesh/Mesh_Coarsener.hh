@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/mesh/Mesh_Coarsener.hh
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Mesh_Coarsener class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_mesh_Mesh_Coarsener_hh
+#define SPn_mesh_Mesh_Coarsener_hh
+
+#include "Teuchos_RCP.hpp"
+
+#include "harness/DBC.hh"
+#include "utils/Definitions.hh"
+
+#include "Global_Mesh_Data.hh"
+#include "LG_Indexer.hh"
+#include "Mesh.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Mesh_Coarsener
+ * \brief Build a partitioned coarse mesh by factor-2 cell agglomeration.
+ *
+ * Each processor block is coarsened independently so that the coarse mesh
+ * has the same decomposition as the fine mesh and every coarse cell lives on
+ * the domain of its fine cells.  Pairs of fine cells are merged in each
+ * direction; when a block has an odd number of cells in a direction the last
+ * coarse cell contains a single fine cell.  All of \e k is on each domain, so
+ * the \e k direction is coarsened globally.
+ *
+ * The coarse mesh, indexer, and global data are created during \c build()
+ * and have the same interfaces as the objects created by the Partitioner.
+ */
+/*!
+ * \example mesh/test/tstMesh_Coarsener.cc
+ *
+ * Test of Mesh_Coarsener.
+ */
+//===========================================================================//
+
+class Mesh_Coarsener
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef Teuchos::RCP<Mesh>             RCP_Mesh;
+    typedef Teuchos::RCP<LG_Indexer>       RCP_Indexer;
+    typedef Teuchos::RCP<Global_Mesh_Data> RCP_Global_Data;
+    typedef def::Vec_Int                   Vec_Int;
+    typedef def::Vec_Dbl                   Vec_Dbl;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // Fine mesh objects.
+    RCP_Mesh        d_fine_mesh;
+    RCP_Indexer     d_fine_indexer;
+    RCP_Global_Data d_fine_data;
+
+    // Coarse mesh objects, created during build().
+    RCP_Mesh        d_mesh;
+    RCP_Indexer     d_indexer;
+    RCP_Global_Data d_data;
+
+    // Local coarse cell of each local fine cell.
+    Vec_Int d_coarse_cell;
+
+  public:
+    // Constructor.
+    Mesh_Coarsener(RCP_Mesh mesh, RCP_Indexer indexer, RCP_Global_Data data);
+
+    // Whether the fine mesh can be coarsened in any direction.
+    bool coarsenable() const;
+
+    // Build the coarse mesh.
+    void build();
+
+    //! Number of coarse cells from a number of fine cells.
+    static int coarsen(int n) { REQUIRE(n > 0); return (n + 1) / 2; }
+
+    // >>> ACCESSORS
+
+    //! Get the coarse mesh.
+    RCP_Mesh get_mesh() const { return d_mesh; }
+
+    //! Get the coarse local-global indexer.
+    RCP_Indexer get_indexer() const { return d_indexer; }
+
+    //! Get coarse global mesh data.
+    RCP_Global_Data get_global_data() const { return d_data; }
+
+    //! Local coarse cell of a local fine cell.
+    int coarse_cell(int fine_cell) const
+    {
+        REQUIRE(fine_cell >= 0 && fine_cell < d_coarse_cell.size());
+        return d_coarse_cell[fine_cell];
+    }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Coarsen a set of edges.
+    static void coarsen_edges(Vec_Dbl::const_iterator first, int num_cells,
+                              Vec_Dbl &edges);
+};
+
+} // end namespace profugus
+
+#endif // SPn_mesh_Mesh_Coarsener_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Mesh_Coarsener.hh
+//---------------------------------------------------------------------------//
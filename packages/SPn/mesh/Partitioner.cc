@@ -9,6 +9,9 @@
 //---------------------------------------------------------------------------//
 
 #include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <numeric>
 
 #include "harness/Warnings.hh"
 #include "harness/Soft_Equivalence.hh"
@@ -164,6 +167,18 @@ Partitioner::Partitioner(RCP_ParameterList pl)
         }
     }
 
+    // local cell weights for load balancing
+    d_balance_iterations = 0;
+    if (pl->isParameter("cell_weights"))
+    {
+        const Array_Dbl &w = pl->get<Array_Dbl>("cell_weights");
+        d_weights.insert(d_weights.end(), w.begin(), w.end());
+
+        d_balance_iterations = pl->get("balance_iterations", 10);
+        VALIDATE(d_balance_iterations >= 0,
+                 "balance_iterations must be non-negative.");
+    }
+
     ENSURE(d_Nb[I] > 0);
     ENSURE(d_Nb[J] > 0);
     ENSURE(d_dimension > 0);
@@ -224,16 +239,15 @@ void Partitioner::build()
     // Set the number of z blocks
     if (d_dimension == 3)
     {
-        // update number of z blocks if mesh does not divide evenly
-        bool change_blocks = false;
+        // every z block but the last has the same number of cells; reduce
+        // the number of z blocks only if the last one would be empty
         const size_type num_cells_k = d_edges[K].size() - 1;
-        while (num_cells_k % d_k_blocks != 0)
-        {
-            change_blocks = true;
-            --d_k_blocks;
-        }
+        const size_type requested   = d_k_blocks;
+        size_type cells_per_block   =
+            (num_cells_k + d_k_blocks - 1) / d_k_blocks;
+        d_k_blocks = (num_cells_k + cells_per_block - 1) / cells_per_block;
 
-        if (change_blocks && d_domain == 0)
+        if (d_k_blocks != requested && d_domain == 0)
         {
             ADD_WARNING("Number of Z blocks is being reduced to "
                     << d_k_blocks);
@@ -358,24 +372,29 @@ void Partitioner::set_spatial_partition(const Dim_Vector& index,
     // the number of cells on the I/J directions on this processor
     Dim_Vector local_num_cells;
 
-    // loop through I/J directions and determine base cells per proc
+    // split the cells uniformly in the I/J directions; if the number of
+    // cells does not divide evenly then 1 cell (row/column) is added to the
+    // blocks starting at Ip/Jp = 0
+    IJ_Vec_Int num;
     for (int dir = 0; dir < K; ++dir)
     {
         CHECK(d_Nb[dir] > 0);
+        uniform_split(global_num_cells[dir], d_Nb[dir], num[dir]);
+    }
 
-        // estimate the base cells per pe in this direction
-        local_num_cells[dir] = global_num_cells[dir] / d_Nb[dir];
-        CHECK(local_num_cells[dir] > 0);
-
-        // get the number of cells that need to be appended in this direction
-        size_type append_cells = global_num_cells[dir] % d_Nb[dir];
-        CHECK(append_cells < d_Nb[dir]);
+    // balance the weighted cells in the I/J directions
+    if (!d_weights.empty())
+    {
+        balance(index, global_num_cells, num);
+    }
 
-        // if Ip/Jp is less than the number of append cells then add 1 cell
-        // (row/column) to this block
-        if (index[dir] < append_cells)
-            local_num_cells[dir]++;
+    for (int dir = 0; dir < K; ++dir)
+    {
+        CHECK(num[dir].size() == d_Nb[dir]);
+        local_num_cells[dir] = num[dir][index[dir]];
+        CHECK(local_num_cells[dir] > 0);
     }
+
     // size the z coordinates
     local_num_cells[K] = global_num_cells[K];
 
@@ -395,6 +414,351 @@ void Partitioner::set_spatial_partition(const Dim_Vector& index,
             dimension() == 2);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split cells uniformly into blocks.
+ *
+ * The first \c num_cells%num_blocks blocks get one extra cell.
+ */
+void Partitioner::uniform_split(int      num_cells,
+                                int      num_blocks,
+                                Vec_Int& num)
+{
+    REQUIRE(num_blocks > 0);
+
+    num.assign(num_blocks, num_cells / num_blocks);
+    for (int n = 0; n < num_cells % num_blocks; ++n)
+        ++num[n];
+
+    ENSURE(std::accumulate(num.begin(), num.end(), 0) == num_cells);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Balance the weighted cells in each block along I/J.
+ *
+ * On entry \a num holds the uniform partition that the local weights are
+ * given on; on exit it holds the balanced partition.  The local weights are
+ * summed over \e k into columns and reduced into profiles along one
+ * direction, one for each block along the other direction, so the load of
+ * every block is known for any boundaries along the first direction.  The
+ * marginals (the sums of the profiles) are split by recursive bisection, and
+ * then each direction is re-split in turn to minimize the largest block load
+ * with the other direction fixed.
+ */
+void Partitioner::balance(const Dim_Vector& index,
+                          const Dim_Vector& global_num_cells,
+                          IJ_Vec_Int&       num) const
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(num[I].size() == d_Nb[I]);
+    REQUIRE(num[J].size() == d_Nb[J]);
+
+    // offset and size of this domain's block in the uniform partition
+    Dim_Vector offset, local;
+    for (int dir = 0; dir < K; ++dir)
+    {
+        VALIDATE(global_num_cells[dir] >= d_Nb[dir],
+                 "Fewer cells than blocks along direction " << dir);
+
+        offset[dir] = std::accumulate(
+            num[dir].begin(), num[dir].begin() + index[dir], 0);
+        local[dir] = num[dir][index[dir]];
+    }
+    local[K] = global_num_cells[K];
+
+    VALIDATE(d_weights.size() == local[I] * local[J] * local[K],
+             "cell_weights must have one entry per cell on this domain "
+             "in the uniform partition.");
+
+    // sum the local weights over k into (i,j) columns; only the first set
+    // contributes so that each column is counted once in the reductions
+    Vec_Dbl column(local[I] * local[J], 0.0);
+    if (d_set == 0)
+    {
+        for (int k = 0, n = 0; k < local[K]; ++k)
+        {
+            for (int j = 0; j < local[J]; ++j)
+            {
+                for (int i = 0; i < local[I]; ++i, ++n)
+                {
+                    VALIDATE(d_weights[n] >= 0.0,
+                             "cell_weights must be non-negative.");
+                    column[i + j * local[I]] += d_weights[n];
+                }
+            }
+        }
+    }
+
+    // reduce the weight profiles along dir, one for each block along the
+    // other direction in the current partition
+    auto profiles = [&](int dir, Vec_Dbl& p)
+    {
+        int other = (dir == I) ? J : I;
+        int N     = global_num_cells[dir];
+
+        // block along the other direction of each global cell
+        Vec_Int block;
+        for (int b = 0; b < d_Nb[other]; ++b)
+            block.insert(block.end(), num[other][b], b);
+
+        p.assign(d_Nb[other] * N, 0.0);
+        for (int j = 0; j < local[J]; ++j)
+        {
+            for (int i = 0; i < local[I]; ++i)
+            {
+                int g[2] = {offset[I] + i, offset[J] + j};
+                p[block[g[other]] * N + g[dir]] += column[i + j * local[I]];
+            }
+        }
+        profugus::global_sum(&p[0], p.size());
+    };
+
+    // initial boundaries from recursive bisection of the marginal weights
+    Vec_Dbl p, w;
+    for (int dir = 0; dir < K; ++dir)
+    {
+        profiles(dir, p);
+
+        int N = global_num_cells[dir];
+        w.assign(N, 0.0);
+        for (int n = 0; n < p.size(); ++n)
+            w[n % N] += p[n];
+
+        num[dir].clear();
+        bisect(w.begin(), w.size(), d_Nb[dir], num[dir]);
+    }
+
+    // refine the boundaries against the block loads, alternating between
+    // the directions until the largest load stops decreasing
+    profiles(J, p);
+    double load = max_load(p, d_Nb[I], num[J]);
+    for (int n = 0; n < d_balance_iterations; ++n)
+    {
+        bool improved = false;
+        for (int dir : {J, I})
+        {
+            profiles(dir, p);
+
+            Vec_Int trial;
+            double trial_load = min_max_split(
+                p, d_Nb[dir == I ? J : I], d_Nb[dir], trial);
+
+            if (trial_load < load * (1.0 - 1.0e-12))
+            {
+                num[dir].swap(trial);
+                load     = trial_load;
+                improved = true;
+            }
+        }
+
+        if (!improved)
+            break;
+    }
+
+    ENSURE(num[I].size() == d_Nb[I]);
+    ENSURE(num[J].size() == d_Nb[J]);
+    ENSURE(std::accumulate(num[I].begin(), num[I].end(), 0) ==
+           global_num_cells[I]);
+    ENSURE(std::accumulate(num[J].begin(), num[J].end(), 0) ==
+           global_num_cells[J]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split weighted cells into blocks by recursive bisection.
+ *
+ * The cells are split into two parts holding \c num_blocks/2 and the
+ * remaining blocks so that the weight of each part is as close as possible
+ * to its share of the total weight; each part is then split recursively.
+ * The number of cells in each block is appended to \a num.
+ */
+void Partitioner::bisect(Vec_Dbl::const_iterator  first,
+                         int                      num_cells,
+                         int                      num_blocks,
+                         Vec_Int&                 num)
+{
+    REQUIRE(num_blocks > 0);
+    REQUIRE(num_cells >= num_blocks);
+
+    if (num_blocks == 1)
+    {
+        num.push_back(num_cells);
+        return;
+    }
+
+    // number of blocks on the low and high sides
+    int low  = num_blocks / 2;
+    int high = num_blocks - low;
+
+    // target weight of the low side
+    double target = std::accumulate(first, first + num_cells, 0.0) *
+                    low / num_blocks;
+
+    // find the split closest to the target that leaves at least one cell
+    // per block on each side
+    double weight = std::accumulate(first, first + low, 0.0);
+    double best   = std::fabs(weight - target);
+    int    split  = low;
+    for (int n = low + 1; n <= num_cells - high; ++n)
+    {
+        weight += first[n - 1];
+        if (std::fabs(weight - target) < best)
+        {
+            best  = std::fabs(weight - target);
+            split = n;
+        }
+    }
+
+    bisect(first, split, low, num);
+    bisect(first + split, num_cells - split, high, num);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split cells to minimize the largest block load over several
+ * profiles.
+ *
+ * \a profiles holds \a num_profiles weight profiles over the same cells,
+ * one after the other; the load of a block is the largest of its sums over
+ * the profiles.  The smallest bound that a greedy split can meet with
+ * \a num_blocks blocks is found by bisection, and blocks are split until
+ * there are exactly \a num_blocks of them.
+ *
+ * \return the largest block load
+ */
+double Partitioner::min_max_split(const Vec_Dbl& profiles,
+                                  int            num_profiles,
+                                  int            num_blocks,
+                                  Vec_Int&       num)
+{
+    REQUIRE(num_profiles > 0);
+    REQUIRE(profiles.size() % num_profiles == 0);
+    REQUIRE(profiles.size() / num_profiles >= num_blocks);
+
+    const int num_cells = profiles.size() / num_profiles;
+
+    // a single block always meets the largest profile sum
+    double lo = 0.0, hi = 0.0;
+    for (int p = 0; p < num_profiles; ++p)
+    {
+        hi = std::max(hi, std::accumulate(
+                          profiles.begin() + p * num_cells,
+                          profiles.begin() + (p + 1) * num_cells, 0.0));
+    }
+
+    // bisect on the bound
+    for (int n = 0; n < 64 && hi - lo > 1.0e-12 * hi; ++n)
+    {
+        double bound = 0.5 * (lo + hi);
+        if (greedy_split(profiles, num_profiles, bound, num_blocks, num))
+            hi = bound;
+        else
+            lo = bound;
+    }
+
+    bool fits = greedy_split(profiles, num_profiles, hi, num_blocks, num);
+    CHECK(fits);
+
+    // splitting a block cannot increase the largest load
+    while (num.size() < num_blocks)
+    {
+        auto b = std::find_if(num.begin(), num.end(),
+                              [](int cells) { return cells > 1; });
+        CHECK(b != num.end());
+        --(*b);
+        num.insert(b + 1, 1);
+    }
+
+    ENSURE(num.size() == num_blocks);
+    ENSURE(std::accumulate(num.begin(), num.end(), 0) == num_cells);
+    return max_load(profiles, num_profiles, num);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greedily split cells into blocks whose loads do not exceed a bound.
+ *
+ * Each block is extended until the next cell would push one of its profile
+ * sums over \a bound.
+ *
+ * \return false if more than \a max_blocks blocks are needed
+ */
+bool Partitioner::greedy_split(const Vec_Dbl& profiles,
+                               int            num_profiles,
+                               double         bound,
+                               int            max_blocks,
+                               Vec_Int&       num)
+{
+    REQUIRE(num_profiles > 0);
+    REQUIRE(max_blocks > 0);
+
+    const int num_cells = profiles.size() / num_profiles;
+
+    num.clear();
+    Vec_Dbl sum(num_profiles, 0.0);
+    int     count = 0;
+    for (int c = 0; c < num_cells; ++c)
+    {
+        bool fits = true;
+        for (int p = 0; p < num_profiles; ++p)
+        {
+            if (sum[p] + profiles[c + p * num_cells] > bound)
+                fits = false;
+        }
+
+        if (!fits)
+        {
+            // a cell that does not fit in an empty block can't be placed
+            if (count == 0 || num.size() + 1 == max_blocks)
+                return false;
+
+            // close this block and retry the cell in a new one
+            num.push_back(count);
+            std::fill(sum.begin(), sum.end(), 0.0);
+            count = 0;
+            --c;
+            continue;
+        }
+
+        for (int p = 0; p < num_profiles; ++p)
+            sum[p] += profiles[c + p * num_cells];
+        ++count;
+    }
+    num.push_back(count);
+
+    ENSURE(num.size() <= max_blocks);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Largest block load over several profiles.
+ */
+double Partitioner::max_load(const Vec_Dbl& profiles,
+                             int            num_profiles,
+                             const Vec_Int& num)
+{
+    REQUIRE(num_profiles > 0);
+
+    const int num_cells = profiles.size() / num_profiles;
+    REQUIRE(std::accumulate(num.begin(), num.end(), 0) == num_cells);
+
+    double load = 0.0;
+    for (int p = 0; p < num_profiles; ++p)
+    {
+        for (int b = 0, c = p * num_cells; b < num.size(); ++b)
+        {
+            double sum = 0.0;
+            for (int n = 0; n < num[b]; ++n, ++c)
+                sum += profiles[c];
+            load = std::max(load, sum);
+        }
+    }
+    return load;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Communicate the number of cells in each block along I/J
@@ -36,6 +36,31 @@ namespace profugus
  * block (mesh on a processor) the same size.  If the number of cells in each
  * direction does not divide evenly, then cells are added to each direction
  * starting at \e (i=0,j=0). The mesh is decomposed into \e B blocks.
+ *
+ * If "cell_weights" is given, the block boundaries are chosen to balance the
+ * work instead of the number of cells.  Each domain supplies the weights of
+ * its own cells in the uniform partition described above (\e i fastest, then
+ * \e j, then \e k); no domain holds the weights of the whole mesh.  The
+ * weights are summed over \e k into \e (i,j) columns and reduced into
+ * profiles along one direction, one profile for each block along the other
+ * direction.  The initial \e I and \e J boundaries come from recursive
+ * coordinate bisection of the marginal weights.  The boundaries are then
+ * refined against the actual block loads: with the \e J boundaries fixed the
+ * \e I boundaries are chosen to minimize the largest block load, then the
+ * \e J boundaries with the \e I boundaries fixed, and so on for at most
+ * "balance_iterations" (10) sweeps or until the largest load stops
+ * decreasing.  Only the domains in the first set contribute weights.
+ *
+ * The blocks always hold every \e k plane because the LG_Indexer and the SPN
+ * gather describe \e I x \e J decompositions; weights that vary in \e k
+ * are balanced through their column sums.  The decomposition is a tensor
+ * product, so the best achievable balance is limited when the expensive
+ * cells are concentrated in one corner.
+ *
+ * The "num_z_blocks" (pipelining blocks in \e k) need not divide the number
+ * of cells in \e k; every \e k block except the last holds
+ * Mesh::num_cells_block_dim(K) cells.  Only transport sweeps pipeline in
+ * \e k; the SPN solver requires "num_z_blocks" to be 1.
  */
 /*!
  * \example mesh/test/tstPartitioner.cc
@@ -90,6 +115,13 @@ class Partitioner
     //! Global cell edges in each direction.
     IJK_Vec_Dbl d_edges;
 
+    //! Local cell weights in the uniform partition (empty for uniform
+    //! partitioning).
+    Vec_Dbl d_weights;
+
+    //! Maximum number of alternating boundary refinement sweeps.
+    int d_balance_iterations;
+
   public:
     // Constructor.
     Partitioner(RCP_ParameterList pl);
@@ -134,6 +166,29 @@ class Partitioner
                                IJK_Vec_Dbl& local_edges,
                                IJ_Vec_Int& global_num) const;
 
+    // Split cells uniformly into blocks.
+    static void uniform_split(int num_cells, int num_blocks, Vec_Int& num);
+
+    // Balance the weighted cells in each block along I/J.
+    void balance(const Dim_Vector& index, const Dim_Vector& global_num_cells,
+                 IJ_Vec_Int& num) const;
+
+    // Split weighted cells into blocks by recursive bisection.
+    static void bisect(Vec_Dbl::const_iterator first, int num_cells,
+                       int num_blocks, Vec_Int& num);
+
+    // Split cells to minimize the largest block load over several profiles.
+    static double min_max_split(const Vec_Dbl& profiles, int num_profiles,
+                                int num_blocks, Vec_Int& num);
+
+    // Greedily split cells into blocks whose loads do not exceed a bound.
+    static bool greedy_split(const Vec_Dbl& profiles, int num_profiles,
+                             double bound, int max_blocks, Vec_Int& num);
+
+    // Largest block load over several profiles.
+    static double max_load(const Vec_Dbl& profiles, int num_profiles,
+                           const Vec_Int& num);
+
     // Communicate the number of cells in each block along I/J.
     void set_global_num(const Dim_Vector& local_num_cells,
                         IJ_Vec_Int& global_num) const;
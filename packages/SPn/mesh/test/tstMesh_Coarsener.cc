@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/mesh/test/tstMesh_Coarsener.cc
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Mesh_Coarsener unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "gtest/utils_gtest.hh"
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "utils/Definitions.hh"
+#include "../Partitioner.hh"
+#include "../Mesh_Coarsener.hh"
+
+using def::I;
+using def::J;
+using def::K;
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+// NOTE: the test class name must not contain underscores.
+class Mesh_Coarsener_Test : public testing::Test
+{
+  protected:
+    // Typedefs usable inside the test fixture
+    typedef profugus::Partitioner          Partitioner;
+    typedef profugus::Mesh_Coarsener       Mesh_Coarsener;
+    typedef Partitioner::RCP_Mesh          RCP_Mesh;
+    typedef Partitioner::RCP_Indexer       RCP_Indexer;
+    typedef Partitioner::RCP_Global_Data   RCP_Global_Data;
+    typedef Partitioner::RCP_ParameterList RCP_ParameterList;
+    typedef Partitioner::ParameterList     ParameterList;
+
+  protected:
+    // Initialization that are performed for each test
+    void SetUp()
+    {
+        node  = profugus::node();
+        nodes = profugus::nodes();
+
+        // global mesh: 7 x 6 x 3
+        pl = Teuchos::rcp(new ParameterList("Part"));
+        pl->set("num_cells_i", 7);
+        pl->set("num_cells_j", 6);
+        pl->set("num_cells_k", 3);
+        pl->set("delta_x", 0.1);
+        pl->set("delta_y", 0.2);
+        pl->set("delta_z", 0.5);
+
+        if (nodes == 2)
+        {
+            pl->set("num_blocks_i", 2);
+        }
+        if (nodes == 4)
+        {
+            pl->set("num_blocks_i", 2);
+            pl->set("num_blocks_j", 2);
+        }
+
+        Partitioner p(pl);
+        p.build();
+
+        mesh    = p.get_mesh();
+        indexer = p.get_indexer();
+        data    = p.get_global_data();
+    }
+
+    // Check that every fine cell is inside its coarse cell.
+    void check_nesting(const Mesh_Coarsener &c,
+                       RCP_Mesh              fine)
+    {
+        RCP_Mesh coarse = c.get_mesh();
+        for (int cell = 0; cell < fine->num_cells(); ++cell)
+        {
+            profugus::Mesh::Dim_Vector ijk =
+                coarse->cardinal(c.coarse_cell(cell));
+            for (int d = 0; d < 3; ++d)
+            {
+                double x = fine->center(fine->cardinal(cell)[d], d);
+                EXPECT_LT(coarse->edges(ijk[d], d), x);
+                EXPECT_GT(coarse->edges(ijk[d] + 1, d), x);
+            }
+        }
+    }
+
+  protected:
+    // >>> Data that get re-initialized between tests
+
+    RCP_ParameterList pl;
+    RCP_Mesh          mesh;
+    RCP_Indexer       indexer;
+    RCP_Global_Data   data;
+
+    int node, nodes;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(Mesh_Coarsener_Test, One_Level)
+{
+    Mesh_Coarsener c(mesh, indexer, data);
+    EXPECT_TRUE(c.coarsenable());
+    c.build();
+
+    RCP_Mesh        coarse = c.get_mesh();
+    RCP_Indexer     cindex = c.get_indexer();
+    RCP_Global_Data cdata  = c.get_global_data();
+
+    // each block is coarsened independently
+    for (int d = I; d <= J; ++d)
+    {
+        EXPECT_EQ(Mesh_Coarsener::coarsen(mesh->num_cells_dim(d)),
+                  coarse->num_cells_dim(d));
+        EXPECT_EQ(indexer->num_blocks(d), cindex->num_blocks(d));
+    }
+    EXPECT_EQ(2, coarse->num_cells_dim(K));
+    EXPECT_EQ(1, coarse->block(K));
+
+    // the global domain is unchanged
+    for (int d = 0; d < 3; ++d)
+    {
+        EXPECT_SOFTEQ(data->low_edge(d), cdata->low_edge(d), 1.0e-12);
+        EXPECT_SOFTEQ(data->high_edge(d), cdata->high_edge(d), 1.0e-12);
+        EXPECT_SOFTEQ(mesh->low_corner(d), coarse->low_corner(d), 1.0e-12);
+        EXPECT_SOFTEQ(mesh->high_corner(d), coarse->high_corner(d),
+                      1.0e-12);
+    }
+    EXPECT_SOFTEQ(data->volume(), cdata->volume(), 1.0e-12);
+
+    if (nodes == 1)
+    {
+        // 7 x 6 x 3 -> 4 x 3 x 2
+        EXPECT_EQ(24, coarse->num_cells());
+        EXPECT_EQ(24, cdata->num_cells());
+
+        double x[] = {0.0, 0.2, 0.4, 0.6, 0.7};
+        for (int n = 0; n < 5; ++n)
+        {
+            EXPECT_SOFTEQ(x[n], coarse->edges(n, I), 1.0e-12);
+        }
+        EXPECT_SOFTEQ(1.0, coarse->edges(1, K), 1.0e-12);
+        EXPECT_SOFTEQ(1.5, coarse->edges(2, K), 1.0e-12);
+
+        // fine (6,5,2) -> coarse (3,2,1)
+        EXPECT_EQ(3 + 4 * (2 + 3 * 1), c.coarse_cell(6 + 7 * (5 + 6 * 2)));
+    }
+
+    this->check_nesting(c, mesh);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Mesh_Coarsener_Test, All_Levels)
+{
+    RCP_Mesh        fine   = mesh;
+    RCP_Indexer     findex = indexer;
+    RCP_Global_Data fdata  = data;
+
+    int levels = 0;
+    while (true)
+    {
+        Mesh_Coarsener c(fine, findex, fdata);
+        if (!c.coarsenable())
+            break;
+
+        c.build();
+        this->check_nesting(c, fine);
+        ++levels;
+
+        fine   = c.get_mesh();
+        findex = c.get_indexer();
+        fdata  = c.get_global_data();
+    }
+
+    // one cell per block remains
+    EXPECT_EQ(1, fine->num_cells());
+    EXPECT_EQ(indexer->num_blocks(), fdata->num_cells());
+    EXPECT_EQ(nodes == 4 ? 2 : 3, levels);
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstMesh_Coarsener.cc
+//---------------------------------------------------------------------------//
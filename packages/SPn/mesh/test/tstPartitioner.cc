@@ -16,6 +16,7 @@
 
 #include "Teuchos_RCP.hpp"
 
+#include "comm/global.hh"
 #include "utils/Definitions.hh"
 #include "../Partitioner.hh"
 
@@ -58,6 +59,45 @@ class Partitioner_Test : public testing::Test
         pl = Teuchos::rcp(new ParameterList("Part"));
     }
 
+    // Weights of the cells on this domain in the uniform Nbi x Nbj
+    // partition of an Ni x Nj x Nk mesh (the blocks must divide evenly).
+    Array_Dbl local_weights(const Array_Dbl &w, int Ni, int Nj, int Nk,
+                            int Nbi, int Nbj) const
+    {
+        int ni = Ni / Nbi, nj = Nj / Nbj;
+        int i0 = (node % Nbi) * ni, j0 = (node / Nbi) * nj;
+
+        Array_Dbl local;
+        for (int k = 0; k < Nk; ++k)
+        {
+            for (int j = j0; j < j0 + nj; ++j)
+            {
+                for (int i = i0; i < i0 + ni; ++i)
+                {
+                    local.push_back(w[i + Ni * (j + Nj * k)]);
+                }
+            }
+        }
+        return local;
+    }
+
+    // Weight of the cells on this domain.
+    double block_load(const Array_Dbl &w) const
+    {
+        double load = 0.0;
+        for (int k = 0; k < mesh->num_cells_dim(K); ++k)
+        {
+            for (int j = 0; j < mesh->num_cells_dim(J); ++j)
+            {
+                for (int i = 0; i < mesh->num_cells_dim(I); ++i)
+                {
+                    load += w[indexer->l2g(i, j, k)];
+                }
+            }
+        }
+        return load;
+    }
+
   protected:
     // >>> Data that get re-initialized between tests
 
@@ -1499,6 +1539,221 @@ TEST_F(Partitioner_Test, 4PE_2D)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(Partitioner_Test, Weighted)
+{
+    // 10 x 4 x 3 mesh where the first two i-planes are four times as
+    // expensive as the rest; 2 z-blocks do not divide the k cells
+    {
+        pl->set("num_cells_i", 10);
+        pl->set("num_cells_j", 4);
+        pl->set("num_cells_k", 3);
+        pl->set("delta_x", 1.0);
+        pl->set("delta_y", 1.0);
+        pl->set("delta_z", 1.0);
+        pl->set("num_z_blocks", 2);
+
+        if (nodes == 2)
+        {
+            pl->set("num_blocks_i", 2);
+        }
+        if (nodes == 4)
+        {
+            pl->set("num_blocks_i", 2);
+            pl->set("num_blocks_j", 2);
+        }
+
+        Array_Dbl w(10 * 4 * 3, 1.0);
+        for (int n = 0; n < w.size(); ++n)
+        {
+            if (n % 10 < 2)
+                w[n] = 4.0;
+        }
+        pl->set("cell_weights", local_weights(
+                    w, 10, 4, 3, nodes > 1 ? 2 : 1, nodes == 4 ? 2 : 1));
+    }
+
+    p = Teuchos::rcp(new Partitioner(pl));
+    p->build();
+
+    mesh    = p->get_mesh();
+    indexer = p->get_indexer();
+    gdata   = p->get_global_data();
+
+    EXPECT_EQ(2, mesh->block(K));
+    EXPECT_EQ(2, mesh->num_cells_block_dim(K));
+    EXPECT_EQ(3, mesh->num_cells_dim(K));
+    EXPECT_EQ(120, gdata->num_cells());
+
+    // the expensive planes are on their own block in i
+    const std::vector<int> &ni = indexer->num_cells_per_block(I);
+    const std::vector<int> &nj = indexer->num_cells_per_block(J);
+    if (nodes == 1)
+    {
+        EXPECT_EQ(10, ni[0]);
+        EXPECT_EQ(4, nj[0]);
+    }
+    else
+    {
+        ASSERT_EQ(2, ni.size());
+        EXPECT_EQ(2, ni[0]);
+        EXPECT_EQ(8, ni[1]);
+    }
+    if (nodes == 4)
+    {
+        ASSERT_EQ(2, nj.size());
+        EXPECT_EQ(2, nj[0]);
+        EXPECT_EQ(2, nj[1]);
+    }
+
+    EXPECT_EQ(ni[mesh->block(I)], mesh->num_cells_dim(I));
+    EXPECT_EQ(nj[mesh->block(J)], mesh->num_cells_dim(J));
+    EXPECT_SOFTEQ(mesh->block(I) == 0 ? 0.0 : 2.0, mesh->low_corner(I),
+                  1.0e-12);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Partitioner_Test, Weighted_Nonseparable)
+{
+    // 4 x 4 x 1 mesh with a hot spot in the low (i,j) corner; the weights
+    // are not separable in (i,j)
+    {
+        pl->set("num_cells_i", 4);
+        pl->set("num_cells_j", 4);
+        pl->set("num_cells_k", 1);
+        pl->set("delta_x", 1.0);
+        pl->set("delta_y", 1.0);
+        pl->set("delta_z", 1.0);
+
+        if (nodes == 2)
+        {
+            pl->set("num_blocks_i", 2);
+        }
+        if (nodes == 4)
+        {
+            pl->set("num_blocks_i", 2);
+            pl->set("num_blocks_j", 2);
+        }
+    }
+
+    Array_Dbl w(4 * 4, 1.0);
+    w[0] = w[1] = w[4] = w[5] = 7.0;
+    pl->set("cell_weights", local_weights(
+                w, 4, 4, 1, nodes > 1 ? 2 : 1, nodes == 4 ? 2 : 1));
+
+    p = Teuchos::rcp(new Partitioner(pl));
+    p->build();
+
+    mesh    = p->get_mesh();
+    indexer = p->get_indexer();
+
+    // the marginals are (16,16,4,4) and the hot planes are split from each
+    // other
+    const std::vector<int> &ni = indexer->num_cells_per_block(I);
+    const std::vector<int> &nj = indexer->num_cells_per_block(J);
+    if (nodes > 1)
+    {
+        ASSERT_EQ(2, ni.size());
+        EXPECT_EQ(1, ni[0]);
+        EXPECT_EQ(3, ni[1]);
+    }
+    if (nodes == 4)
+    {
+        ASSERT_EQ(2, nj.size());
+        EXPECT_EQ(1, nj[0]);
+        EXPECT_EQ(3, nj[1]);
+    }
+
+    // the ideal load on 4 blocks is 10, but the hot spot is a single 2x2
+    // square; 15 is the smallest largest-load of any 2x2 tensor-product
+    // partition of this mesh, so the refinement keeps the bisection
+    double local = block_load(w);
+    if (nodes == 1)
+    {
+        EXPECT_EQ(40.0, local);
+    }
+    else if (nodes == 2)
+    {
+        double ref[] = {16.0, 24.0};
+        EXPECT_EQ(ref[node], local);
+    }
+    else if (nodes == 4)
+    {
+        double ref[] = {7.0, 9.0, 9.0, 15.0};
+        EXPECT_EQ(ref[node], local);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(Partitioner_Test, Weighted_Refined)
+{
+    if (nodes != 4)
+        return;
+
+    // 8 x 8 x 2 mesh with a 3 x 3 hot spot in the low (i,j) corner
+    Array_Dbl w(8 * 8 * 2, 1.0);
+    for (int k = 0; k < 2; ++k)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                w[i + 8 * (j + 8 * k)] = 4.0;
+            }
+        }
+    }
+
+    auto build = [this, &w](int iterations)
+    {
+        pl = Teuchos::rcp(new ParameterList("Part"));
+        pl->set("num_cells_i", 8);
+        pl->set("num_cells_j", 8);
+        pl->set("num_cells_k", 2);
+        pl->set("delta_x", 1.0);
+        pl->set("delta_y", 1.0);
+        pl->set("delta_z", 1.0);
+        pl->set("num_blocks_i", 2);
+        pl->set("num_blocks_j", 2);
+        pl->set("cell_weights", local_weights(w, 8, 8, 2, 2, 2));
+        pl->set("balance_iterations", iterations);
+
+        p = Teuchos::rcp(new Partitioner(pl));
+        p->build();
+
+        mesh    = p->get_mesh();
+        indexer = p->get_indexer();
+    };
+
+    // bisection of the marginals alone puts the whole hot spot on block 0
+    build(0);
+    {
+        EXPECT_EQ(3, indexer->num_cells_per_block(I)[0]);
+        EXPECT_EQ(3, indexer->num_cells_per_block(J)[0]);
+
+        double load = block_load(w);
+        profugus::global_max(load);
+        EXPECT_EQ(72.0, load);
+    }
+
+    // refining the J boundaries against the block loads reaches 60, the
+    // best 2x2 tensor-product partition of this mesh (ideal 45.5)
+    build(10);
+    {
+        const std::vector<int> &ni = indexer->num_cells_per_block(I);
+        const std::vector<int> &nj = indexer->num_cells_per_block(J);
+        EXPECT_EQ(3, ni[0]);
+        EXPECT_EQ(5, ni[1]);
+        EXPECT_EQ(2, nj[0]);
+        EXPECT_EQ(6, nj[1]);
+
+        double ref[] = {48.0, 20.0, 54.0, 60.0};
+        EXPECT_EQ(ref[node], block_load(w));
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstPartitioner.cc
 //---------------------------------------------------------------------------//
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/Chebyshev.hh
+ * \author agent
+ * \date   Mon Oct 19 04:07:38 2026
+ * \brief  Chebyshev class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_Chebyshev_hh
+#define SPn_solvers_Chebyshev_hh
+
+#include "harness/DBC.hh"
+#include "LinearSolver.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziOperatorTraits.hpp"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Chebyshev
+ * \brief Chebyshev polynomial smoother.
+ *
+ * Applies a fixed-degree Chebyshev polynomial in the (preconditioned)
+ * operator \f$\mathbf{M}^{-1}\mathbf{A}\f$ that damps the part of the error
+ * with eigenvalues in \f$[\lambda_{max}/\rho, \lambda_{max}]\f$.  Each
+ * iteration is one operator and one preconditioner application plus vector
+ * updates; there are no inner products, so a solve makes no global
+ * reductions.  This makes it a communication-light multigrid smoother when
+ * the preconditioner is local (e.g. block Jacobi).  The largest eigenvalue
+ * is estimated by a few power iterations on the first solve after the
+ * operator or preconditioner is set, which are the only reductions.
+ *
+ * The constructor takes in parameterlist.  The following entries are
+ * significant:
+ *  - ``max_itr''           The degree of the polynomial (default 3).
+ *  - ``Eigenvalue Ratio''  Ratio \f$\rho\f$ of the largest to the smallest
+ *                          eigenvalue targeted (default 30).
+ *  - ``Power Iterations''  Power iterations used to estimate the largest
+ *                          eigenvalue (default 10).
+ *  - ``Eigenvalue Boost''  Safety factor applied to the estimate (default
+ *                          1.1).
+ *  - ``Max Eigenvalue''    Largest eigenvalue; when given no estimate is
+ *                          made.
+ * The tolerance is not used and converged() is always true.  The memory
+ * requirement for this solver is two vectors (not including the solution
+ * vector and rhs).  One additional vector is required if a preconditioner
+ * is used.
+ *
+ * \sa Chebyshev.t.hh for detailed descriptions.
+ */
+/*!
+ * \example solvers/test/tstChebyshev.cc
+ *
+ * Test of Chebyshev.
+ */
+//===========================================================================//
+
+template <class T>
+class Chebyshev : public LinearSolver<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                        MV;
+    typedef typename T::OP                        OP;
+    typedef LinearSolver<T>                       Base;
+    typedef typename Base::ParameterList          ParameterList;
+    typedef typename Base::RCP_ParameterList      RCP_ParameterList;
+    typedef Anasazi::MultiVecTraits<double,MV>    MVT;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    //@}
+
+  public:
+    // Constructor
+    Chebyshev( RCP_ParameterList db );
+
+    // Solve
+    void solve( Teuchos::RCP<MV>       x,
+                Teuchos::RCP<const MV> b );
+
+    //! Set the operator.
+    void set_operator( Teuchos::RCP<OP> A )
+    {
+        Base::set_operator(A);
+        d_lambda_max = d_user_lambda;
+    }
+
+    //! Set the preconditioner.
+    void set_preconditioner( Teuchos::RCP<OP> P )
+    {
+        REQUIRE( P != Teuchos::null );
+        d_P = P;
+        d_lambda_max = d_user_lambda;
+    }
+
+    //! Blocks are smoothed at once.
+    bool supports_blocks() const { return true; }
+
+    //! The operator is never the preconditioner (M = A would be wrong).
+    bool uses_operator_preconditioner() const { return false; }
+
+    //! Largest eigenvalue bound (zero before the first solve).
+    double lambda_max() const { return d_lambda_max; }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Set the smoother defaults before the base class reads the database.
+    static RCP_ParameterList defaults(RCP_ParameterList db);
+
+    // Estimate the largest eigenvalue by power iteration.
+    void estimate_lambda_max(const MV &x);
+
+    // Compute r = M^{-1}(b - Ax).
+    void residual(const MV &x, const MV &b, MV &r, Teuchos::RCP<MV> tmp);
+
+  private:
+
+    Teuchos::RCP<OP> d_P;
+
+    using LinearSolver<T>::b_db;
+    using LinearSolver<T>::b_A;
+    using LinearSolver<T>::b_tolerance;
+    using LinearSolver<T>::b_num_iters;
+    using LinearSolver<T>::b_max_iters;
+    using LinearSolver<T>::b_converged;
+    using LinearSolver<T>::b_label;
+    using LinearSolver<T>::b_verbosity;
+
+    // Ratio of the largest to smallest targeted eigenvalue.
+    double d_ratio;
+
+    // Power iterations and safety factor for the eigenvalue estimate.
+    int    d_power_itr;
+    double d_boost;
+
+    // User-supplied largest eigenvalue (zero if it must be estimated).
+    double d_user_lambda;
+
+    // Largest eigenvalue bound used by the polynomial.
+    double d_lambda_max;
+};
+
+} // end namespace profugus
+
+#endif // SPn_solvers_Chebyshev_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Chebyshev.hh
+//---------------------------------------------------------------------------//
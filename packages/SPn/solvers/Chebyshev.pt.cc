@@ -0,0 +1,29 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/Chebyshev.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 04:07:38 2026
+ * \brief  Explicit instantiation of Chebyshev solver.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Chebyshev.t.hh"
+#include "Epetra_Operator.h"
+#include "Epetra_MultiVector.h"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "LinAlgTypedefs.hh"
+
+namespace profugus
+{
+
+template class Chebyshev<EpetraTypes>;
+template class Chebyshev<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Chebyshev.pt.cc
+//---------------------------------------------------------------------------//
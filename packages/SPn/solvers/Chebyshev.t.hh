@@ -0,0 +1,241 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/Chebyshev.t.hh
+ * \author agent
+ * \date   Mon Oct 19 04:07:38 2026
+ * \brief  Chebyshev template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_Chebyshev_t_hh
+#define SPn_solvers_Chebyshev_t_hh
+
+#include <vector>
+
+#include "comm/P_Stream.hh"
+#include "Chebyshev.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build a native Chebyshev smoother.
+ */
+template <class T>
+Chebyshev<T>::Chebyshev( RCP_ParameterList db )
+    : LinearSolver<T>(defaults(db))
+    , d_lambda_max(0.0)
+{
+    d_ratio       = b_db->get("Eigenvalue Ratio", 30.0);
+    d_power_itr   = b_db->get("Power Iterations", 10);
+    d_boost       = b_db->get("Eigenvalue Boost", 1.1);
+    d_user_lambda = b_db->get("Max Eigenvalue", 0.0);
+    b_label       = "Profugus Chebyshev";
+
+    INSIST( d_ratio > 1.0, "Eigenvalue Ratio must be greater than 1." );
+    INSIST( d_power_itr > 0, "Power Iterations must be positive." );
+    INSIST( d_boost >= 1.0, "Eigenvalue Boost must be at least 1." );
+    INSIST( d_user_lambda >= 0.0, "Max Eigenvalue must be non-negative." );
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the Chebyshev polynomial to a linear system.
+ *
+ * With \f$\theta = (\lambda_{max} + \lambda_{min})/2\f$, \f$\delta =
+ * (\lambda_{max} - \lambda_{min})/2\f$, and \f$\sigma = \theta/\delta\f$
+ * the iteration is (Saad, Alg. 12.1)
+ * \f[
+   \mathbf{r}_k = \mathbf{M}^{-1}(\mathbf{b} - \mathbf{A}\mathbf{x}_k), \quad
+   \rho_{k} = \frac{1}{2\sigma - \rho_{k-1}}, \quad
+   \mathbf{d}_k = \rho_k\rho_{k-1}\mathbf{d}_{k-1} +
+                  \frac{2\rho_k}{\delta}\mathbf{r}_k, \quad
+   \mathbf{x}_{k+1} = \mathbf{x}_k + \mathbf{d}_k,
+ * \f]
+ * starting from \f$\rho_0 = 1/\sigma\f$ and \f$\mathbf{d}_0 =
+ * \mathbf{r}_0/\theta\f$.  All vectors in a block are smoothed at once.
+ */
+template <class T>
+void Chebyshev<T>::solve( Teuchos::RCP<MV>       x,
+                          Teuchos::RCP<const MV> b )
+{
+    REQUIRE( b_A != Teuchos::null );
+    REQUIRE( x   != Teuchos::null );
+    REQUIRE( b   != Teuchos::null );
+    REQUIRE( MVT::GetNumberVecs(*x) == MVT::GetNumberVecs(*b) );
+
+    // Estimate the spectrum on the first solve with this operator
+    if( d_lambda_max == 0.0 )
+        estimate_lambda_max(*x);
+    CHECK( d_lambda_max > 0.0 );
+
+    int num_vectors = MVT::GetNumberVecs(*x);
+
+    // Allocate necessary vectors
+    Teuchos::RCP<MV> r = MVT::Clone(*x,num_vectors);
+    Teuchos::RCP<MV> d = MVT::Clone(*x,num_vectors);
+
+    Teuchos::RCP<MV> tmp;
+    if( d_P != Teuchos::null )
+    {
+        tmp = MVT::Clone(*x,num_vectors);
+    }
+
+    // Polynomial coefficients
+    double lambda_min = d_lambda_max / d_ratio;
+    double theta      = 0.5 * (d_lambda_max + lambda_min);
+    double delta      = 0.5 * (d_lambda_max - lambda_min);
+    double sigma      = theta / delta;
+    double rho        = 1.0 / sigma;
+
+    b_num_iters = 0;
+
+    // First iteration: d = r/theta
+    residual(*x,*b,*r,tmp);
+    MVT::MvAddMv(1.0/theta,*r,0.0,*r,*d);
+    MVT::MvAddMv(1.0,*x,1.0,*d,*x);
+    b_num_iters++;
+
+    while( b_num_iters < b_max_iters )
+    {
+        residual(*x,*b,*r,tmp);
+
+        // d = rho_k*rho_{k-1}*d + 2*rho_k/delta*r
+        double rho_new = 1.0 / (2.0*sigma - rho);
+        MVT::MvAddMv(rho_new*rho,*d,2.0*rho_new/delta,*r,*d);
+        rho = rho_new;
+
+        // x = x + d
+        MVT::MvAddMv(1.0,*x,1.0,*d,*x);
+
+        b_num_iters++;
+    }
+
+    // A fixed-degree polynomial makes no convergence test
+    b_converged = true;
+
+    if( b_verbosity >= LinearSolver<T>::HIGH )
+    {
+        profugus::pout << b_label << " applied degree " << b_num_iters
+                       << " polynomial on [" << lambda_min << ", "
+                       << d_lambda_max << "]." << profugus::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the smoother defaults.
+ *
+ * The LinearSolver default of 100 iterations suits a Krylov solver; the
+ * polynomial is a smoother, so its default degree is small.
+ */
+template <class T>
+typename Chebyshev<T>::RCP_ParameterList
+Chebyshev<T>::defaults(RCP_ParameterList db)
+{
+    REQUIRE( db != Teuchos::null );
+    db->get("max_itr", 3);
+    return db;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Estimate the largest eigenvalue of the preconditioned operator.
+ *
+ * A fixed number of power iterations is started from a random vector.  The
+ * norm ratio over-estimates the spectral radius of a non-normal operator,
+ * which is the safe side for the polynomial; the estimate is further
+ * increased by "Eigenvalue Boost".
+ */
+template <class T>
+void Chebyshev<T>::estimate_lambda_max(const MV &x)
+{
+    Teuchos::RCP<MV> z = MVT::Clone(x,1);
+    Teuchos::RCP<MV> y = MVT::Clone(x,1);
+
+    Teuchos::RCP<MV> tmp;
+    if( d_P != Teuchos::null )
+    {
+        tmp = MVT::Clone(x,1);
+    }
+
+    std::vector<double> nrm(1);
+
+    MVT::MvRandom(*z);
+    MVT::MvNorm(*z,nrm);
+    CHECK( nrm[0] > 0.0 );
+    MVT::MvScale(*z,1.0/nrm[0]);
+
+    double lambda = 0.0;
+    for( int n = 0; n < d_power_itr; ++n )
+    {
+        // y = M^{-1}Az
+        if( d_P != Teuchos::null )
+        {
+            OPT::Apply(*b_A,*z,*tmp);
+            OPT::Apply(*d_P,*tmp,*y);
+        }
+        else
+        {
+            OPT::Apply(*b_A,*z,*y);
+        }
+
+        MVT::MvNorm(*y,nrm);
+        lambda = nrm[0];
+        if( lambda == 0.0 )
+            break;
+
+        MVT::MvAddMv(1.0/lambda,*y,0.0,*y,*z);
+    }
+    INSIST( lambda > 0.0, "Chebyshev eigenvalue estimate is zero." );
+
+    d_lambda_max = d_boost * lambda;
+
+    if( b_verbosity >= LinearSolver<T>::MEDIUM )
+    {
+        profugus::pout << b_label << " estimated largest eigenvalue "
+                       << d_lambda_max << " after " << d_power_itr
+                       << " power iterations." << profugus::endl;
+    }
+
+    ENSURE( d_lambda_max > 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the preconditioned residual.
+ */
+template <class T>
+void Chebyshev<T>::residual(const MV         &x,
+                            const MV         &b,
+                            MV               &r,
+                            Teuchos::RCP<MV>  tmp)
+{
+    if( d_P != Teuchos::null )
+    {
+        OPT::Apply(*b_A,x,*tmp);
+        MVT::MvAddMv(1.0,b,-1.0,*tmp,*tmp);
+        OPT::Apply(*d_P,*tmp,r);
+    }
+    else
+    {
+        OPT::Apply(*b_A,x,r);
+        MVT::MvAddMv(1.0,b,-1.0,r,r);
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_solvers_Chebyshev_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Chebyshev.t.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/ConjugateGradient.hh
+ * \author agent
+ * \date   Mon Oct 19 03:33:56 2026
+ * \brief  ConjugateGradient class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_ConjugateGradient_hh
+#define SPn_solvers_ConjugateGradient_hh
+
+#include "harness/DBC.hh"
+#include "LinearSolver.hh"
+#include "LocalDotTraits.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziOperatorTraits.hpp"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class ConjugateGradient
+ * \brief Pipelined, preconditioned conjugate gradient with one overlapped
+ * global reduction per iteration.
+ *
+ * The search direction \f$\mathbf{p}\f$ and its images under the operator
+ * and preconditioner are updated by recurrence (Ghysels and Vanroose) so that
+ * the inner products \f$(\mathbf{r},\mathbf{u})\f$,
+ * \f$(\mathbf{A}\mathbf{u},\mathbf{u})\f$, and \f$(\mathbf{r},\mathbf{r})\f$,
+ * where \f$\mathbf{u} = \mathbf{M}^{-1}\mathbf{r}\f$, are summed in a
+ * single non-blocking reduction that is completed after the iteration's
+ * preconditioner and operator applications.  Standard CG needs two blocking
+ * reductions per iteration.  The extra recurrences cost a little accuracy in
+ * the attainable residual.  The operator and preconditioner must be
+ * symmetric positive-definite.
+ *
+ * The constructor takes in parameterlist.  The following entries are
+ * significant:
+ *  - ``tolerance'' The tolerance for the residual relative to the rhs.
+ *  - ``max_itr''   The maximum number of iterations to be performed.
+ * The memory requirement for this solver is nine vectors (not including the
+ * solution vector and rhs).
+ *
+ * \sa ConjugateGradient.t.hh for detailed descriptions.
+ */
+/*!
+ * \example solvers/test/tstConjugateGradient.cc
+ *
+ * Test of ConjugateGradient.
+ */
+//===========================================================================//
+
+template <class T>
+class ConjugateGradient : public LinearSolver<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                        MV;
+    typedef typename T::OP                        OP;
+    typedef LinearSolver<T>                       Base;
+    typedef typename Base::ParameterList          ParameterList;
+    typedef typename Base::RCP_ParameterList      RCP_ParameterList;
+    typedef Anasazi::MultiVecTraits<double,MV>    MVT;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    //@}
+
+  public:
+    // Constructor
+    ConjugateGradient( RCP_ParameterList db );
+
+    // Solve
+    void solve( Teuchos::RCP<MV>       x,
+                Teuchos::RCP<const MV> b );
+
+    //! Set the preconditioner.
+    void set_preconditioner( Teuchos::RCP<OP> P )
+    {
+        REQUIRE( P != Teuchos::null );
+        d_P = P;
+    }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    typedef LocalDotTraits<T> LDT;
+
+    // Apply the preconditioner (or copy when there is none).
+    void apply_prec(const MV &x, MV &y);
+
+  private:
+
+    Teuchos::RCP<OP> d_P;
+
+    using LinearSolver<T>::b_db;
+    using LinearSolver<T>::b_A;
+    using LinearSolver<T>::b_tolerance;
+    using LinearSolver<T>::b_num_iters;
+    using LinearSolver<T>::b_max_iters;
+    using LinearSolver<T>::b_converged;
+    using LinearSolver<T>::b_label;
+    using LinearSolver<T>::b_verbosity;
+};
+
+} // end namespace profugus
+
+#endif // SPn_solvers_ConjugateGradient_hh
+
+//---------------------------------------------------------------------------//
+//                 end of ConjugateGradient.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,29 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/ConjugateGradient.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:33:56 2026
+ * \brief  Explicit instantiation of ConjugateGradient solver.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "ConjugateGradient.t.hh"
+#include "Epetra_Operator.h"
+#include "Epetra_MultiVector.h"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "LinAlgTypedefs.hh"
+
+namespace profugus
+{
+
+template class ConjugateGradient<EpetraTypes>;
+template class ConjugateGradient<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of ConjugateGradient.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,215 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/ConjugateGradient.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:33:56 2026
+ * \brief  ConjugateGradient template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_ConjugateGradient_t_hh
+#define SPn_solvers_ConjugateGradient_t_hh
+
+#include <cmath>
+#include <vector>
+
+#include "comm/global.hh"
+#include "comm/P_Stream.hh"
+#include "ConjugateGradient.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build a native conjugate gradient solver.
+ */
+template <class T>
+ConjugateGradient<T>::ConjugateGradient( RCP_ParameterList db )
+    : LinearSolver<T>(db)
+{
+    b_label = "Profugus CG";
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Solve a linear system using the conjugate gradient method.
+ *
+ * This is the pipelined method of Ghysels and Vanroose.  In addition to the
+ * Chronopoulos-Gear recurrences, \f$\mathbf{M}^{-1}\mathbf{s}\f$ and
+ * \f$\mathbf{A}\mathbf{M}^{-1}\mathbf{s}\f$ are carried by recurrence,
+ * so the preconditioner and operator applied in an iteration act on
+ * \f$\mathbf{w} = \mathbf{A}\mathbf{u}\f$, which is known before the inner
+ * products are.  The inner products are posted as a non-blocking reduction
+ * and completed after those applications.
+ */
+template <class T>
+void ConjugateGradient<T>::solve( Teuchos::RCP<MV>       x,
+                                  Teuchos::RCP<const MV> b )
+{
+    REQUIRE( b_A != Teuchos::null );
+    REQUIRE( x   != Teuchos::null );
+    REQUIRE( b   != Teuchos::null );
+    REQUIRE( MVT::GetNumberVecs(*x) == 1 );
+
+    // Allocate the work vectors, W = [r, u] with u = M^{-1} r
+    Teuchos::RCP<MV> W = MVT::Clone(*x,2);
+    std::vector<int> ind(1);
+    ind[0] = 0;
+    Teuchos::RCP<MV> r = MVT::CloneViewNonConst(*W,ind);
+    ind[0] = 1;
+    Teuchos::RCP<MV> u = MVT::CloneViewNonConst(*W,ind);
+
+    // w = Au, m = M^{-1} w, and n = Am
+    Teuchos::RCP<MV> w = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> m = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> n = MVT::Clone(*x,1);
+
+    // Search direction and the recurrences s = Ap, q = M^{-1} s, z = Aq
+    Teuchos::RCP<MV> p = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> s = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> q = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> z = MVT::Clone(*x,1);
+
+    std::vector<double> tmp_nrm(1); // Temp storage for vector norm.
+    double dots[3];                 // (r,r), (u,r), and (w,u).
+    Request request;
+
+    MVT::MvNorm(*b,tmp_nrm);
+    double b_norm   = tmp_nrm[0];
+    double res_norm = b_norm;
+
+    b_converged = false;
+    b_num_iters = 0;
+
+    // If the RHS is zero, set solution to zero and return
+    if( b_norm == 0.0 )
+    {
+        MVT::MvInit(*x,0.0);
+        b_converged = true;
+        return;
+    }
+
+    // Initial residual, u = M^{-1} r, and w = A u
+    OPT::Apply(*b_A,*x,*r);
+    MVT::MvAddMv(1.0,*b,-1.0,*r,*r);
+    apply_prec(*r,*u);
+    OPT::Apply(*b_A,*u,*w);
+
+    double alpha = 0.0, beta = 0.0, gamma = 0.0;
+
+    while( true )
+    {
+        // Start the reduction of (r,r), (u,r), and (w,u)
+        LDT::dots(*W,*r,&dots[0]);
+        LDT::dots(*w,*u,&dots[2]);
+        allreduce_async(request,dots,3);
+
+        // m = M^{-1} w and n = A m while the reduction is in flight
+        apply_prec(*w,*m);
+        OPT::Apply(*b_A,*m,*n);
+
+        request.wait();
+
+        // Check for convergence
+        res_norm = std::sqrt(dots[0]);
+        if( res_norm/b_norm < b_tolerance )
+        {
+            b_converged = true;
+            break;
+        }
+
+        // Print status if requested
+        if( b_verbosity >= LinearSolver<T>::MEDIUM )
+        {
+            profugus::pout << b_label << " residual norm at iteration "
+                           << b_num_iters << " is "
+                           << profugus::scientific << profugus::setprecision(3)
+                           << res_norm/b_norm << profugus::endl;
+        }
+
+        // Check for max iterations
+        if( b_num_iters >= b_max_iters )
+            break;
+
+        // Step lengths
+        double gamma_new = dots[1];
+        double delta     = dots[2];
+        if( b_num_iters == 0 )
+        {
+            beta  = 0.0;
+            alpha = gamma_new / delta;
+        }
+        else
+        {
+            beta  = gamma_new / gamma;
+            alpha = gamma_new / (delta - beta * gamma_new / alpha);
+        }
+        gamma = gamma_new;
+
+        // z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p
+        MVT::MvAddMv(1.0,*n,beta,*z,*z);
+        MVT::MvAddMv(1.0,*m,beta,*q,*q);
+        MVT::MvAddMv(1.0,*w,beta,*s,*s);
+        MVT::MvAddMv(1.0,*u,beta,*p,*p);
+
+        // x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z
+        MVT::MvAddMv(1.0,*x,alpha,*p,*x);
+        MVT::MvAddMv(1.0,*r,-alpha,*s,*r);
+        MVT::MvAddMv(1.0,*u,-alpha,*q,*u);
+        MVT::MvAddMv(1.0,*w,-alpha,*z,*w);
+
+        b_num_iters++;
+    }
+
+    // Print final status
+    if( b_verbosity >= LinearSolver<T>::LOW )
+    {
+        if( b_converged )
+        {
+            profugus::pout << b_label << " converged after " << b_num_iters
+                           << " iterations." << profugus::endl;
+        }
+        else
+        {
+            profugus::pout << b_label << " terminated after " << b_num_iters
+                           << " iterations."  << profugus::endl
+                           << " Final residual norm is " << res_norm/b_norm
+                           << "." << profugus::endl
+                           << " Requested tolerance is " << b_tolerance << "."
+                           << profugus::endl;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the preconditioner, y = M^{-1} x.
+ */
+template <class T>
+void ConjugateGradient<T>::apply_prec(const MV &x, MV &y)
+{
+    if( d_P != Teuchos::null )
+    {
+        OPT::Apply(*d_P,x,y);
+    }
+    else
+    {
+        MVT::Assign(x,y);
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_solvers_ConjugateGradient_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of ConjugateGradient.t.hh
+//---------------------------------------------------------------------------//
@@ -24,6 +24,15 @@ namespace profugus
 /*!
  * \class Davidson_Eigensolver
  * \brief Solve k-eigenvalue problem using Generalized Davidson solver
+ *
+ * The solver is Anasazi's GeneralizedDavidsonSolMgr, controlled by the
+ * "Anasazi" sublist of the database.  With "Block Size" greater than 1 the
+ * subspace is expanded by a block of vectors per iteration: the operators
+ * and the preconditioner are applied once to the whole block of residuals,
+ * and the block is orthogonalized with "Orthogonalization" ("SVQB" by
+ * default), which uses dense block (BLAS-3) products instead of
+ * vector-by-vector Gram-Schmidt.  The "Maximum Subspace Dimension" must hold
+ * at least two blocks.
  */
 /*!
  * \example solvers/test/tstDavidson_Eigensolver.cc
@@ -55,6 +55,8 @@ Davidson_Eigensolver<T>::Davidson_Eigensolver(RCP_ParameterList db,
     anasazi_db->get("Restart Dimension",5);
     anasazi_db->get("Maximum Restarts",100);
     anasazi_db->get("Initial Guess",std::string("User"));
+    anasazi_db->get("Block Size",1);
+    anasazi_db->get("Orthogonalization",std::string("SVQB"));
 
     // Set verbosity of solver
     anasazi_db->get("Output Level", std::string("low"));
@@ -105,6 +107,14 @@ void Davidson_Eigensolver<T>::solve( double &keff, Teuchos::RCP<MV> x)
                                MultiVecTraits::GetGlobalLength(*x));
     }
 
+    // The subspace must hold at least two blocks for block expansion
+    int block_size = anasazi_list->get<int>("Block Size");
+    VALIDATE(block_size > 0, "Block Size must be positive.");
+    VALIDATE(anasazi_list->get<int>("Maximum Subspace Dimension") >=
+             2 * block_size,
+             "Maximum Subspace Dimension must be at least twice the "
+             "Block Size.");
+
     // Create solver
     Anasazi::GeneralizedDavidsonSolMgr<double,MV,OP> solver(
             problem, *anasazi_list);
@@ -0,0 +1,122 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/GMRES.hh
+ * \author agent
+ * \date   Mon Oct 19 03:33:56 2026
+ * \brief  GMRES class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_GMRES_hh
+#define SPn_solvers_GMRES_hh
+
+#include "harness/DBC.hh"
+#include "LinearSolver.hh"
+#include "LocalDotTraits.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziOperatorTraits.hpp"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class GMRES
+ * \brief Restarted, right-preconditioned, pipelined GMRES with one
+ * overlapped global reduction per iteration.
+ *
+ * Each Arnoldi step orthogonalizes the new Krylov vector with classical
+ * Gram-Schmidt.  The projections onto the basis and the norm of the new
+ * vector are computed together in one non-blocking reduction, and the norm
+ * of the orthogonalized vector follows from
+ * \f$\|\mathbf{w} - \mathbf{V}\mathbf{h}\|^2 = \mathbf{w}^T\mathbf{w} -
+ * \mathbf{h}^T\mathbf{h}\f$.  The operator and preconditioner for the next
+ * step are applied while the reduction is in flight, which requires storing
+ * the image of the basis under the preconditioned operator.  When more than
+ * half of \f$\|\mathbf{w}\|^2\f$ cancels, a second, blocking Gram-Schmidt
+ * pass (and reduction) is made and the image of the new basis vector is
+ * computed directly.  Modified Gram-Schmidt, by contrast, needs one blocking
+ * reduction per basis vector.
+ *
+ * The constructor takes in parameterlist.  The following entries are
+ * significant:
+ *  - ``tolerance''     The tolerance for the residual relative to the rhs.
+ *  - ``max_itr''       The maximum number of iterations to be performed.
+ *  - ``gmres_restart'' The Krylov subspace size before restarting (30).
+ * The memory requirement for this solver is \c 2*gmres_restart+3 vectors
+ * (not including the solution vector and rhs).  One additional vector is
+ * required if a preconditioner is used.
+ *
+ * \sa GMRES.t.hh for detailed descriptions.
+ */
+/*!
+ * \example solvers/test/tstGMRES.cc
+ *
+ * Test of GMRES.
+ */
+//===========================================================================//
+
+template <class T>
+class GMRES : public LinearSolver<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                        MV;
+    typedef typename T::OP                        OP;
+    typedef LinearSolver<T>                       Base;
+    typedef typename Base::ParameterList          ParameterList;
+    typedef typename Base::RCP_ParameterList      RCP_ParameterList;
+    typedef Anasazi::MultiVecTraits<double,MV>    MVT;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    //@}
+
+  public:
+    // Constructor
+    GMRES( RCP_ParameterList db );
+
+    // Solve
+    void solve( Teuchos::RCP<MV>       x,
+                Teuchos::RCP<const MV> b );
+
+    //! Set the (right) preconditioner.
+    void set_preconditioner( Teuchos::RCP<OP> P )
+    {
+        REQUIRE( P != Teuchos::null );
+        d_P = P;
+    }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    typedef LocalDotTraits<T> LDT;
+
+    // Apply y = A M^{-1} x using the work vector z (null without M).
+    void apply_op(const MV &x, MV &y, Teuchos::RCP<MV> z);
+
+  private:
+
+    Teuchos::RCP<OP> d_P;
+
+    using LinearSolver<T>::b_db;
+    using LinearSolver<T>::b_A;
+    using LinearSolver<T>::b_tolerance;
+    using LinearSolver<T>::b_num_iters;
+    using LinearSolver<T>::b_max_iters;
+    using LinearSolver<T>::b_converged;
+    using LinearSolver<T>::b_label;
+    using LinearSolver<T>::b_verbosity;
+
+    // Krylov subspace size.
+    int d_restart;
+};
+
+} // end namespace profugus
+
+#endif // SPn_solvers_GMRES_hh
+
+//---------------------------------------------------------------------------//
+//                 end of GMRES.hh
+//---------------------------------------------------------------------------//
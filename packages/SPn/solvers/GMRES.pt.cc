@@ -0,0 +1,29 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/GMRES.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:33:56 2026
+ * \brief  Explicit instantiation of GMRES solver.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "GMRES.t.hh"
+#include "Epetra_Operator.h"
+#include "Epetra_MultiVector.h"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "LinAlgTypedefs.hh"
+
+namespace profugus
+{
+
+template class GMRES<EpetraTypes>;
+template class GMRES<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of GMRES.pt.cc
+//---------------------------------------------------------------------------//
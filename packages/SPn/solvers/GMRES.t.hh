@@ -0,0 +1,339 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/GMRES.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:33:56 2026
+ * \brief  GMRES template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_GMRES_t_hh
+#define SPn_solvers_GMRES_t_hh
+
+#include <cmath>
+#include <vector>
+
+#include "Teuchos_SerialDenseMatrix.hpp"
+
+#include "comm/global.hh"
+#include "comm/P_Stream.hh"
+#include "GMRES.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build a native GMRES solver.
+ */
+template <class T>
+GMRES<T>::GMRES( RCP_ParameterList db )
+    : LinearSolver<T>(db)
+{
+    d_restart = b_db->get("gmres_restart", 30);
+    b_label   = "Profugus GMRES";
+
+    INSIST( d_restart > 0, "gmres_restart must be positive." );
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Solve a linear system using restarted GMRES.
+ *
+ * The residual is recomputed explicitly at each restart, and convergence
+ * is declared on the explicit residual.
+ *
+ * The Arnoldi process is pipelined with a depth of one (the p(1)-GMRES of
+ * Ghysels et al.): the image \f$\mathbf{z}_k = \mathbf{A}\mathbf{M}^{-1}
+ * \mathbf{v}_k\f$ of each basis vector is kept, so that
+ * \f$\mathbf{A}\mathbf{M}^{-1}\mathbf{z}_k\f$ can be applied while the
+ * Gram-Schmidt reduction on \f$\mathbf{z}_k\f$ is in flight.  The image of
+ * the next basis vector then follows from
+ * \f$\mathbf{z}_{k+1} = (\mathbf{A}\mathbf{M}^{-1}\mathbf{z}_k -
+ * \mathbf{Z}_k\mathbf{h})/h_{k+1,k}\f$.
+ */
+template <class T>
+void GMRES<T>::solve( Teuchos::RCP<MV>       x,
+                      Teuchos::RCP<const MV> b )
+{
+    REQUIRE( b_A != Teuchos::null );
+    REQUIRE( x   != Teuchos::null );
+    REQUIRE( b   != Teuchos::null );
+    REQUIRE( MVT::GetNumberVecs(*x) == 1 );
+
+    typedef Teuchos::SerialDenseMatrix<int,double> Dense_Matrix;
+
+    const int m = d_restart;
+
+    // Allocate the Krylov basis, its image Z = A M^{-1} V, and work vectors
+    Teuchos::RCP<MV> V = MVT::Clone(*x,m+1);
+    Teuchos::RCP<MV> Z = MVT::Clone(*x,m);
+    Teuchos::RCP<MV> t = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> u = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> z;
+    if( d_P != Teuchos::null )
+    {
+        z = MVT::Clone(*x,1);
+    }
+
+    // Hessenberg matrix, Givens rotations, and rotated residual
+    Dense_Matrix        H(m+1,m);
+    std::vector<double> cs(m), sn(m), g(m+1);
+
+    std::vector<double> tmp_nrm(1); // Temp storage for vector norm.
+    std::vector<int>    ind;
+    Request             request;
+
+    MVT::MvNorm(*b,tmp_nrm);
+    double b_norm   = tmp_nrm[0];
+    double res_norm = b_norm;
+
+    b_converged = false;
+    b_num_iters = 0;
+
+    // If the RHS is zero, set solution to zero and return
+    if( b_norm == 0.0 )
+    {
+        MVT::MvInit(*x,0.0);
+        b_converged = true;
+        return;
+    }
+
+    while( true )
+    {
+        // Compute residual into the first basis vector
+        ind.assign(1,0);
+        Teuchos::RCP<MV> v0 = MVT::CloneViewNonConst(*V,ind);
+        OPT::Apply(*b_A,*x,*v0);
+        MVT::MvAddMv(1.0,*b,-1.0,*v0,*v0);
+
+        // Check for convergence
+        MVT::MvNorm(*v0,tmp_nrm);
+        res_norm = tmp_nrm[0];
+        if( res_norm/b_norm < b_tolerance )
+        {
+            b_converged = true;
+            break;
+        }
+
+        // Check for max iterations
+        if( b_num_iters >= b_max_iters )
+            break;
+
+        MVT::MvScale(*v0,1.0/res_norm);
+        H.putScalar(0.0);
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = res_norm;
+
+        // z_0 = A M^{-1} v_0
+        Teuchos::RCP<MV> z0 = MVT::CloneViewNonConst(*Z,ind);
+        apply_op(*v0,*z0,z);
+
+        // Arnoldi steps
+        int k = 0;
+        while( k < m && b_num_iters < b_max_iters )
+        {
+            // Views of z_k = A M^{-1} v_k, the basis V_k = [v_0..v_k], and
+            // Z_k = [z_0..z_k]
+            ind.assign(1,k);
+            Teuchos::RCP<const MV> zk = MVT::CloneView(*Z,ind);
+            ind.resize(k+1);
+            for( int i=0; i<=k; ++i )
+                ind[i] = i;
+            Teuchos::RCP<const MV> Vk = MVT::CloneView(*V,ind);
+            Teuchos::RCP<const MV> Zk = MVT::CloneView(*Z,ind);
+
+            // Start the reduction of the projections onto the basis and of
+            // z_k.z_k
+            std::vector<double> c(k+2);
+            LDT::dots(*Vk,*zk,&c[0]);
+            LDT::dots(*zk,*zk,&c[k+1]);
+            allreduce_async(request,&c[0],k+2);
+
+            // While the reduction is in flight, t = A M^{-1} z_k for the
+            // next step (if there can be one)
+            bool next = k+1 < m && b_num_iters+1 < b_max_iters;
+            if( next )
+                apply_op(*zk,*t,z);
+
+            request.wait();
+
+            // w = z_k - V_k h
+            Dense_Matrix h(k+1,1);
+            for( int i=0; i<=k; ++i )
+                h(i,0) = c[i];
+            ind.assign(1,k+1);
+            Teuchos::RCP<MV> w = MVT::CloneViewNonConst(*V,ind);
+            MVT::Assign(*zk,*w);
+            MVT::MvTimesMatAddMv(-1.0,*Vk,h,1.0,*w);
+
+            double w_norm2 = c[k+1];
+            double h_norm2 = 0.0;
+            for( int i=0; i<=k; ++i )
+                h_norm2 += h(i,0)*h(i,0);
+            double nrm2 = w_norm2 - h_norm2;
+
+            // Reorthogonalize when more than half of the norm cancels; this
+            // pass is a second, blocking reduction
+            bool reorth = nrm2 <= 0.5*w_norm2;
+            if( reorth )
+            {
+                ind.resize(k+2);
+                for( int i=0; i<=k+1; ++i )
+                    ind[i] = i;
+                Teuchos::RCP<const MV> Vw = MVT::CloneView(*V,ind);
+
+                Dense_Matrix cw(k+2,1);
+                MVT::MvTransMv(1.0,*Vw,*w,cw);
+                Dense_Matrix dh(Teuchos::Copy,cw,k+1,1);
+                MVT::MvTimesMatAddMv(-1.0,*Vk,dh,1.0,*w);
+
+                nrm2 = cw(k+1,0);
+                for( int i=0; i<=k; ++i )
+                {
+                    h(i,0) += dh(i,0);
+                    nrm2   -= dh(i,0)*dh(i,0);
+                }
+            }
+            double nrm = nrm2 > 0.0 ? std::sqrt(nrm2) : 0.0;
+
+            // Normalize the new basis vector, v_{k+1} = w/nrm
+            if( nrm > 0.0 )
+                MVT::MvScale(*w,1.0/nrm);
+
+            // z_{k+1} = A M^{-1} v_{k+1} = (t - Z_k h)/nrm; the recurrence
+            // does not hold for a reorthogonalized vector, so its image is
+            // computed directly
+            if( next && nrm > 0.0 )
+            {
+                ind.assign(1,k+1);
+                Teuchos::RCP<MV> zn = MVT::CloneViewNonConst(*Z,ind);
+                if( reorth )
+                {
+                    apply_op(*w,*zn,z);
+                }
+                else
+                {
+                    MVT::Assign(*t,*zn);
+                    MVT::MvTimesMatAddMv(-1.0,*Zk,h,1.0,*zn);
+                    MVT::MvScale(*zn,1.0/nrm);
+                }
+            }
+
+            // Apply previous rotations to the new Hessenberg column
+            for( int i=0; i<=k; ++i )
+                H(i,k) = h(i,0);
+            H(k+1,k) = nrm;
+            for( int i=0; i<k; ++i )
+            {
+                double tmp = cs[i]*H(i,k) + sn[i]*H(i+1,k);
+                H(i+1,k)   = -sn[i]*H(i,k) + cs[i]*H(i+1,k);
+                H(i,k)     = tmp;
+            }
+
+            // Compute and apply the new rotation
+            double r = std::sqrt(H(k,k)*H(k,k) + H(k+1,k)*H(k+1,k));
+            cs[k]    = H(k,k)/r;
+            sn[k]    = H(k+1,k)/r;
+            H(k,k)   = r;
+            H(k+1,k) = 0.0;
+            g[k+1]   = -sn[k]*g[k];
+            g[k]     = cs[k]*g[k];
+
+            ++k;
+            ++b_num_iters;
+
+            // Residual estimate
+            res_norm = std::abs(g[k]);
+            if( b_verbosity >= LinearSolver<T>::MEDIUM )
+            {
+                profugus::pout << b_label << " residual norm at iteration "
+                               << b_num_iters << " is "
+                               << profugus::scientific
+                               << profugus::setprecision(3)
+                               << res_norm/b_norm << profugus::endl;
+            }
+
+            if( res_norm/b_norm < b_tolerance || nrm == 0.0 )
+                break;
+        }
+
+        // Solve the (triangular) least-squares problem, H y = g
+        Dense_Matrix y(k,1);
+        for( int i=k-1; i>=0; --i )
+        {
+            double sum = g[i];
+            for( int j=i+1; j<k; ++j )
+                sum -= H(i,j)*y(j,0);
+            y(i,0) = sum/H(i,i);
+        }
+
+        // x = x + M^{-1} V_k y
+        ind.resize(k);
+        for( int i=0; i<k; ++i )
+            ind[i] = i;
+        Teuchos::RCP<const MV> Vk = MVT::CloneView(*V,ind);
+        MVT::MvTimesMatAddMv(1.0,*Vk,y,0.0,*u);
+        if( d_P != Teuchos::null )
+        {
+            OPT::Apply(*d_P,*u,*z);
+            MVT::MvAddMv(1.0,*x,1.0,*z,*x);
+        }
+        else
+        {
+            MVT::MvAddMv(1.0,*x,1.0,*u,*x);
+        }
+    }
+
+    // Print final status
+    if( b_verbosity >= LinearSolver<T>::LOW )
+    {
+        if( b_converged )
+        {
+            profugus::pout << b_label << " converged after " << b_num_iters
+                           << " iterations." << profugus::endl;
+        }
+        else
+        {
+            profugus::pout << b_label << " terminated after " << b_num_iters
+                           << " iterations."  << profugus::endl
+                           << " Final residual norm is " << res_norm/b_norm
+                           << "." << profugus::endl
+                           << " Requested tolerance is " << b_tolerance << "."
+                           << profugus::endl;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the right-preconditioned operator, y = A M^{-1} x.
+ */
+template <class T>
+void GMRES<T>::apply_op(const MV &x, MV &y, Teuchos::RCP<MV> z)
+{
+    if( d_P != Teuchos::null )
+    {
+        OPT::Apply(*d_P,x,*z);
+        OPT::Apply(*b_A,*z,y);
+    }
+    else
+    {
+        OPT::Apply(*b_A,x,y);
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_solvers_GMRES_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of GMRES.t.hh
+//---------------------------------------------------------------------------//
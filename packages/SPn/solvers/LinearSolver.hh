@@ -127,6 +127,13 @@ class LinearSolver
     // Did last solver meet convergence tolerance?
     virtual bool converged() const { return b_converged; }
 
+    // Can solve() be given a block of right-hand sides at once?
+    virtual bool supports_blocks() const { return false; }
+
+    // Should the operator be given as the preconditioner when there is no
+    // other (so that the solver can build one from the matrix)?
+    virtual bool uses_operator_preconditioner() const { return true; }
+
     // Return solver label
     virtual const std::string & solver_label() const { return b_label; }
 
@@ -19,6 +19,9 @@
 #include "BelosSolver.hh"
 #include "StratimikosSolver.hh"
 #include "Richardson.hh"
+#include "GMRES.hh"
+#include "ConjugateGradient.hh"
+#include "Chebyshev.hh"
 
 namespace profugus
 {
@@ -34,7 +37,13 @@ namespace profugus
  * If that entry exists, the corresponding solver type will be built.
  * If not, we look for database entries "profugus_solver" and build the
  * appropriate class.
- * Current valid "profugus_solver" options are "Richardson".
+ * Current valid "profugus_solver" options are "Richardson", "GMRES", "CG",
+ * and "Chebyshev".  The native CG solver makes a single global reduction
+ * per iteration, and it is overlapped with the operator and preconditioner
+ * applications.  The native GMRES solver makes one overlapped reduction per
+ * iteration plus a second, blocking reduction on iterations where selective
+ * reorthogonalization is triggered.  Chebyshev makes no reductions after
+ * its setup.
  *
  */
 //---------------------------------------------------------------------------//
@@ -62,10 +71,23 @@ LinearSolverBuilder<T>::build_solver( RCP_ParameterList db )
         {
             solver = Teuchos::rcp( new Richardson<T>(db));
         }
+        else if (type == "gmres")
+        {
+            solver = Teuchos::rcp( new GMRES<T>(db));
+        }
+        else if (type == "cg")
+        {
+            solver = Teuchos::rcp( new ConjugateGradient<T>(db));
+        }
+        else if (type == "chebyshev")
+        {
+            solver = Teuchos::rcp( new Chebyshev<T>(db));
+        }
         else
         {
             VALIDATE(false, "Invalid 'profugus_solver' type of "
-                      << type << " entered.  Valid entries are 'richardson'");
+                      << type << " entered.  Valid entries are 'richardson', "
+                      "'gmres', 'cg', and 'chebyshev'");
         }
     }
     else if (solver_type == "stratimikos")
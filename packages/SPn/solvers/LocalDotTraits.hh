@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/LocalDotTraits.hh
+ * \author agent
+ * \date   Mon Oct 19 04:30:52 2026
+ * \brief  LocalDotTraits class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_solvers_LocalDotTraits_hh
+#define SPn_solvers_LocalDotTraits_hh
+
+#include "Teuchos_ArrayRCP.hpp"
+
+#include "harness/DBC.hh"
+#include "LinAlgTypedefs.hh"
+
+namespace profugus
+{
+
+template <class T>
+class UndefinedLocalDotTraits
+{
+    void NotDefined(){T::this_class_is_missing_a_specialization();}
+};
+
+//===========================================================================//
+/*!
+ * \class LocalDotTraits
+ * \brief On-process inner products of Epetra/Tpetra multivectors.
+ *
+ * Anasazi::MultiVecTraits only provides inner products that are globally
+ * reduced before they return.  The pipelined Krylov solvers instead compute
+ * the on-process contributions here and sum them with
+ * profugus::allreduce_async so that the reduction can be overlapped with
+ * operator applications.
+ */
+//===========================================================================//
+template <class T>
+class LocalDotTraits
+{
+  public:
+
+    typedef typename T::MV MV;
+
+    //\brief On-process dots of each column of A with the vector b
+    static void dots( const MV &A, const MV &b, double *c )
+    {
+        UndefinedLocalDotTraits<T>::NotDefined();
+    }
+};
+
+// Specialization for Epetra
+template <>
+class LocalDotTraits<EpetraTypes>
+{
+  public:
+
+    typedef EpetraTypes::MV MV;
+
+    //\brief On-process dots of each column of A with the vector b
+    static void dots( const MV &A, const MV &b, double *c )
+    {
+        REQUIRE( b.NumVectors() == 1 );
+        REQUIRE( A.MyLength() == b.MyLength() );
+        REQUIRE( c );
+
+        const int     N  = A.MyLength();
+        const double *bv = b[0];
+        for( int j = 0; j < A.NumVectors(); ++j )
+        {
+            const double *av = A[j];
+
+            c[j] = 0.0;
+            for( int i = 0; i < N; ++i )
+                c[j] += av[i] * bv[i];
+        }
+    }
+};
+
+// Specialization for Tpetra
+template <>
+class LocalDotTraits<TpetraTypes>
+{
+  public:
+
+    typedef TpetraTypes::ST ST;
+    typedef TpetraTypes::MV MV;
+
+    //\brief On-process dots of each column of A with the vector b
+    static void dots( const MV &A, const MV &b, double *c )
+    {
+        REQUIRE( b.getNumVectors() == 1 );
+        REQUIRE( A.getLocalLength() == b.getLocalLength() );
+        REQUIRE( c );
+
+        const size_t N = A.getLocalLength();
+        Teuchos::ArrayRCP<const ST> bv = b.getData(0);
+        for( size_t j = 0; j < A.getNumVectors(); ++j )
+        {
+            Teuchos::ArrayRCP<const ST> av = A.getData(j);
+
+            c[j] = 0.0;
+            for( size_t i = 0; i < N; ++i )
+                c[j] += av[i] * bv[i];
+        }
+    }
+};
+
+} // end namespace profugus
+
+#endif // SPn_solvers_LocalDotTraits_hh
+
+//---------------------------------------------------------------------------//
+//                 end of LocalDotTraits.hh
+//---------------------------------------------------------------------------//
@@ -27,8 +27,10 @@ namespace profugus
  *
  * The constructor takes in an SP to a Std_DB.  The following entries are
  * significant:
- *  - ``tolerance'' The tolerance for the relative residual.
- *  - ``max_itr''   The maximum number of iterations to be performed.
+ *  - ``tolerance''       The tolerance for the relative residual.
+ *  - ``max_itr''         The maximum number of iterations to be performed.
+ *  - ``check_frequency'' Number of iterations between convergence checks
+ *                        (default 1).
  *
  * \sa PowerIteration.t.hh for detailed descriptions.
  */
@@ -64,6 +66,12 @@ class PowerIteration : public EigenvalueSolver<T>
 
   private:
 
+    // Print the eigenvalue and residual norm of the current iteration.
+    void print_status( double lambda, double res_norm ) const;
+
+    // Iterations between convergence checks.
+    int d_check_freq;
+
     using EigenvalueSolver<T>::b_db;
     using EigenvalueSolver<T>::b_A;
     using EigenvalueSolver<T>::b_tolerance;
@@ -11,8 +11,12 @@
 #ifndef SPn_solvers_PowerIteration_t_hh
 #define SPn_solvers_PowerIteration_t_hh
 
+#include <cmath>
 #include <vector>
 
+#include "Teuchos_SerialDenseMatrix.hpp"
+
+#include "harness/DBC.hh"
 #include "comm/P_Stream.hh"
 #include "PowerIteration.hh"
 
@@ -29,6 +33,9 @@ template <class T>
 PowerIteration<T>::PowerIteration( RCP_ParameterList db )
     : EigenvalueSolver<T>(db)
 {
+    d_check_freq = b_db->get("check_frequency", 1);
+    INSIST( d_check_freq > 0, "check_frequency must be positive." );
+
     b_label = "Power Iteration";
 }
 
@@ -36,7 +43,16 @@ PowerIteration<T>::PowerIteration( RCP_ParameterList db )
 // PUBLIC INTERFACE
 //---------------------------------------------------------------------------//
 /*!
- * \brief Solver a linear system using bicgstab.
+ * \brief Solve an eigenvalue problem using power iteration.
+ *
+ * The iterate, \f$\mathbf{A}\mathbf{x}\f$, and the residual are stored as
+ * the columns of one multivector so that the Rayleigh quotient, the norm of
+ * \f$\mathbf{A}\mathbf{x}\f$, and the residual norm are computed with a
+ * single (global) reduction per iteration.  The residual norm of iteration
+ * \e k is therefore available only after the operator is applied in
+ * iteration \e k+1; when iteration \e k is converged the eigenvalue and
+ * eigenvector of iteration \e k are returned, so the sequence of iterates
+ * is the same as evaluating the residual at every iteration.
  */
 template <class T>
 void PowerIteration<T>::solve( double           &lambda,
@@ -45,13 +61,19 @@ void PowerIteration<T>::solve( double           &lambda,
     REQUIRE( !b_A.is_null() );
     REQUIRE( !x.is_null() );
 
-    // Allocate necessary vectors
-    Teuchos::RCP<MV> Ax = MVT::Clone(*x,1);
-    Teuchos::RCP<MV> r  = MVT::Clone(*x,1);
+    // Allocate the work vectors, W = [x, Ax, r]
+    Teuchos::RCP<MV> W = MVT::Clone(*x,3);
+    std::vector<int> ind(1);
+    ind[0] = 0;
+    Teuchos::RCP<MV> xk = MVT::CloneViewNonConst(*W,ind);
+    ind[0] = 1;
+    Teuchos::RCP<MV> Ax = MVT::CloneViewNonConst(*W,ind);
+    ind[0] = 2;
+    Teuchos::RCP<MV> r  = MVT::CloneViewNonConst(*W,ind);
 
-    std::vector<double> tmp_dot(1); // Temp storage for dot product.
     std::vector<double> tmp_nrm(1); // Temp storage for vector norm.
-    double res_norm;
+    Teuchos::SerialDenseMatrix<int,double> G(3,3); // Gram matrix of W.
+    double res_norm = 0.0;
 
     // Normalize initial vector, if it is all zeros set it to a constant
     MVT::MvNorm(*x,tmp_nrm);
@@ -60,53 +82,69 @@ void PowerIteration<T>::solve( double           &lambda,
         MVT::MvInit(*x,1.0);
         MVT::MvNorm(*x,tmp_nrm);
     }
-    MVT::MvScale(*x,1.0/tmp_nrm[0]);
+    MVT::Assign(*x,*xk);
+    MVT::MvScale(*xk,1.0/tmp_nrm[0]);
+    MVT::MvInit(*r,0.0);
 
     b_converged = false;
     b_num_iters = 0;
 
+    // Residual of the previous iteration is pending a convergence check
+    bool check = false;
+
     while( true )
     {
-        b_num_iters++;
-
         // Ax = A*x
-        OPT::Apply(*b_A,*x,*Ax);
-
-        // Compute new eigenvalue as Rayleigh quotient
-        MVT::MvDot(*x,*Ax,tmp_dot);
-        lambda = tmp_dot[0];
+        OPT::Apply(*b_A,*xk,*Ax);
 
-        // Compute residual
-        MVT::MvAddMv(1.0,*Ax,-lambda,*x,*r);
-        MVT::MvNorm(*r,tmp_nrm);
-        res_norm = tmp_nrm[0];
+        // Rayleigh quotient (x.Ax), norm of Ax, and residual norm of the
+        // previous iteration in one reduction
+        MVT::MvTransMv(1.0,*W,*W,G);
 
-        if( b_verbosity >= EigenvalueSolver<T>::LOW )
+        // Check convergence of the previous iteration
+        if( check )
         {
-            profugus::pout << " Power Iteration eigenvalue at iteration "
-                           << b_num_iters << " is "
-                           << profugus::fixed << profugus::setprecision(8)
-                           << lambda << " with a residual norm of "
-                           << profugus::scientific << profugus::setprecision(3)
-                           << res_norm << profugus::endl;
+            res_norm = std::sqrt(G(2,2));
+            print_status(lambda,res_norm);
+
+            if( res_norm < b_tolerance )
+            {
+                b_converged = true;
+                break;
+            }
         }
 
-        // Set new eigenvector and normalize
-        MVT::Assign(*Ax,*x);
-        MVT::MvNorm(*x,tmp_nrm);
-        MVT::MvScale(*x,1.0/tmp_nrm[0]);
+        b_num_iters++;
 
-        // Check for convergence
-        if( res_norm < b_tolerance )
+        // New eigenvalue as Rayleigh quotient
+        lambda = G(0,1);
+
+        // Compute residual when it will be checked
+        check = (b_num_iters % d_check_freq == 0) ||
+                (b_num_iters >= b_max_iters);
+        if( check )
         {
-            b_converged = true;
-            break;
+            MVT::MvAddMv(1.0,*Ax,-lambda,*xk,*r);
         }
 
+        // Set new eigenvector and normalize
+        MVT::Assign(*Ax,*xk);
+        MVT::MvScale(*xk,1.0/std::sqrt(G(1,1)));
+
+        // Check the last iteration without applying the operator again
         if( b_num_iters >= b_max_iters )
+        {
+            MVT::MvNorm(*r,tmp_nrm);
+            res_norm = tmp_nrm[0];
+            print_status(lambda,res_norm);
+
+            b_converged = (res_norm < b_tolerance);
             break;
+        }
     }
 
+    MVT::Assign(*xk,*x);
+
     if( b_verbosity >= EigenvalueSolver<T>::MEDIUM )
     {
         profugus::pout << "+++ Power Iteration converged in "
@@ -114,6 +152,27 @@ void PowerIteration<T>::solve( double           &lambda,
     }
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Print the eigenvalue and residual norm of the current iteration.
+ */
+template <class T>
+void PowerIteration<T>::print_status( double lambda,
+                                      double res_norm ) const
+{
+    if( b_verbosity >= EigenvalueSolver<T>::LOW )
+    {
+        profugus::pout << " Power Iteration eigenvalue at iteration "
+                       << b_num_iters << " is "
+                       << profugus::fixed << profugus::setprecision(8)
+                       << lambda << " with a residual norm of "
+                       << profugus::scientific << profugus::setprecision(3)
+                       << res_norm << profugus::endl;
+    }
+}
+
 } // end namespace profugus
 
 #endif // SPn_solvers_PowerIteration_t_hh
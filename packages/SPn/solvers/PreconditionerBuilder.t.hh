@@ -66,6 +66,10 @@ PreconditionerBuilder<EpetraTypes>::build_preconditioner(
              prec_type=="none",
              "Preconditioner must be 'Ifpack', 'ML', or 'None'.");
 
+    // No preconditioner (the operator need not be a matrix)
+    if( prec_type == "none" )
+        return Teuchos::null;
+
     // Get the underlying matrix, must be Epetra_RowMatrix
     Teuchos::RCP<Epetra_RowMatrix> rowmat =
         Teuchos::rcp_dynamic_cast<Epetra_RowMatrix>(op);
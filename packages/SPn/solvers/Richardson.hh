@@ -30,6 +30,8 @@ namespace profugus
  *  - ``tolerance'' The tolerance for the relative residual.
  *  - ``max_itr''   The maximum number of iterations to be performed.
  *  - ``damping''   Damping factor applied to iterates.
+ *  - ``check_frequency'' Number of iterations between convergence checks
+ *                        (default 1).
  * The memory requirement for this solver is three vectors (including the
  * solution vector and rhs, which are allocated outside of this class).
  * One additional vector is required if a preconditioner is used.
@@ -88,6 +90,9 @@ class Richardson : public LinearSolver<T>
     using LinearSolver<T>::b_verbosity;
 
     double d_damping;
+
+    // Iterations between convergence checks.
+    int d_check_freq;
 };
 
 } // end namespace profugus
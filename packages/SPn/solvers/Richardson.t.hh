@@ -29,8 +29,11 @@ template <class T>
 Richardson<T>::Richardson( RCP_ParameterList db )
     : LinearSolver<T>(db)
 {
-    d_damping = b_db->get("Damping Factor", 1.0);
-    b_label   = "Profugus Richardson";
+    d_damping    = b_db->get("Damping Factor", 1.0);
+    d_check_freq = b_db->get("check_frequency", 1);
+    b_label      = "Profugus Richardson";
+
+    INSIST( d_check_freq > 0, "check_frequency must be positive." );
 }
 
 //---------------------------------------------------------------------------//
@@ -38,6 +41,10 @@ Richardson<T>::Richardson( RCP_ParameterList db )
 //---------------------------------------------------------------------------//
 /*!
  * \brief Solve a linear system using damped Richardson iteration.
+ *
+ * The residual norm, which is the only global reduction in an iteration, is
+ * computed every "check_frequency" iterations (and before the last
+ * iteration).
  */
 template <class T>
 void Richardson<T>::solve( Teuchos::RCP<MV>       x,
@@ -59,8 +66,8 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
     std::vector<double> tmp_nrm(1); // Temp storage for vector norm.
 
     MVT::MvNorm(*b,tmp_nrm);
-    double b_norm = tmp_nrm[0];
-    double res_norm;
+    double b_norm   = tmp_nrm[0];
+    double res_norm = b_norm;
 
     b_converged = false;
     b_num_iters = 0;
@@ -89,21 +96,26 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
         }
 
         // Check for convergence
-        MVT::MvNorm(*r,tmp_nrm);
-        res_norm = tmp_nrm[0];
-        if( res_norm/b_norm < b_tolerance )
-        {
-            b_converged = true;
-            break;
-        }
-
-        // Print status if requested
-        if( b_verbosity >= LinearSolver<T>::MEDIUM )
+        if( (b_num_iters % d_check_freq == 0) ||
+            (b_num_iters + 1 >= b_max_iters) )
         {
-            profugus::pout << b_label << " residual norm at iteration "
-                           << b_num_iters << " is "
-                           << profugus::scientific << profugus::setprecision(3)
-                           << res_norm/b_norm << profugus::endl;
+            MVT::MvNorm(*r,tmp_nrm);
+            res_norm = tmp_nrm[0];
+            if( res_norm/b_norm < b_tolerance )
+            {
+                b_converged = true;
+                break;
+            }
+
+            // Print status if requested
+            if( b_verbosity >= LinearSolver<T>::MEDIUM )
+            {
+                profugus::pout << b_label << " residual norm at iteration "
+                               << b_num_iters << " is "
+                               << profugus::scientific
+                               << profugus::setprecision(3)
+                               << res_norm/b_norm << profugus::endl;
+            }
         }
 
         // x = x + omega*r
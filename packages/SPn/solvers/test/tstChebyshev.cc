@@ -0,0 +1,167 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/solvers/test/tstChebyshev.cc
+ * \author agent
+ * \date   Mon Oct 19 04:07:38 2026
+ * \brief  Chebyshev unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "gtest/utils_gtest.hh"
+
+#include <vector>
+
+#include "Teuchos_ScalarTraits.hpp"
+
+#include <SPn/config.h>
+#include "../Chebyshev.hh"
+
+#include "LinAlgTraits.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture base class
+//---------------------------------------------------------------------------//
+
+template <class T>
+class ChebyshevTest : public testing::Test
+{
+  protected:
+
+    typedef typename T::MV       MV;
+    typedef typename T::OP       OP;
+    typedef typename T::MATRIX   MATRIX;
+
+    typedef profugus::Chebyshev<T>             Chebyshev;
+    typedef Anasazi::MultiVecTraits<double,MV> MVT;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+
+  protected:
+    // Initialization that are performed for each test
+    void SetUp()
+    {
+        // Build a map
+        d_N = 8;
+        d_A = linalg_traits::build_matrix<T>("laplacian",d_N);
+
+        // Build lhs and rhs vectors
+        d_x = linalg_traits::build_vector<T>(d_N);
+        d_b = linalg_traits::build_vector<T>(d_N);
+        std::vector<double> vals(d_N);
+        for( int i=0; i<d_N; ++i )
+            vals[i] = static_cast<double>(4*(8-i));
+        linalg_traits::fill_vector<T>(d_b,vals);
+
+        // Create options database
+        d_db = Teuchos::rcp(new Teuchos::ParameterList("test"));
+    }
+
+    void build()
+    {
+        d_solver = Teuchos::rcp(new Chebyshev(d_db));
+        d_solver->set_operator(d_A);
+    }
+
+    // Relative residual norm of the current solution.
+    double residual()
+    {
+        Teuchos::RCP<MV> r = MVT::Clone(*d_x,1);
+        OPT::Apply(*d_A,*d_x,*r);
+        MVT::MvAddMv(1.0,*d_b,-1.0,*r,*r);
+
+        std::vector<double> r_norm(1), b_norm(1);
+        MVT::MvNorm(*r,r_norm);
+        MVT::MvNorm(*d_b,b_norm);
+        return r_norm[0] / b_norm[0];
+    }
+
+  protected:
+    int d_N;
+
+    Teuchos::RCP<Teuchos::ParameterList> d_db;
+    Teuchos::RCP<MATRIX>                 d_A;
+    Teuchos::RCP<MV>                     d_x;
+    Teuchos::RCP<MV>                     d_b;
+    Teuchos::RCP<Chebyshev>              d_solver;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+using profugus::EpetraTypes;
+using profugus::TpetraTypes;
+typedef ::testing::Types<EpetraTypes,TpetraTypes> MyTypes;
+TYPED_TEST_CASE(ChebyshevTest, MyTypes);
+
+TYPED_TEST(ChebyshevTest, solve)
+{
+    // The spectrum of the laplacian is [0.1206, 3.8794]; a polynomial on an
+    // interval containing it converges to the solution
+    this->d_db->set("max_itr",60);
+    this->d_db->set("Max Eigenvalue",3.9);
+    this->d_db->set("Eigenvalue Ratio",3.9/0.12);
+    this->build();
+
+    std::vector<double> zero(this->d_N,0.0);
+    linalg_traits::fill_vector<TypeParam>(this->d_x,zero);
+    this->d_solver->solve(this->d_x,this->d_b);
+
+    EXPECT_EQ( 60, this->d_solver->num_iters() );
+    EXPECT_TRUE( this->d_solver->converged() );
+    EXPECT_SOFTEQ( 3.9, this->d_solver->lambda_max(), 1.0e-12 );
+
+    // Reference solution from Matlab
+    std::vector<double> ref = {
+        90.6666666666667,
+       149.3333333333333,
+       180.0000000000000,
+       186.6666666666666,
+       173.3333333333333,
+       144.0000000000000,
+       102.6666666666666,
+        53.3333333333333};
+
+    linalg_traits::test_vector<TypeParam>(this->d_x,ref);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(ChebyshevTest, smooth)
+{
+    // Low-degree smoother (the default degree) with an estimated spectrum;
+    // the random power-iteration start vector is seeded so the estimate is
+    // reproducible
+    Teuchos::ScalarTraits<double>::seedrandom(12345);
+    this->build();
+    EXPECT_EQ( 0.0, this->d_solver->lambda_max() );
+
+    std::vector<double> zero(this->d_N,0.0);
+    linalg_traits::fill_vector<TypeParam>(this->d_x,zero);
+    this->d_solver->solve(this->d_x,this->d_b);
+
+    EXPECT_EQ( 3, this->d_solver->num_iters() );
+
+    // Power iteration bounds the largest eigenvalue from below before the
+    // safety factor is applied
+    double lambda = this->d_solver->lambda_max();
+    EXPECT_GT( lambda, 3.0 );
+    EXPECT_LE( lambda, 1.1 * 3.8793852415718 + 1.0e-12 );
+
+    // The residual is reduced but not converged
+    double res = this->residual();
+    EXPECT_LT( res, 0.7 );
+    EXPECT_GT( res, 0.1 );
+
+    // The estimate is kept for later solves
+    this->d_solver->solve(this->d_x,this->d_b);
+    EXPECT_EQ( lambda, this->d_solver->lambda_max() );
+    EXPECT_LT( this->residual(), res );
+
+    // and reset with a new operator
+    this->d_solver->set_operator(this->d_A);
+    EXPECT_EQ( 0.0, this->d_solver->lambda_max() );
+}
+
+//---------------------------------------------------------------------------//
+//                        end of tstChebyshev.cc
+//---------------------------------------------------------------------------//
@@ -126,6 +126,30 @@ TYPED_TEST(DavidsonTest, basic)
     linalg_traits::test_vector<TypeParam>(this->d_x,ref_eigenvector);
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(DavidsonTest, block)
+{
+    double eig_tol = 1e-10;
+
+    // expand the subspace by two vectors per iteration
+    this->build_solver();
+    Teuchos::ParameterList &adb = this->d_db->sublist("Anasazi");
+    adb.set("Block Size", 2);
+    adb.set("Maximum Subspace Dimension", 10);
+    adb.set("Restart Dimension", 4);
+
+    std::vector<double> one(this->d_N,1.0);
+    linalg_traits::fill_vector<TypeParam>(this->d_x,one);
+    this->d_lambda = 1.0;
+    this->solve();
+
+    EXPECT_TRUE( this->d_converged );
+    EXPECT_SOFTEQ( this->d_lambda, ref_eigenvalue, eig_tol );
+    linalg_traits::set_sign<TypeParam>(this->d_x);
+    linalg_traits::test_vector<TypeParam>(this->d_x,ref_eigenvector);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstDavidsonEigensolver.cc
 //---------------------------------------------------------------------------//
@@ -18,6 +18,8 @@
 
 #include "../LinearSolverBuilder.hh"
 #include "../Richardson.hh"
+#include "../GMRES.hh"
+#include "../ConjugateGradient.hh"
 #include "../StratimikosSolver.hh"
 #include "LinAlgTraits.hh"
 
@@ -91,6 +93,25 @@ TYPED_TEST(SolverBuilderTest, basic)
     rich = Teuchos::rcp_dynamic_cast<profugus::Richardson<TypeParam> >(this->d_solver);
     EXPECT_TRUE( rich != Teuchos::null );
 
+    //
+    // Native single-reduction Krylov solvers
+    //
+
+    db = Teuchos::rcp(new Teuchos::ParameterList("test_db"));
+    db->set("solver_type", std::string("Profugus"));
+    db->set("profugus_solver", std::string("GMRES"));
+    this->build_solver(db);
+    EXPECT_EQ("Profugus GMRES", this->d_solver->solver_label());
+    EXPECT_TRUE( Teuchos::rcp_dynamic_cast<profugus::GMRES<TypeParam> >(
+                     this->d_solver) != Teuchos::null );
+
+    db->set("profugus_solver", std::string("CG"));
+    this->build_solver(db);
+    EXPECT_EQ("Profugus CG", this->d_solver->solver_label());
+    EXPECT_TRUE(
+        Teuchos::rcp_dynamic_cast<profugus::ConjugateGradient<TypeParam> >(
+            this->d_solver) != Teuchos::null );
+
     //
     // Stratimikos solver (default is AztecOO)
     //
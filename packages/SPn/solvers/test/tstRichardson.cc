@@ -126,6 +126,26 @@ TYPED_TEST(RichardsonTest, basic)
     linalg_traits::test_vector<TypeParam>(this->d_x,ref);
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RichardsonTest, check_frequency)
+{
+    typedef typename TestFixture::Richardson Richardson;
+
+    // Check convergence every 4 iterations
+    this->d_db->set("check_frequency",4);
+    this->d_db->set("max_itr",1000);
+    this->d_solver = Teuchos::rcp(new Richardson(this->d_db));
+    this->d_solver->set_operator(this->d_A);
+    this->solve();
+
+    // Convergence can only be detected on a checked iteration
+    EXPECT_TRUE( this->d_converged );
+    EXPECT_EQ( 0, this->d_iters % 4 );
+    EXPECT_LE( 294, this->d_iters );
+    EXPECT_GT( 294 + 4, this->d_iters );
+}
+
 //---------------------------------------------------------------------------//
 //                        end of tstRichardson.cc
 //---------------------------------------------------------------------------//
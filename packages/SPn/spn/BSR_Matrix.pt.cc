@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/BSR_Matrix.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:25:24 2026
+ * \brief  BSR_Matrix and BSR_Block_Jacobi explicit instantiation.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "BSR_Matrix.t.hh"
+#include "solvers/LinAlgTypedefs.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+namespace profugus
+{
+
+template class BSR_Matrix<EpetraTypes>;
+template class BSR_Matrix<TpetraTypes>;
+template class BSR_Block_Jacobi<EpetraTypes>;
+template class BSR_Block_Jacobi<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of BSR_Matrix.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,441 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/BSR_Matrix.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:25:24 2026
+ * \brief  BSR_Matrix and BSR_Block_Jacobi template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_BSR_Matrix_t_hh
+#define SPn_spn_BSR_Matrix_t_hh
+
+#include <algorithm>
+#include <map>
+
+#include "Teuchos_LAPACK.hpp"
+
+#include "BSR_Matrix.hh"
+#include "VectorTraits.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// BSR_MATRIX
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param map map of the matrix rows; the rows of each block must be
+ * consecutive in the local ordering, and the global index of the first row
+ * in a block must be \c block_size times the global block index
+ * \param block_size number of rows (and columns) in each block
+ * \param max_blocks_per_row maximum number of blocks in a block row
+ */
+template <class T>
+BSR_Matrix<T>::BSR_Matrix(Teuchos::RCP<const MAP> map,
+                          int                     block_size,
+                          int                     max_blocks_per_row)
+    : OperatorAdapter<T>(map)
+    , d_bs(block_size)
+    , d_bs2(block_size * block_size)
+    , d_Nr(VectorTraits<T>::local_size(map) / block_size)
+    , d_filled(false)
+{
+    REQUIRE(block_size > 0);
+    REQUIRE(max_blocks_per_row > 0);
+    REQUIRE(VectorTraits<T>::local_size(map) % block_size == 0);
+
+    allocate(Vec_Int(d_Nr, max_blocks_per_row));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor with the number of blocks in each block row.
+ *
+ * \param map map of the matrix rows (see above)
+ * \param block_size number of rows (and columns) in each block
+ * \param blocks_per_row maximum number of blocks in each local block row
+ */
+template <class T>
+BSR_Matrix<T>::BSR_Matrix(Teuchos::RCP<const MAP> map,
+                          int                     block_size,
+                          const Vec_Int          &blocks_per_row)
+    : OperatorAdapter<T>(map)
+    , d_bs(block_size)
+    , d_bs2(block_size * block_size)
+    , d_Nr(VectorTraits<T>::local_size(map) / block_size)
+    , d_filled(false)
+{
+    REQUIRE(block_size > 0);
+    REQUIRE(VectorTraits<T>::local_size(map) % block_size == 0);
+    REQUIRE(blocks_per_row.size() == d_Nr);
+
+    allocate(blocks_per_row);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add a block to the matrix.
+ *
+ * The block is summed into the matrix if the block (row, col) already
+ * exists.  Concurrent insertions into \e different block rows are safe.
+ *
+ * \param row global block row
+ * \param col global block column
+ * \param block (block_size x block_size) column-major block
+ */
+template <class T>
+void BSR_Matrix<T>::insert_block(int           row,
+                                 int           col,
+                                 const double *block)
+{
+    REQUIRE(!d_filled);
+    REQUIRE(block);
+
+    // local block row
+    int local = Import_Traits::local_index(*this->d_domain_map, row * d_bs);
+    CHECK(local >= 0 && local % d_bs == 0);
+    local /= d_bs;
+    CHECK(local < d_Nr);
+
+    // find the block in the row
+    int  offset = d_row_ptr[local];
+    int  max    = d_row_ptr[local + 1] - offset;
+    int *cols   = &d_cols[offset];
+    int  count  = d_count[local];
+    int  n      = std::find(cols, cols + count, col) - cols;
+
+    // add a new block
+    if (n == count)
+    {
+        INSIST(count < max, "Block row " << row << " has more than "
+               << max << " blocks.");
+        cols[n] = col;
+        ++d_count[local];
+    }
+
+    // sum the block into the matrix
+    double *b = &d_blocks[static_cast<std::size_t>(offset + n) * d_bs2];
+    for (int i = 0; i < d_bs2; ++i)
+    {
+        b[i] += block[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Complete the fill.
+ *
+ * The block storage is compressed in place, the global block columns are
+ * converted to local block columns, and the import of off-processor values
+ * is built.
+ * Local block columns are ordered with the block rows on this domain first
+ * (in local order) followed by off-processor blocks in ascending global
+ * order.
+ */
+template <class T>
+void BSR_Matrix<T>::fill_complete()
+{
+    REQUIRE(!d_filled);
+
+    const MAP &map = *this->d_domain_map;
+
+    // off-processor (global) block columns and their local indices
+    std::map<int, int> ghosts;
+    for (int r = 0; r < d_Nr; ++r)
+    {
+        for (int n = 0; n < d_count[r]; ++n)
+        {
+            int col = d_cols[d_row_ptr[r] + n];
+            if (Import_Traits::local_index(map, col * d_bs) < 0)
+                ghosts.insert(std::make_pair(col, 0));
+        }
+    }
+
+    // build the column map; the global indices of the local rows come first
+    Vec_Int globals((d_Nr + ghosts.size()) * d_bs);
+    for (int i = 0, N = d_Nr * d_bs; i < N; ++i)
+    {
+        globals[i] = Import_Traits::global_index(map, i);
+    }
+    int local = d_Nr;
+    for (auto &ghost : ghosts)
+    {
+        ghost.second = local;
+        for (int i = 0; i < d_bs; ++i)
+        {
+            globals[local * d_bs + i] = ghost.first * d_bs + i;
+        }
+        ++local;
+    }
+    d_col_map = Import_Traits::build_map(map, globals);
+    d_import  = Import_Traits::build_import(this->d_domain_map, d_col_map);
+
+    // compress the blocks and convert the block columns to local indices;
+    // a compressed block row never starts after its allocated position, so
+    // the rows are moved down in order within the same storage
+    int stored = 0;
+    for (int r = 0; r < d_Nr; ++r)
+    {
+        int offset = d_row_ptr[r];
+        d_row_ptr[r] = stored;
+
+        for (int n = 0; n < d_count[r]; ++n)
+        {
+            int col = d_cols[offset + n];
+            int lid = Import_Traits::local_index(map, col * d_bs);
+
+            d_cols[stored + n] = lid >= 0 ? lid / d_bs : ghosts[col];
+        }
+
+        if (stored < offset)
+        {
+            std::copy(&d_blocks[static_cast<std::size_t>(offset) * d_bs2],
+                      &d_blocks[static_cast<std::size_t>(offset) * d_bs2] +
+                      static_cast<std::size_t>(d_count[r]) * d_bs2,
+                      &d_blocks[static_cast<std::size_t>(stored) * d_bs2]);
+        }
+        stored += d_count[r];
+    }
+    d_row_ptr[d_Nr] = stored;
+
+    d_cols.resize(stored);
+    d_blocks.resize(static_cast<std::size_t>(stored) * d_bs2);
+    Vec_Int().swap(d_count);
+    d_filled = true;
+
+    ENSURE(d_cols.size() == d_row_ptr.back());
+    ENSURE(d_blocks.size() ==
+           static_cast<std::size_t>(d_row_ptr.back()) * d_bs2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Global number of stored entries.
+ */
+template <class T>
+UTILS_INT8 BSR_Matrix<T>::global_nonzeros() const
+{
+    REQUIRE(d_filled);
+    UTILS_INT8 num_nonzeros = static_cast<UTILS_INT8>(num_blocks()) * d_bs2;
+    profugus::global_sum(num_nonzeros);
+    return num_nonzeros;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Local bytes allocated for the blocks, block columns and row offsets.
+ */
+template <class T>
+std::size_t BSR_Matrix<T>::storage_bytes() const
+{
+    return d_blocks.capacity() * sizeof(double) +
+        (d_cols.capacity() + d_row_ptr.capacity() + d_count.capacity()) *
+        sizeof(int);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Diagonal block of a local block row.
+ */
+template <class T>
+const double* BSR_Matrix<T>::diagonal_block(int row) const
+{
+    REQUIRE(d_filled);
+    REQUIRE(row >= 0 && row < d_Nr);
+
+    for (int n = d_row_ptr[row]; n < d_row_ptr[row + 1]; ++n)
+    {
+        if (d_cols[n] == row)
+            return &d_blocks[static_cast<std::size_t>(n) * d_bs2];
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Allocate the fill storage.
+ *
+ * The blocks of each block row are allocated contiguously, in block row
+ * order.
+ */
+template <class T>
+void BSR_Matrix<T>::allocate(const Vec_Int &blocks_per_row)
+{
+    REQUIRE(blocks_per_row.size() == d_Nr);
+
+    d_count.assign(d_Nr, 0);
+    d_row_ptr.resize(d_Nr + 1);
+    d_row_ptr[0] = 0;
+    for (int r = 0; r < d_Nr; ++r)
+    {
+        REQUIRE(blocks_per_row[r] >= 0);
+        d_row_ptr[r + 1] = d_row_ptr[r] + blocks_per_row[r];
+    }
+
+    d_cols.assign(d_row_ptr.back(), -1);
+    d_blocks.assign(static_cast<std::size_t>(d_row_ptr.back()) * d_bs2, 0.0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the matrix, \f$\mathbf{y} = \mathbf{A}\mathbf{x}\f$.
+ */
+template <class T>
+void BSR_Matrix<T>::ApplyImpl(const MV &x,
+                                    MV &y) const
+{
+    REQUIRE(d_filled);
+
+    int num_vectors = MVT::GetNumberVecs(x);
+    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+
+    // import the off-processor values of x
+    if (d_x_col.is_null() || MVT::GetNumberVecs(*d_x_col) != num_vectors)
+    {
+        d_x_col = VectorTraits<T>::build_vector(d_col_map, num_vectors);
+    }
+    Import_Traits::do_import(*d_import, x, *d_x_col);
+
+    for (int ivec = 0; ivec < num_vectors; ++ivec)
+    {
+        Teuchos::ArrayRCP<const double> x_data =
+            VectorTraits<T>::get_data(d_x_col, ivec);
+        Teuchos::ArrayRCP<double> y_data =
+            VectorTraits<T>::get_data_nonconst(Teuchos::rcpFromRef(y), ivec);
+        CHECK(y_data.size() == d_Nr * d_bs);
+
+        const double *xp = x_data.getRawPtr();
+        double       *yp = y_data.getRawPtr();
+
+#pragma omp parallel for schedule(static)
+        for (int r = 0; r < d_Nr; ++r)
+        {
+            double *yr = yp + r * d_bs;
+            std::fill(yr, yr + d_bs, 0.0);
+
+            for (int n = d_row_ptr[r]; n < d_row_ptr[r + 1]; ++n)
+            {
+                const double *b  = &d_blocks[static_cast<std::size_t>(n) *
+                                             d_bs2];
+                const double *xc = xp + d_cols[n] * d_bs;
+
+                // y_r += B x_c (column-major block)
+                for (int j = 0; j < d_bs; ++j)
+                {
+                    const double *col = b + j * d_bs;
+                    double        xj  = xc[j];
+                    for (int i = 0; i < d_bs; ++i)
+                    {
+                        yr[i] += col[i] * xj;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BSR_BLOCK_JACOBI
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+template <class T>
+BSR_Block_Jacobi<T>::BSR_Block_Jacobi(Teuchos::RCP<const Matrix_t> A)
+    : OperatorAdapter<T>(A->get_Map())
+    , d_bs(A->block_size())
+    , d_Nr(A->num_block_rows())
+    , d_lu(static_cast<std::size_t>(d_Nr) * d_bs * d_bs, 0.0)
+    , d_ipiv(d_Nr * d_bs, 0)
+{
+    REQUIRE(A->filled());
+
+    const int bs2 = d_bs * d_bs;
+
+    // number of missing or singular diagonal blocks
+    int failed = 0;
+
+    // copy and factor the diagonal blocks
+#pragma omp parallel reduction(+:failed)
+    {
+        Teuchos::LAPACK<int, double> lapack;
+        int info = 0;
+
+#pragma omp for schedule(static)
+        for (int r = 0; r < d_Nr; ++r)
+        {
+            const double *D  = A->diagonal_block(r);
+            double       *LU = &d_lu[static_cast<std::size_t>(r) * bs2];
+            if (!D)
+            {
+                ++failed;
+                continue;
+            }
+
+            std::copy(D, D + bs2, LU);
+            lapack.GETRF(d_bs, d_bs, LU, d_bs, &d_ipiv[r * d_bs], &info);
+            if (info != 0)
+                ++failed;
+        }
+    }
+
+    INSIST(failed == 0, failed << " diagonal blocks are missing or singular.");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the inverse of the block diagonal.
+ */
+template <class T>
+void BSR_Block_Jacobi<T>::ApplyImpl(const MV &x,
+                                          MV &y) const
+{
+    int num_vectors = MVT::GetNumberVecs(x);
+    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+
+    const int bs2 = d_bs * d_bs;
+
+    for (int ivec = 0; ivec < num_vectors; ++ivec)
+    {
+        Teuchos::ArrayRCP<const double> x_data =
+            VectorTraits<T>::get_data(Teuchos::rcpFromRef(x), ivec);
+        Teuchos::ArrayRCP<double> y_data =
+            VectorTraits<T>::get_data_nonconst(Teuchos::rcpFromRef(y), ivec);
+        CHECK(x_data.size() == d_Nr * d_bs);
+        CHECK(y_data.size() == d_Nr * d_bs);
+
+        const double *xp = x_data.getRawPtr();
+        double       *yp = y_data.getRawPtr();
+
+#pragma omp parallel
+        {
+            Teuchos::LAPACK<int, double> lapack;
+            int info = 0;
+
+#pragma omp for schedule(static)
+            for (int r = 0; r < d_Nr; ++r)
+            {
+                double *yr = yp + r * d_bs;
+                std::copy(xp + r * d_bs, xp + (r + 1) * d_bs, yr);
+                lapack.GETRS('N', d_bs, 1,
+                             &d_lu[static_cast<std::size_t>(r) * bs2], d_bs,
+                             &d_ipiv[r * d_bs], yr, d_bs, &info);
+                CHECK(info == 0);
+            }
+        }
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_BSR_Matrix_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of BSR_Matrix.t.hh
+//---------------------------------------------------------------------------//
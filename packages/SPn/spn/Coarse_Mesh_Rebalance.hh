@@ -0,0 +1,220 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Coarse_Mesh_Rebalance.hh
+ * \author agent
+ * \date   Mon Oct 19 03:45:55 2026
+ * \brief  Coarse_Mesh_Rebalance class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Coarse_Mesh_Rebalance_hh
+#define SPn_spn_Coarse_Mesh_Rebalance_hh
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ArrayRCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziOperatorTraits.hpp"
+
+#include "harness/DBC.hh"
+#include "utils/Definitions.hh"
+#include "xs/Mat_DB.hh"
+#include "mesh/Mesh.hh"
+#include "mesh/LG_Indexer.hh"
+#include "mesh/Global_Mesh_Data.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "solvers/LinearSolver.hh"
+#include "ImportTraits.hh"
+#include "Linear_System_FV.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Coarse_Mesh_Rebalance
+ * \brief Coarse-mesh rebalance acceleration for SPN eigenvalue problems.
+ *
+ * The fine mesh is collapsed into coarse cells of \c (fi,fj,fk) fine cells
+ * (given by the "rebalance_coarsening" entry).  For an iterate
+ * \f$\mathbf{u}\f$ the prolongation \f$\mathbf{P}\f$ maps a coarse vector
+ * \f$\mathbf{c}\f$, with one entry per coarse cell and group, to the fine
+ * vector whose entries are \f$u_i c_{I(i),g(i)}\f$.  All equations (moments)
+ * of a group in a coarse cell are scaled by the same factor.  The coarse
+ * eigenproblem is the Galerkin projection
+ * \f[
+   \mathbf{P}^T\mathbf{A}\mathbf{P}\mathbf{c} =
+   \frac{1}{k}\mathbf{P}^T\mathbf{B}\mathbf{P}\mathbf{c}\:,
+ * \f]
+ * and the iterate is corrected multiplicatively, \f$\mathbf{u}\leftarrow
+ * \mathbf{P}\mathbf{c}\f$.  Because \f$\mathbf{c}=1\f$ reproduces
+ * \f$\mathbf{u}\f$, the correction is the best eigenvector estimate in the
+ * space of coarse-cell and group-wise rescalings of the iterate.
+ *
+ * The local blocks of the coarse operators are built in one pass over the
+ * local rows of the assembled \b A and \b B, weighting each entry by the
+ * iterate on its row and column; the iterate on off-processor columns is
+ * imported once.  When \b A is not assembled in point storage ("bsr" or
+ * matrix-free), the coarse cells are colored by their (i,j,k) indices
+ * modulo 3, and one apply of \b A per color and group gives every coarse
+ * coupling (the FV stencil only couples neighboring coarse cells), which
+ * costs up to \f$27G\f$ applies per rebalance.
+ *
+ * Each domain only stores the blocks of the coarse cells that overlap it.
+ * The coarse matrices are sparse (27 blocks of \c Ng x \c Ng per row in
+ * \b A and one in \b B) and distributed by coarse cell over all domains;
+ * contributions to coarse cells owned by another domain are summed into
+ * the owner during assembly, so only the domains that share a coarse cell
+ * communicate.  The coarse eigenproblem is solved by inverse iteration in
+ * which each \f$\mathbf{A}^{-1}\f$ is a Krylov solve (LinearSolverBuilder)
+ * and the only other global operations are scalar fission-source sums.
+ * Coarse unknowns on which the iterate vanishes on every domain are
+ * decoupled (an identity row in \b A and an empty row in \b B) and are left
+ * uncorrected.  rebalance() is collective and returns the same result on
+ * every domain.
+ *
+ * The following entries in the database are significant:
+ *  - "rebalance_coarsening" fine cells per coarse cell in (i,j,k)
+ *  - "rebalance_tolerance"  eigenvalue tolerance for the coarse problem
+ *                           (1.0e-10)
+ *  - "rebalance_max_itr"    maximum coarse inverse iterations (1000)
+ *  - "rebalance_solver"     LinearSolverBuilder database for the coarse
+ *                           solves (profugus GMRES preconditioned by the
+ *                           PreconditionerBuilder default, relative
+ *                           tolerance 0.1 * rebalance_tolerance)
+ */
+/*!
+ * \example spn/test/tstEigenvalue_Solver.cc
+ *
+ * Test of Coarse_Mesh_Rebalance.
+ */
+//===========================================================================//
+
+template <class T>
+class Coarse_Mesh_Rebalance
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                       MV;
+    typedef typename T::OP                       OP;
+    typedef typename T::MAP                      MAP;
+    typedef typename T::MATRIX                   MATRIX;
+    typedef Anasazi::MultiVecTraits<double,MV>    MVT;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    typedef typename ImportTraits<T>::Import_t   Import_t;
+    typedef Linear_System_FV<T>                  Linear_System_t;
+    typedef Teuchos::RCP<Linear_System_t>        RCP_Linear_System;
+    typedef Teuchos::RCP<Teuchos::ParameterList> RCP_ParameterList;
+    typedef Teuchos::RCP<Mat_DB>                 RCP_Mat_DB;
+    typedef Teuchos::RCP<Mesh>                   RCP_Mesh;
+    typedef Teuchos::RCP<LG_Indexer>             RCP_Indexer;
+    typedef Teuchos::RCP<Global_Mesh_Data>       RCP_Global_Data;
+    typedef def::Vec_Int                         Vec_Int;
+    typedef def::Vec_Dbl                         Vec_Dbl;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // Linear system.
+    RCP_Linear_System d_system;
+
+    // Number of groups and equations.
+    int d_Ng, d_Ne;
+
+    // Number of coarse cells in each dimension and in total.
+    int d_N[3], d_Ncc;
+
+    // Local coarse cell (index into d_touched) of each local spatial
+    // unknown (cells and then boundary faces).
+    Vec_Int d_coarse;
+
+    // Global indices of the coarse cells that overlap this domain.
+    Vec_Int d_touched;
+
+    // Colors that contain coarse cells.
+    Vec_Int d_colors;
+
+    // Coarse unknowns owned by this domain and overlapping this domain, and
+    // the import between them.
+    Teuchos::RCP<const MAP>      d_map;
+    Teuchos::RCP<const MAP>      d_overlap_map;
+    Teuchos::RCP<const Import_t> d_import;
+
+    // Coarse eigenproblem controls.
+    double            d_tol;
+    int               d_max_itr;
+    RCP_ParameterList d_solver_db;
+
+    // Column map of the assembled LHS matrix, the import into it, and the
+    // imported iterate and coarse cell of each column (built on first use).
+    mutable Teuchos::RCP<const MAP>      d_col_map;
+    mutable Teuchos::RCP<const Import_t> d_col_import;
+    mutable Teuchos::RCP<MV>             d_col_values;
+
+  public:
+    // Constructor.
+    Coarse_Mesh_Rebalance(RCP_ParameterList db, RCP_Linear_System system,
+                          RCP_Mat_DB mat, RCP_Mesh mesh, RCP_Indexer indexer,
+                          RCP_Global_Data data);
+
+    // Rebalance an iterate and update the eigenvalue estimate.
+    bool rebalance(Teuchos::RCP<MV> u, double &keff) const;
+
+    // >>> ACCESSORS
+
+    //! Number of coarse cells.
+    int num_coarse_cells() const { return d_Ncc; }
+
+    //! Number of coarse unknowns (coarse cells times groups).
+    int num_coarse_unknowns() const { return d_Ncc * d_Ng; }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Color of a coarse cell.
+    int color(int cell) const
+    {
+        return (cell % d_N[0]) % 3 + 3 * (((cell / d_N[0]) % d_N[1]) % 3) +
+            9 * ((cell / (d_N[0] * d_N[1])) % 3);
+    }
+
+    // Neighbor slot (in a 3x3x3 stencil) of the coarse cell of a given
+    // color adjacent to a cell; -1 if there is none.
+    int neighbor(int cell, int c) const;
+
+    // Neighbor cell in a given stencil slot.
+    int neighbor_cell(int cell, int slot) const;
+
+    // Stencil slot of a neighboring coarse cell.
+    int stencil_slot(int cell, int other) const;
+
+    // Add the local rows of the assembled A to the coarse blocks.
+    void project_rows(Teuchos::RCP<const MATRIX> A, Teuchos::RCP<const MV> u,
+                      Vec_Dbl &a) const;
+
+    // Add A to the coarse blocks with operator applies.
+    void project_applies(Teuchos::RCP<const MV> u, Vec_Dbl &a) const;
+
+    // Build the column map of the assembled A.
+    void build_column_map(Teuchos::RCP<const MATRIX> A) const;
+
+    // Assemble a coarse operator from the local blocks.
+    Teuchos::RCP<MATRIX> assemble(
+        const Vec_Dbl &blocks, bool stencil,
+        Teuchos::ArrayRCP<const double> weight,
+        Teuchos::ArrayRCP<const double> owned_weight) const;
+
+    // Global sum of the entries of a coarse vector.
+    static double sum(Teuchos::RCP<const MV> v);
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_Coarse_Mesh_Rebalance_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Coarse_Mesh_Rebalance.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,28 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Coarse_Mesh_Rebalance.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:45:55 2026
+ * \brief  Coarse_Mesh_Rebalance explicit instantiation.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Coarse_Mesh_Rebalance.t.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziOperatorTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+namespace profugus
+{
+
+template class Coarse_Mesh_Rebalance<EpetraTypes>;
+template class Coarse_Mesh_Rebalance<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Coarse_Mesh_Rebalance.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,769 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Coarse_Mesh_Rebalance.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:45:55 2026
+ * \brief  Coarse_Mesh_Rebalance template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Coarse_Mesh_Rebalance_t_hh
+#define SPn_spn_Coarse_Mesh_Rebalance_t_hh
+
+#include <cmath>
+#include <algorithm>
+#include <set>
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ArrayView.hpp"
+
+#include "comm/global.hh"
+#include "solvers/LinearSolverBuilder.hh"
+#include "solvers/PreconditionerBuilder.hh"
+#include "VectorTraits.hh"
+#include "MatrixTraits.hh"
+#include "Coarse_Mesh_Rebalance.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * Maps every local spatial unknown of the linear system to its coarse cell.
+ * Boundary unknowns belong to the coarse cell of the adjacent volume cell.
+ * The coarse cells are distributed in contiguous, nearly equal ranges over
+ * all domains, independently of the spatial decomposition.
+ */
+template <class T>
+Coarse_Mesh_Rebalance<T>::Coarse_Mesh_Rebalance(RCP_ParameterList db,
+                                                RCP_Linear_System system,
+                                                RCP_Mat_DB        mat,
+                                                RCP_Mesh          mesh,
+                                                RCP_Indexer       indexer,
+                                                RCP_Global_Data   data)
+    : d_system(system)
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(!db.is_null());
+    REQUIRE(!system.is_null());
+    REQUIRE(!mat.is_null());
+    REQUIRE(!mesh.is_null());
+    REQUIRE(!indexer.is_null());
+    REQUIRE(!data.is_null());
+
+    VALIDATE(db->isParameter("rebalance_coarsening"),
+             "rebalance_coarsening must be given for coarse-mesh rebalance.");
+    const auto &f = db->get<Teuchos::Array<int> >("rebalance_coarsening");
+    VALIDATE(f.size() == 3, "rebalance_coarsening must have 3 entries.");
+    VALIDATE(f[I] > 0 && f[J] > 0 && f[K] > 0,
+             "rebalance_coarsening entries must be positive.");
+
+    d_tol     = db->get("rebalance_tolerance", 1.0e-10);
+    d_max_itr = db->get("rebalance_max_itr", 1000);
+
+    // coarse linear solver defaults
+    d_solver_db = Teuchos::sublist(db, "rebalance_solver");
+    d_solver_db->get("profugus_solver", std::string("GMRES"));
+    d_solver_db->get("tolerance", 0.1 * d_tol);
+    d_solver_db->get("max_itr", 1000);
+
+    // problem sizes
+    d_Ne = system->get_dims()->num_equations();
+    d_Ng = mat->xs().num_groups();
+
+    // coarse grid
+    for (int d = 0; d < 3; ++d)
+    {
+        d_N[d] = (data->num_cells(d) + f[d] - 1) / f[d];
+    }
+    d_Ncc = d_N[I] * d_N[J] * d_N[K];
+
+    // colors that contain coarse cells
+    for (int c = 0; c < 27; ++c)
+    {
+        if (c % 3 < d_N[I] && (c / 3) % 3 < d_N[J] && c / 9 < d_N[K])
+        {
+            d_colors.push_back(c);
+        }
+    }
+
+    // local mesh dimensions and global offsets
+    int N[3] = {mesh->num_cells_dim(I), mesh->num_cells_dim(J),
+                mesh->num_cells_dim(K)};
+    int off[3] = {indexer->offset(I), indexer->offset(J), 0};
+
+    // number of local spatial unknowns (cells and boundary faces)
+    int Ns = VectorTraits<T>::local_size(system->get_Map()) / (d_Ne * d_Ng);
+    d_coarse.resize(Ns, -1);
+
+    // coarse cell of a local (i,j,k) cell
+    auto coarse = [&](int i, int j, int k)
+    {
+        return (i + off[I]) / f[I] +
+            d_N[I] * ((j + off[J]) / f[J] + d_N[J] * ((k + off[K]) / f[K]));
+    };
+
+    // volume cells
+    int i = 0, j = 0, k = 0;
+    for (int cell = 0; cell < mesh->num_cells(); ++cell)
+    {
+        indexer->l2l(cell, i, j, k);
+        d_coarse[cell] = coarse(i, j, k);
+    }
+
+    // boundary faces (abscissa, ordinate) are (j,k) on x faces, (i,k) on y
+    // faces, and (i,j) on z faces
+    int Nc = mesh->num_cells();
+    int ab[6] = {J, J, I, I, I, I};
+    int od[6] = {K, K, K, K, J, J};
+    for (int face = 0; face < 6; ++face)
+    {
+        typename Linear_System_t::RCP_Bnd_Indexer bnd =
+            system->bnd_indexer(face);
+        if (bnd.is_null())
+            continue;
+
+        int ijk[3] = {0, 0, 0};
+        ijk[face / 2] = (face % 2) ? N[face / 2] - 1 : 0;
+
+        for (int o = 0; o < N[od[face]]; ++o)
+        {
+            for (int a = 0; a < N[ab[face]]; ++a)
+            {
+                ijk[ab[face]] = a;
+                ijk[od[face]] = o;
+                CHECK(Nc + bnd->local(a, o) < Ns);
+                d_coarse[Nc + bnd->local(a, o)] =
+                    coarse(ijk[I], ijk[J], ijk[K]);
+            }
+        }
+    }
+
+    // coarse cells that overlap this domain; d_coarse becomes an index into
+    // them
+    d_touched = d_coarse;
+    std::sort(d_touched.begin(), d_touched.end());
+    d_touched.erase(std::unique(d_touched.begin(), d_touched.end()),
+                    d_touched.end());
+    CHECK(d_touched.empty() || d_touched.front() >= 0);
+    for (auto &c : d_coarse)
+    {
+        c = std::lower_bound(d_touched.begin(), d_touched.end(), c) -
+            d_touched.begin();
+    }
+
+    // coarse cells owned by this domain
+    int nodes = profugus::nodes();
+    int node  = profugus::node();
+    int first = node * (d_Ncc / nodes) + std::min(node, d_Ncc % nodes);
+    int count = d_Ncc / nodes + (node < d_Ncc % nodes ? 1 : 0);
+
+    // coarse unknowns (Ng per coarse cell) owned by and overlapping this
+    // domain
+    std::vector<int> owned, overlap;
+    owned.reserve(count * d_Ng);
+    overlap.reserve(d_touched.size() * d_Ng);
+    for (int cell = first; cell < first + count; ++cell)
+    {
+        for (int g = 0; g < d_Ng; ++g)
+        {
+            owned.push_back(g + d_Ng * cell);
+        }
+    }
+    for (int cell : d_touched)
+    {
+        for (int g = 0; g < d_Ng; ++g)
+        {
+            overlap.push_back(g + d_Ng * cell);
+        }
+    }
+
+    d_map         = ImportTraits<T>::build_map(*system->get_Map(), owned);
+    d_overlap_map = ImportTraits<T>::build_map(*system->get_Map(), overlap);
+    d_import      = ImportTraits<T>::build_import(d_map, d_overlap_map);
+
+    ENSURE(d_Ncc > 0);
+    ENSURE(!d_colors.empty());
+    ENSURE(VectorTraits<T>::local_size(d_map) == count * d_Ng);
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Rebalance an iterate.
+ *
+ * The local blocks of the coarse operators are computed in one pass over
+ * the local matrix rows on this domain (operator applies when \b A is not
+ * assembled), summed into their owners during assembly, and the coarse
+ * eigenproblem is solved by inverse iteration with Krylov solves of the
+ * coarse \b A.  This function is collective.
+ *
+ * \param u iterate, corrected in place
+ * \param keff eigenvalue estimate, replaced by the coarse eigenvalue
+ *
+ * \return false (and \a u and \a keff are unchanged) if the coarse problem
+ * is singular, a coarse solve does not converge, or the dominant eigenvector
+ * is not positive
+ */
+template <class T>
+bool Coarse_Mesh_Rebalance<T>::rebalance(Teuchos::RCP<MV>  u,
+                                         double           &keff) const
+{
+    REQUIRE(!u.is_null());
+    REQUIRE(VectorTraits<T>::local_length(u) ==
+            static_cast<int>(d_coarse.size()) * d_Ne * d_Ng);
+
+    const int Ng = d_Ng;
+    const int Ns = d_coarse.size();
+    const int Nu = Ns * d_Ne;
+    const int Nt = d_touched.size();
+
+    // local contributions to the coarse A blocks [t][slot][g'][g] and B
+    // blocks [t][g'][g] of the coarse cells overlapping this domain
+    Vec_Dbl a(Nt * 27 * Ng * Ng, 0.0);
+    Vec_Dbl b(Nt * Ng * Ng, 0.0);
+
+    Teuchos::ArrayRCP<const double> x = VectorTraits<T>::get_data(u);
+
+    // >>> A = P^T A P, from the local matrix rows when A is assembled
+
+    Teuchos::RCP<const MATRIX> A_matrix = d_system->get_Matrix();
+    if (!A_matrix.is_null())
+    {
+        project_rows(A_matrix, u, a);
+    }
+    else
+    {
+        project_applies(u, a);
+    }
+
+    // >>> B = P^T B P (B is cell-local and always assembled)
+
+    Teuchos::RCP<const MATRIX> B =
+        Teuchos::rcp_dynamic_cast<const MATRIX>(
+            d_system->get_fission_matrix());
+    CHECK(!B.is_null());
+    {
+        Teuchos::ArrayView<const int>    inds;
+        Teuchos::ArrayView<const double> vals;
+
+        const MAP &map = *d_system->get_Map();
+        for (int r = 0; r < Nu * Ng; ++r)
+        {
+            MatrixTraits<T>::get_local_row_view(B, r, inds, vals);
+
+            int     g   = r % Ng;
+            double *blk = &b[Ng * Ng * d_coarse[r / (d_Ne * Ng)]];
+            for (int n = 0; n < inds.size(); ++n)
+            {
+                int col = ImportTraits<T>::local_index(
+                    map, MatrixTraits<T>::global_col_id(B, inds[n]));
+                CHECK(col >= 0);
+                CHECK(d_coarse[col / (d_Ne * Ng)] ==
+                      d_coarse[r / (d_Ne * Ng)]);
+
+                blk[g + Ng * (col % Ng)] += x[r] * vals[n] * x[col];
+            }
+        }
+    }
+
+    // >>> Weight of the iterate on each coarse unknown (over all domains)
+
+    Teuchos::RCP<MV> weight       = VectorTraits<T>::build_vector(d_overlap_map);
+    Teuchos::RCP<MV> owned_weight = VectorTraits<T>::build_vector(d_map);
+    {
+        Teuchos::ArrayRCP<double> y =
+            VectorTraits<T>::get_data_nonconst(weight);
+        for (int s = 0; s < Ns; ++s)
+        {
+            for (int n = 0; n < d_Ne; ++n)
+            {
+                for (int g = 0; g < Ng; ++g)
+                {
+                    y[g + Ng * d_coarse[s]] +=
+                        std::fabs(x[g + Ng * (n + d_Ne * s)]);
+                }
+            }
+        }
+    }
+    ImportTraits<T>::do_export(*d_import, *weight, *owned_weight);
+    ImportTraits<T>::do_import(*d_import, *owned_weight, *weight);
+
+    // >>> Assemble the distributed coarse operators
+
+    Teuchos::ArrayRCP<const double> wt  = VectorTraits<T>::get_data(weight);
+    Teuchos::ArrayRCP<const double> owt =
+        VectorTraits<T>::get_data(owned_weight);
+
+    Teuchos::RCP<MATRIX> Ac = assemble(a, true, wt, owt);
+    Teuchos::RCP<MATRIX> Bc = assemble(b, false, wt, owt);
+
+    // >>> Solve the coarse eigenproblem by inverse iteration
+
+    Teuchos::RCP<LinearSolver<T> > solver =
+        LinearSolverBuilder<T>::build_solver(d_solver_db);
+    solver->set_operator(Ac);
+    Teuchos::RCP<OP> prec =
+        PreconditionerBuilder<T>::build_preconditioner(Ac, d_solver_db);
+    if (!prec.is_null())
+    {
+        solver->set_preconditioner(prec);
+    }
+
+    Teuchos::RCP<MV> cv  = VectorTraits<T>::build_vector(d_map);
+    Teuchos::RCP<MV> Bcv = VectorTraits<T>::build_vector(d_map);
+    Teuchos::RCP<MV> y   = VectorTraits<T>::build_vector(d_map);
+    VectorTraits<T>::put_scalar(cv, 1.0);
+
+    // c <- A^-1 B c
+    double k = keff, k_old = 0.0;
+    for (int itr = 0; itr < d_max_itr; ++itr)
+    {
+        OPT::Apply(*Bc, *cv, *Bcv);
+        double src = sum(Bcv);
+        if (src == 0.0)
+            return false;
+
+        // A^-1 B c approaches k c, which is the initial guess
+        MVT::MvAddMv(k, *cv, 0.0, *cv, *y);
+        solver->solve(y, Bcv);
+        if (!solver->converged())
+            return false;
+
+        // eigenvalue estimate from the ratio of fission sources
+        OPT::Apply(*Bc, *y, *Bcv);
+        k_old = k;
+        k     = sum(Bcv) / src;
+        if (!(k > 0.0))
+            return false;
+
+        MVT::MvAddMv(1.0 / k, *y, 0.0, *y, *cv);
+
+        if (itr > 0 && std::fabs(k - k_old) < d_tol * std::fabs(k))
+            break;
+    }
+
+    // the correction must be positive where the iterate has weight
+    int negative = 0;
+    {
+        Teuchos::ArrayRCP<const double> c = VectorTraits<T>::get_data(cv);
+        for (int row = 0; row < c.size(); ++row)
+        {
+            if (owt[row] > 0.0 && !(c[row] > 0.0))
+                ++negative;
+        }
+    }
+    profugus::global_sum(negative);
+    if (negative)
+        return false;
+
+    // >>> Prolong the multiplicative correction
+
+    Teuchos::RCP<MV> overlap_c = VectorTraits<T>::build_vector(d_overlap_map);
+    ImportTraits<T>::do_import(*d_import, *cv, *overlap_c);
+
+    Teuchos::ArrayRCP<const double> c = VectorTraits<T>::get_data(overlap_c);
+    Teuchos::ArrayRCP<double>       z = VectorTraits<T>::get_data_nonconst(u);
+    for (int s = 0; s < Ns; ++s)
+    {
+        for (int n = 0; n < d_Ne; ++n)
+        {
+            for (int g = 0; g < Ng; ++g)
+            {
+                z[g + Ng * (n + d_Ne * s)] *= c[g + Ng * d_coarse[s]];
+            }
+        }
+    }
+
+    keff = k;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add the local rows of the assembled \b A to the coarse blocks.
+ *
+ * Each stored entry \f$a_{rc}\f$ adds \f$u_r a_{rc} u_c\f$ to the block
+ * coupling the coarse cells and groups of row \e r and column \e c, so the
+ * local blocks of \f$\mathbf{P}^T\mathbf{A}\mathbf{P}\f$ are built in one
+ * pass over the local rows.  The iterate and the coarse cell of the
+ * off-processor columns are imported once per call.
+ */
+template <class T>
+void Coarse_Mesh_Rebalance<T>::project_rows(Teuchos::RCP<const MATRIX> A,
+                                            Teuchos::RCP<const MV>     u,
+                                            Vec_Dbl                   &a) const
+{
+    typedef MatrixTraits<T> MT;
+
+    const int Ng = d_Ng;
+    const int Nr = d_coarse.size() * d_Ne * Ng;
+    REQUIRE(a.size() == d_touched.size() * 27 * Ng * Ng);
+
+    // the column map only depends on the stencil of the system
+    if (d_col_map.is_null())
+        build_column_map(A);
+
+    // import the iterate (vector 0) and the global coarse cell (vector 1)
+    // of every column
+    Teuchos::RCP<MV> local =
+        VectorTraits<T>::build_vector(d_system->get_Map(), 2);
+    {
+        Teuchos::ArrayRCP<const double> x = VectorTraits<T>::get_data(u);
+        Teuchos::ArrayRCP<double> xl =
+            VectorTraits<T>::get_data_nonconst(local, 0);
+        Teuchos::ArrayRCP<double> cl =
+            VectorTraits<T>::get_data_nonconst(local, 1);
+        for (int r = 0; r < Nr; ++r)
+        {
+            xl[r] = x[r];
+            cl[r] = d_touched[d_coarse[r / (d_Ne * Ng)]];
+        }
+    }
+    ImportTraits<T>::do_import(*d_col_import, *local, *d_col_values);
+
+    Teuchos::ArrayRCP<const double> x  = VectorTraits<T>::get_data(u);
+    Teuchos::ArrayRCP<const double> xc =
+        VectorTraits<T>::get_data(d_col_values, 0);
+    Teuchos::ArrayRCP<const double> cc =
+        VectorTraits<T>::get_data(d_col_values, 1);
+
+    Teuchos::ArrayView<const int>    inds;
+    Teuchos::ArrayView<const double> vals;
+    for (int r = 0; r < Nr; ++r)
+    {
+        MT::get_local_row_view(A, r, inds, vals);
+
+        int t = d_coarse[r / (d_Ne * Ng)];
+        int I = d_touched[t];
+        int g = r % Ng;
+        for (int n = 0; n < inds.size(); ++n)
+        {
+            // the groups of each spatial unknown are contiguous, so the
+            // group of a column is its global index modulo Ng
+            int global = MT::global_col_id(A, inds[n]);
+            int col    = ImportTraits<T>::local_index(*d_col_map, global);
+            CHECK(col >= 0);
+
+            int slot = stencil_slot(I, static_cast<int>(cc[col]));
+            a[g + Ng * (global % Ng + Ng * (slot + 27 * t))] +=
+                x[r] * vals[n] * xc[col];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add \b A to the coarse blocks with operator applies.
+ *
+ * This is used when \b A is not assembled in point storage ("bsr" storage
+ * or matrix-free).  Coarse cells are colored by their (i,j,k) indices modulo
+ * 3, and one apply per color and group gives every coarse coupling (the FV
+ * stencil only couples neighboring coarse cells), ie. up to \f$27G\f$
+ * applies.
+ */
+template <class T>
+void Coarse_Mesh_Rebalance<T>::project_applies(Teuchos::RCP<const MV> u,
+                                               Vec_Dbl               &a) const
+{
+    const int Ng = d_Ng;
+    const int Ns = d_coarse.size();
+    REQUIRE(a.size() == d_touched.size() * 27 * Ng * Ng);
+
+    Teuchos::RCP<OP> A = d_system->get_Operator();
+    CHECK(!A.is_null());
+
+    // work vectors
+    Teuchos::RCP<MV> v = VectorTraits<T>::build_vector(d_system->get_Map());
+    Teuchos::RCP<MV> w = VectorTraits<T>::build_vector(d_system->get_Map());
+
+    Teuchos::ArrayRCP<const double> x = VectorTraits<T>::get_data(u);
+
+    for (int c : d_colors)
+    {
+        for (int gp = 0; gp < Ng; ++gp)
+        {
+            {
+                Teuchos::ArrayRCP<double> y =
+                    VectorTraits<T>::get_data_nonconst(v);
+                for (int s = 0; s < Ns; ++s)
+                {
+                    bool on = color(d_touched[d_coarse[s]]) == c;
+                    for (int n = 0; n < d_Ne; ++n)
+                    {
+                        for (int g = 0; g < Ng; ++g)
+                        {
+                            int r = g + Ng * (n + d_Ne * s);
+                            y[r]  = (on && g == gp) ? x[r] : 0.0;
+                        }
+                    }
+                }
+            }
+
+            OPT::Apply(*A, *v, *w);
+
+            Teuchos::ArrayRCP<const double> y = VectorTraits<T>::get_data(w);
+            for (int s = 0; s < Ns; ++s)
+            {
+                int slot = neighbor(d_touched[d_coarse[s]], c);
+                if (slot < 0)
+                    continue;
+
+                double *blk = &a[Ng * Ng * (slot + 27 * d_coarse[s])];
+                for (int n = 0; n < d_Ne; ++n)
+                {
+                    for (int g = 0; g < Ng; ++g)
+                    {
+                        int r = g + Ng * (n + d_Ne * s);
+                        blk[g + Ng * gp] += x[r] * y[r];
+                    }
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the column map of the assembled \b A.
+ *
+ * The local unknowns come first followed by the off-processor columns in
+ * ascending global order.
+ */
+template <class T>
+void Coarse_Mesh_Rebalance<T>::build_column_map(
+    Teuchos::RCP<const MATRIX> A) const
+{
+    typedef MatrixTraits<T> MT;
+
+    const MAP &map = *d_system->get_Map();
+    const int  N   = VectorTraits<T>::local_size(d_system->get_Map());
+
+    Teuchos::ArrayView<const int>    inds;
+    Teuchos::ArrayView<const double> vals;
+
+    std::set<int> ghosts;
+    for (int r = 0; r < N; ++r)
+    {
+        MT::get_local_row_view(A, r, inds, vals);
+        for (int n = 0; n < inds.size(); ++n)
+        {
+            int col = MT::global_col_id(A, inds[n]);
+            if (ImportTraits<T>::local_index(map, col) < 0)
+                ghosts.insert(col);
+        }
+    }
+
+    Vec_Int globals(N);
+    for (int i = 0; i < N; ++i)
+    {
+        globals[i] = ImportTraits<T>::global_index(map, i);
+    }
+    globals.insert(globals.end(), ghosts.begin(), ghosts.end());
+
+    d_col_map    = ImportTraits<T>::build_map(map, globals);
+    d_col_import = ImportTraits<T>::build_import(d_system->get_Map(),
+                                                 d_col_map);
+    d_col_values = VectorTraits<T>::build_vector(d_col_map, 2);
+
+    ENSURE(!d_col_map.is_null());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Stencil slot of a neighboring coarse cell.
+ */
+template <class T>
+int Coarse_Mesh_Rebalance<T>::stencil_slot(int cell, int other) const
+{
+    REQUIRE(cell >= 0 && cell < d_Ncc);
+    REQUIRE(other >= 0 && other < d_Ncc);
+
+    int slot = 0, stride = 1;
+    for (int d = 0; d < 3; ++d)
+    {
+        int delta = other % d_N[d] - cell % d_N[d];
+        CHECK(delta >= -1 && delta <= 1);
+
+        slot   += (delta + 1) * stride;
+        stride *= 3;
+        cell   /= d_N[d];
+        other  /= d_N[d];
+    }
+
+    ENSURE(slot >= 0 && slot < 27);
+    return slot;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Slot of the neighbor of a given color.
+ *
+ * Of the three consecutive indices \c {i-1,i,i+1} in each dimension exactly
+ * one has a given value modulo 3, so there is at most one coarse cell of each
+ * color in the \c 3x3x3 neighborhood of a cell.
+ */
+template <class T>
+int Coarse_Mesh_Rebalance<T>::neighbor(int cell, int c) const
+{
+    REQUIRE(cell >= 0 && cell < d_Ncc);
+    REQUIRE(c >= 0 && c < 27);
+
+    int ijk[3] = {cell % d_N[0], (cell / d_N[0]) % d_N[1],
+                  cell / (d_N[0] * d_N[1])};
+    int cc[3]  = {c % 3, (c / 3) % 3, c / 9};
+
+    int slot = 0, stride = 1;
+    for (int d = 0; d < 3; ++d)
+    {
+        // offset in [-1,1] with the requested residue
+        int delta = (cc[d] - ijk[d] % 3 + 4) % 3 - 1;
+        int n     = ijk[d] + delta;
+        if (n < 0 || n >= d_N[d])
+            return -1;
+
+        slot   += (delta + 1) * stride;
+        stride *= 3;
+    }
+
+    ENSURE(slot >= 0 && slot < 27);
+    return slot;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Neighbor cell in a given stencil slot (-1 if outside the mesh).
+ */
+template <class T>
+int Coarse_Mesh_Rebalance<T>::neighbor_cell(int cell, int slot) const
+{
+    REQUIRE(cell >= 0 && cell < d_Ncc);
+    REQUIRE(slot >= 0 && slot < 27);
+
+    int ijk[3] = {cell % d_N[0], (cell / d_N[0]) % d_N[1],
+                  cell / (d_N[0] * d_N[1])};
+    int s[3]   = {slot % 3 - 1, (slot / 3) % 3 - 1, slot / 9 - 1};
+
+    for (int d = 0; d < 3; ++d)
+    {
+        ijk[d] += s[d];
+        if (ijk[d] < 0 || ijk[d] >= d_N[d])
+            return -1;
+    }
+
+    return ijk[0] + d_N[0] * (ijk[1] + d_N[1] * ijk[2]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Assemble a distributed coarse operator.
+ *
+ * Each domain inserts its contributions to the rows of the coarse cells that
+ * overlap it; contributions to rows owned by other domains are summed into
+ * the owners.  Coarse unknowns without weight are skipped, and their owners
+ * give them an identity row in the stencil (\b A) operator.
+ *
+ * \param blocks local blocks, 27 per coarse cell if \a stencil is true and 1
+ * otherwise
+ * \param weight iterate weight on the overlapping coarse unknowns
+ * \param owned_weight iterate weight on the owned coarse unknowns
+ */
+template <class T>
+Teuchos::RCP<typename T::MATRIX>
+Coarse_Mesh_Rebalance<T>::assemble(
+    const Vec_Dbl                   &blocks,
+    bool                             stencil,
+    Teuchos::ArrayRCP<const double>  weight,
+    Teuchos::ArrayRCP<const double>  owned_weight) const
+{
+    const int Ng        = d_Ng;
+    const int Nt        = d_touched.size();
+    const int num_slots = stencil ? 27 : 1;
+    REQUIRE(blocks.size() == Nt * num_slots * Ng * Ng);
+
+    Teuchos::RCP<MATRIX> M =
+        MatrixTraits<T>::construct_fe_matrix(d_map, num_slots * Ng);
+
+    Teuchos::ArrayRCP<int>    inds(num_slots * Ng);
+    Teuchos::ArrayRCP<double> vals(num_slots * Ng);
+
+    for (int t = 0; t < Nt; ++t)
+    {
+        int I = d_touched[t];
+        for (int g = 0; g < Ng; ++g)
+        {
+            if (weight[g + Ng * t] == 0.0)
+                continue;
+
+            int count = 0;
+            for (int slot = 0; slot < num_slots; ++slot)
+            {
+                int J = stencil ? neighbor_cell(I, slot) : I;
+                if (J < 0)
+                    continue;
+
+                const double *blk = &blocks[Ng * Ng * (slot + num_slots * t)];
+                for (int gp = 0; gp < Ng; ++gp)
+                {
+                    inds[count] = gp + Ng * J;
+                    vals[count] = blk[g + Ng * gp];
+                    ++count;
+                }
+            }
+            MatrixTraits<T>::add_to_matrix(M, g + Ng * I, count, inds, vals);
+        }
+    }
+
+    // decoupled unknowns
+    if (stencil)
+    {
+        Teuchos::ArrayRCP<int>    diag(1);
+        Teuchos::ArrayRCP<double> one(1, 1.0);
+        for (int row = 0; row < owned_weight.size(); ++row)
+        {
+            if (owned_weight[row] == 0.0)
+            {
+                diag[0] = ImportTraits<T>::global_index(*d_map, row);
+                MatrixTraits<T>::add_to_matrix(M, diag[0], 1, diag, one);
+            }
+        }
+    }
+
+    MatrixTraits<T>::assemble_fe_matrix(M);
+    return M;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Global sum of the entries of a coarse vector.
+ */
+template <class T>
+double Coarse_Mesh_Rebalance<T>::sum(Teuchos::RCP<const MV> v)
+{
+    Teuchos::ArrayRCP<const double> y = VectorTraits<T>::get_data(v);
+
+    double result = 0.0;
+    for (int i = 0; i < y.size(); ++i)
+    {
+        result += y[i];
+    }
+    profugus::global_sum(result);
+    return result;
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_Coarse_Mesh_Rebalance_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Coarse_Mesh_Rebalance.t.hh
+//---------------------------------------------------------------------------//
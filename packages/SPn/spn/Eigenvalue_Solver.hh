@@ -15,8 +15,10 @@
 
 #include "harness/DBC.hh"
 #include "comm/Timer.hh"
+#include "utils/Definitions.hh"
 #include "solvers/EigenvalueSolver.hh"
 #include "Solver_Base.hh"
+#include "Coarse_Mesh_Rebalance.hh"
 
 namespace profugus
 {
@@ -35,6 +37,34 @@ namespace profugus
  * is the (dominant) eigenvalue.  In order to write the scalar flux (0\e th
  * SPN moment) into the state use write_state().
  *
+ * If "rebalance" is true in the "eigenvalue_db" the outer iterations are
+ * accelerated with Coarse_Mesh_Rebalance: the eigensolver is restarted
+ * every "rebalance_frequency" (1) iterations after the iterate is
+ * rebalanced on the coarse mesh.  This is intended for the "Power"
+ * eigensolver.  A rebalance that fails (singular or non-positive coarse
+ * problem) leaves the iterate unchanged; failures are counted and reported.
+ *
+ * The "block_size" (1) entry of the "eigenvalue_db" sets the Davidson
+ * "Block Size": the subspace is expanded by that many correction vectors
+ * per iteration, and they are preconditioned together (see
+ * Energy_Multigrid).
+ *
+ * Repeated solves inside an outer iteration (material feedback, fission
+ * matrix acceleration) are warm-started.  The eigenvector and eigenvalue
+ * persist across calls to setup(), and set_initial_guess() seeds them from
+ * an external solution.  The preconditioner is kept across setup() calls
+ * with the same mesh, equations, adjoint state, and material assignment
+ * as long as the maximum relative change in the cross sections is no more
+ * than "prec_reuse_tolerance" (0.0) in the "eigenvalue_db"; a negative
+ * tolerance rebuilds the preconditioner on every setup().  A reused
+ * preconditioner still refers to the matrix it was built from, so while it
+ * is reused that matrix stays allocated next to the current one: the fine
+ * matrix storage doubles for the Ifpack, ML, Stratimikos, and
+ * double-precision Multigrid preconditioners.  "Block Jacobi" and
+ * single-precision Multigrid keep only their own (factored or
+ * single-precision) data.  The rest of the previous linear system is
+ * released.
+ *
  * \sa spn::Linear_System
  */
 /*!
@@ -87,6 +117,27 @@ class Eigenvalue_Solver : public Solver_Base_Tmpl<T>
     // Material database
     RCP_Mat_DB d_mat;
 
+    // Coarse-mesh rebalance (null if not used).
+    Teuchos::RCP<Coarse_Mesh_Rebalance<T> > d_rebalance;
+    int                                     d_rebalance_freq;
+
+    // Preconditioner and the state it was built with (the matrix is kept
+    // only for preconditioners that do not hold a reference to it).
+    RCP_OP       d_prec;
+    RCP_OP       d_prec_matrix;
+    RCP_Mesh     d_prec_mesh;
+    int          d_prec_Ne;
+    bool         d_prec_adjoint;
+    def::Vec_Int d_prec_matids;
+    def::Vec_Dbl d_prec_xs;
+
+    // Number of preconditioner builds.
+    int d_num_prec_builds;
+
+    // Outer iterations and failed rebalances in the last solve.
+    int d_num_iters;
+    int d_num_rebalance_failures;
+
   public:
     // Constructor.
     explicit Eigenvalue_Solver(RCP_ParameterList db);
@@ -100,6 +151,9 @@ class Eigenvalue_Solver : public Solver_Base_Tmpl<T>
                RCP_Global_Data data, RCP_Linear_System system,
                bool adjoint = false);
 
+    // Seed the eigenvector and eigenvalue from a previous solution.
+    void set_initial_guess(Teuchos::RCP<const MV> u, double keff);
+
     // Solve the SPN eigenvalue equations.
     void solve(Teuchos::RCP<const External_Source> q);
 
@@ -114,6 +168,18 @@ class Eigenvalue_Solver : public Solver_Base_Tmpl<T>
     //! Get eigen-vector (in transformed \e u space).
     Teuchos::RCP<const MV> get_eigenvector() const { return d_u; }
 
+    //! Get the eigensolver preconditioner (null if there is none).
+    RCP_OP preconditioner() const { return d_prec; }
+
+    //! Number of times the preconditioner has been built.
+    int num_preconditioner_builds() const { return d_num_prec_builds; }
+
+    //! Number of outer (eigensolver) iterations in the last solve.
+    int num_iters() const { return d_num_iters; }
+
+    //! Number of failed coarse-mesh rebalances in the last solve.
+    int num_rebalance_failures() const { return d_num_rebalance_failures; }
+
     //! Write problem matrices to file
     void write_problem_to_file() const;
 
@@ -123,6 +189,18 @@ class Eigenvalue_Solver : public Solver_Base_Tmpl<T>
     // Set db defaults
     void set_default_parameters();
 
+    // Build the coarse-mesh rebalance.
+    void build_rebalance(RCP_Mat_DB mat, RCP_Mesh mesh, RCP_Indexer indexer,
+                         RCP_Global_Data data);
+
+    // Get the preconditioner, rebuilding it only if the problem changed.
+    RCP_OP get_preconditioner(RCP_Dimensions dim, RCP_Mat_DB mat,
+                              RCP_Mesh mesh, RCP_Indexer indexer,
+                              RCP_Global_Data data, bool adjoint);
+
+    // Cross section data that defines the preconditioner.
+    static void xs_data(const Mat_DB &mat, def::Vec_Dbl &data);
+
     // Build the preconditioner.
     RCP_OP build_preconditioner(RCP_Dimensions dim, RCP_Mat_DB mat,
                                 RCP_Mesh mesh, RCP_Indexer indexer,
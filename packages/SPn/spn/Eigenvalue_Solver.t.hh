@@ -11,11 +11,14 @@
 #ifndef SPn_spn_Eigenvalue_Solver_t_hh
 #define SPn_spn_Eigenvalue_Solver_t_hh
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 
 #include "Teuchos_XMLParameterListHelpers.hpp"
 
+#include "harness/Warnings.hh"
+
 #include "comm/P_Stream.hh"
 #include "comm/global.hh"
 #include "utils/String_Functions.hh"
@@ -40,6 +43,9 @@ template <class T>
 Eigenvalue_Solver<T>::Eigenvalue_Solver(RCP_ParameterList db)
     : Base(db)
     , d_keff(2.0)
+    , d_num_prec_builds(0)
+    , d_num_iters(0)
+    , d_num_rebalance_failures(0)
 {
     REQUIRE(!b_db.is_null());
 }
@@ -132,12 +138,15 @@ void Eigenvalue_Solver<T>::setup(RCP_Dimensions  dim,
     b_system->set_adjoint(adjoint);
 
     // Build a preconditioenr
-    RCP_OP prec = build_preconditioner(dim, mat, mesh, indexer, data);
+    RCP_OP prec = get_preconditioner(dim, mat, mesh, indexer, data, adjoint);
 
     // Build the eigensolver
     d_eigensolver = EigenvalueSolverBuilder<T>::build_solver(
         edb, b_system->get_Operator(), b_system->get_fission_matrix(), prec);
 
+    // Build the coarse-mesh rebalance
+    build_rebalance(mat, mesh, indexer, data);
+
     ENSURE(!d_eigensolver.is_null());
 }
 
@@ -192,16 +201,45 @@ void Eigenvalue_Solver<T>::setup(RCP_Mat_DB        mat,
     b_system->set_adjoint(adjoint);
 
     // Build a preconditioenr
-    RCP_OP prec = build_preconditioner(
-        b_system->get_dims(), mat, mesh, indexer, data);
+    RCP_OP prec = get_preconditioner(
+        b_system->get_dims(), mat, mesh, indexer, data, adjoint);
 
     // Build the eigensolver
     d_eigensolver = EigenvalueSolverBuilder<T>::build_solver(
         edb, b_system->get_Operator(), b_system->get_fission_matrix(), prec);
 
+    // Build the coarse-mesh rebalance
+    build_rebalance(mat, mesh, indexer, data);
+
     ENSURE(!d_eigensolver.is_null());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Seed the eigenvector and eigenvalue from a previous solution.
+ *
+ * This must be called after setup().  The vector must have the same layout
+ * as the current linear system; only its data is copied.
+ */
+template <class T>
+void Eigenvalue_Solver<T>::set_initial_guess(Teuchos::RCP<const MV> u,
+                                             double                 keff)
+{
+    REQUIRE(!u.is_null());
+    REQUIRE(!d_u.is_null());
+    REQUIRE(VectorTraits<T>::local_length(u) ==
+            VectorTraits<T>::local_length(d_u));
+    REQUIRE(keff > 0.0);
+
+    Teuchos::ArrayRCP<const double> u_data =
+        VectorTraits<T>::get_data(u);
+    Teuchos::ArrayRCP<double> d_u_data =
+        VectorTraits<T>::get_data_nonconst(d_u);
+    d_u_data.deepCopy(u_data());
+
+    d_keff = keff;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Solve the SPN eigenvalue equations.
@@ -214,8 +252,48 @@ void Eigenvalue_Solver<T>::solve(Teuchos::RCP<const External_Source> q)
     REQUIRE(!d_u.is_null());
     REQUIRE(!d_eigensolver.is_null());
 
+    d_num_rebalance_failures = 0;
+
     // solve the problem
-    d_eigensolver->solve(d_keff, d_u);
+    if (d_rebalance.is_null())
+    {
+        d_eigensolver->solve(d_keff, d_u);
+        d_num_iters = d_eigensolver->num_iters();
+    }
+    else
+    {
+        // total iteration limit
+        int max_itr = b_db->sublist("eigenvalue_db").template get<int>(
+            "max_itr");
+
+        // restart the eigensolver after rebalancing every
+        // rebalance_frequency iterations
+        d_eigensolver->set_max_iters(d_rebalance_freq);
+        d_num_iters = 0;
+        while (true)
+        {
+            d_eigensolver->solve(d_keff, d_u);
+            d_num_iters += std::max(d_eigensolver->num_iters(), 1);
+
+            if (d_eigensolver->converged() || d_num_iters >= max_itr)
+                break;
+
+            // a failed rebalance leaves the iterate and eigenvalue alone
+            if (!d_rebalance->rebalance(d_u, d_keff))
+                ++d_num_rebalance_failures;
+        }
+        d_eigensolver->set_max_iters(max_itr);
+
+        profugus::pout << "Coarse-mesh rebalanced eigensolver took "
+                       << d_num_iters << " iterations" << profugus::endl;
+
+        if (d_num_rebalance_failures)
+        {
+            ADD_WARNING("Coarse-mesh rebalance failed "
+                        << d_num_rebalance_failures << " times in "
+                        << d_num_iters << " iterations");
+        }
+    }
 
     profugus::pout << profugus::setprecision(10) << profugus::fixed;
     profugus::pout << "k-eff = " << d_keff << profugus::endl;
@@ -291,6 +369,36 @@ void Eigenvalue_Solver<T>::write_state(State &state)
 
 //---------------------------------------------------------------------------//
 // PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the coarse-mesh rebalance if it is requested.
+ */
+template <class T>
+void Eigenvalue_Solver<T>::build_rebalance(RCP_Mat_DB      mat,
+                                           RCP_Mesh        mesh,
+                                           RCP_Indexer     indexer,
+                                           RCP_Global_Data data)
+{
+    REQUIRE(b_db->isSublist("eigenvalue_db"));
+
+    RCP_ParameterList edb = Teuchos::sublist(b_db, "eigenvalue_db");
+
+    d_rebalance = Teuchos::null;
+    if (!edb->get("rebalance", false))
+        return;
+
+    // the coarse-mesh mapping requires the finite-volume system
+    Teuchos::RCP<Linear_System_FV<T> > fv =
+        Teuchos::rcp_dynamic_cast<Linear_System_FV<T> >(b_system);
+    INSIST(!fv.is_null(), "Coarse-mesh rebalance requires the FV system.");
+
+    d_rebalance_freq = edb->get("rebalance_frequency", 1);
+    VALIDATE(d_rebalance_freq > 0, "rebalance_frequency must be positive.");
+
+    d_rebalance = Teuchos::rcp(new Coarse_Mesh_Rebalance<T>(
+                                   edb, fv, mat, mesh, indexer, data));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Set default db entries for eigenvalue solvers
@@ -385,6 +493,10 @@ void Eigenvalue_Solver<EpetraTypes>::set_default_parameters()
     eig_db->sublist("Anasazi").get("Convergence Tolerance", tol);
     eig_db->sublist("Anasazi").get("Maximum Restarts", max_itr);
 
+    // propagate the Davidson block size
+    int block_size = eig_db->get("block_size", 1);
+    eig_db->sublist("Anasazi").get("Block Size", block_size);
+
     // propagate stopping criteria for operators
     eig_db->sublist("operator_db").get("tolerance", 0.1 * tol);
     eig_db->sublist("operator_db").get("max_itr", max_itr);
@@ -506,11 +618,118 @@ void Eigenvalue_Solver<TpetraTypes>::set_default_parameters()
     eig_db->sublist("Anasazi").get("Convergence Tolerance", tol);
     eig_db->sublist("Anasazi").get("Maximum Restarts", max_itr);
 
+    // propagate the Davidson block size
+    int block_size = eig_db->get("block_size", 1);
+    eig_db->sublist("Anasazi").get("Block Size", block_size);
+
     // propagate stopping criteria for operators
     eig_db->sublist("operator_db").get("tolerance", 0.1 * tol);
     eig_db->sublist("operator_db").get("max_itr", max_itr);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the preconditioner, reusing the previous one when possible.
+ *
+ * The previous preconditioner is reused if the mesh, number of equations,
+ * adjoint state, and cell material ids are unchanged and the largest change
+ * in the cross sections relative to the largest previous cross section is
+ * no more than "prec_reuse_tolerance".  The decision is reduced over all
+ * domains because building a preconditioner may be collective.
+ */
+template <class T>
+Teuchos::RCP<typename T::OP>
+Eigenvalue_Solver<T>::get_preconditioner(RCP_Dimensions  dim,
+                                         RCP_Mat_DB      mat,
+                                         RCP_Mesh        mesh,
+                                         RCP_Indexer     indexer,
+                                         RCP_Global_Data data,
+                                         bool            adjoint)
+{
+    REQUIRE(b_db->isSublist("eigenvalue_db"));
+
+    double tol = b_db->sublist("eigenvalue_db").get(
+        "prec_reuse_tolerance", 0.0);
+
+    // cross section data for this problem
+    def::Vec_Dbl xs;
+    xs_data(*mat, xs);
+
+    // determine whether the problem has changed on this domain
+    int rebuild = 1;
+    if (!d_prec.is_null() && tol >= 0.0 && mesh == d_prec_mesh &&
+        dim->num_equations() == d_prec_Ne && adjoint == d_prec_adjoint &&
+        mat->matids() == d_prec_matids && xs.size() == d_prec_xs.size())
+    {
+        double diff = 0.0, ref = 0.0;
+        for (int n = 0; n < xs.size(); ++n)
+        {
+            diff = std::max(diff, std::fabs(xs[n] - d_prec_xs[n]));
+            ref  = std::max(ref, std::fabs(d_prec_xs[n]));
+        }
+        rebuild = diff > tol * ref ? 1 : 0;
+    }
+    profugus::global_max(rebuild);
+
+    if (rebuild)
+    {
+        d_prec = build_preconditioner(dim, mat, mesh, indexer, data);
+        ++d_num_prec_builds;
+
+        // store the state the preconditioner was built with
+        d_prec_mesh    = mesh;
+        d_prec_Ne      = dim->num_equations();
+        d_prec_adjoint = adjoint;
+        d_prec_matids  = mat->matids();
+        std::swap(d_prec_xs, xs);
+    }
+    else
+    {
+        profugus::pout << "Reusing SPN eigenvalue preconditioner"
+                       << profugus::endl;
+    }
+
+    return d_prec;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Flatten the cross sections of all materials (in matid order).
+ */
+template <class T>
+void Eigenvalue_Solver<T>::xs_data(const Mat_DB &mat, def::Vec_Dbl &data)
+{
+    typedef Mat_DB::XS_t XS;
+
+    const XS &xs = mat.xs();
+    const int Ng = xs.num_groups();
+
+    def::Vec_Int matids;
+    xs.get_matids(matids);
+    std::sort(matids.begin(), matids.end());
+
+    data.clear();
+    for (int m = 0; m < matids.size(); ++m)
+    {
+        for (int type = 0; type < XS::END_XS_TYPES; ++type)
+        {
+            const XS::Vector &v = xs.vector(matids[m], type);
+            data.insert(data.end(), v.values(), v.values() + v.length());
+        }
+        for (int n = 0; n <= xs.pn_order(); ++n)
+        {
+            const XS::Matrix &s = xs.matrix(matids[m], n);
+            for (int g = 0; g < Ng; ++g)
+            {
+                for (int gp = 0; gp < Ng; ++gp)
+                {
+                    data.push_back(s(g, gp));
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Build preconditioner
@@ -528,6 +747,9 @@ Eigenvalue_Solver<T>::build_preconditioner(RCP_Dimensions  dim,
     // preconditioner operator
     RCP_OP prec;
 
+    // release the matrix of the previous preconditioner
+    d_prec_matrix = Teuchos::null;
+
     // get the eigenvalue database
     RCP_ParameterList edb = Teuchos::sublist(b_db, "eigenvalue_db");
 
@@ -561,10 +783,24 @@ Eigenvalue_Solver<T>::build_preconditioner(RCP_Dimensions  dim,
 
         CHECK(prec != Teuchos::null);
     }
+    else if (prec_type == "block jacobi")
+    {
+        // invert the diagonal blocks of a block (BSR) matrix
+        Teuchos::RCP<const BSR_Matrix<T> > A =
+            Teuchos::rcp_dynamic_cast<const BSR_Matrix<T> >(
+                b_system->get_Operator());
+        INSIST(!A.is_null(),
+               "Block Jacobi preconditioning requires 'bsr' matrix storage.");
+        prec = Teuchos::rcp(new BSR_Block_Jacobi<T>(A));
+    }
     else
     {
         prec = PreconditionerBuilder<T>::build_preconditioner(
             b_system->get_Operator(),edb);
+
+        // Ifpack and ML only reference the matrix, which must outlive the
+        // preconditioner when it is reused after the system is rebuilt
+        d_prec_matrix = b_system->get_Operator();
     }
 
     return prec;
@@ -11,10 +11,19 @@
 #ifndef SPn_spn_Energy_Multigrid_t_hh
 #define SPn_spn_Energy_Multigrid_t_hh
 
+#include <algorithm>
+#include <map>
+#include <sstream>
+
 #include "solvers/PreconditionerBuilder.hh"
 #include "solvers/LinAlgTypedefs.hh"
+#include "utils/String_Functions.hh"
 #include "xs/Energy_Collapse.hh"
+#include "BSR_Matrix.hh"
 #include "Linear_System_FV.hh"
+#include "Single_Precision_Matrix.hh"
+#include "Space_Energy_Restriction.hh"
+#include "Space_Energy_Prolongation.hh"
 #include "Energy_Multigrid.hh"
 #include "VectorTraits.hh"
 
@@ -36,6 +45,9 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
                                       Teuchos::RCP<Linear_System<T> >
                                           fine_system)
     : OperatorAdapter<T>(fine_system->get_Map())
+    , d_single(false)
+    , d_refinements(0)
+    , d_max_block_size(0)
 {
     using Teuchos::RCP;
     using Teuchos::rcp;
@@ -45,66 +57,153 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
     int max_depth     = prec_db->get("Max Depth", 10);
     int fine_groups   = mat_db->xs().num_groups();
 
+    // storage precision of the smoother operators
+    std::string precision = profugus::lower(
+        prec_db->get("Precision", std::string("double")));
+    VALIDATE(precision == "double" || precision == "single",
+             "Invalid multigrid precision " << precision
+             << "; must be 'double' or 'single'.");
+    d_single = (precision == "single");
+
+    // double-precision iterative refinement of the V-cycle
+    d_refinements = prec_db->get("Refinement Iterations", d_single ? 1 : 0);
+    VALIDATE(d_refinements >= 0,
+             "Invalid number of refinement iterations " << d_refinements);
+
+    // optionally cache the collapsed cross sections so that rebuilding the
+    // preconditioner does not recollapse them; the cache is kept in the
+    // preconditioner database, so it is shared only by preconditioners
+    // built from the same database
+    int cache_size = prec_db->get("Collapse Cache Size", 0);
+    VALIDATE(cache_size >= 0, "Invalid collapse cache size " << cache_size);
+    if (cache_size > 0)
+    {
+        typedef Energy_Collapse::RCP_Cache RCP_Cache;
+        if (!prec_db->isType<RCP_Cache>("Collapse Cache"))
+        {
+            prec_db->set("Collapse Cache",
+                         RCP_Cache(new Energy_Collapse::Cache(cache_size)));
+        }
+        d_collapse_cache = prec_db->get<RCP_Cache>("Collapse Cache");
+        d_collapse_cache->set_capacity(cache_size);
+    }
+
+    // coarsening strategy
+    std::string coarsening = profugus::lower(
+        prec_db->get("Coarsening", std::string("energy")));
+    VALIDATE(coarsening == "energy" || coarsening == "space-energy" ||
+             coarsening == "alternating",
+             "Invalid multigrid coarsening " << coarsening
+             << "; must be 'energy', 'space-energy', or 'alternating'.");
+    bool space = (coarsening != "energy");
+
     // old and new groups
     int old_groups = 0, new_groups = fine_groups;
 
     // material databases for preconditioner
     Teuchos::RCP<Mat_DB> old_mat, new_mat = mat_db;
 
+    // mesh objects for preconditioner
+    Teuchos::RCP<Mesh>             level_mesh    = mesh;
+    Teuchos::RCP<LG_Indexer>       level_indexer = indexer;
+    Teuchos::RCP<Global_Mesh_Data> level_data    = data;
+
+    // previous level system (only needed for spatial coarsening)
+    RCP<Linear_System_FV<T> > old_system;
+    if (space)
+    {
+        old_system = Teuchos::rcp_dynamic_cast<Linear_System_FV<T> >(
+            fine_system);
+        INSIST(!old_system.is_null(),
+               "Spatial multigrid coarsening requires the FV system.");
+    }
+
     // Fill vectors with fine level objects, don't build new matrix
-    d_operators.push_back(fine_system->get_Operator());
+    d_operators.push_back(build_operator(fine_system, d_single));
     d_maps.push_back( fine_system->get_Map() );
     d_solutions.push_back( VectorTraits<T>::build_vector(d_maps[0]) );
     d_residuals.push_back( VectorTraits<T>::build_vector(d_maps[0]) );
     d_rhss.push_back( VectorTraits<T>::build_vector(d_maps[0]) );
 
-    // Build level 0 smoother
-    RCP_ParameterList smoother_db = sublist(prec_db, "Smoother");
-    d_smoothers.push_back(
-        LinearSolverBuilder<T>::build_solver(smoother_db));
-    d_smoothers.back()->set_operator(d_operators.back());
-    d_preconditioners.push_back(PreconditionerBuilder<T>::
-        build_preconditioner(fine_system->get_Matrix(),smoother_db) );
-    if (d_preconditioners.back() != Teuchos::null)
-    {
-        d_smoothers.back()->set_preconditioner(d_preconditioners.back());
-    }
-    else
+    // The refinement residual is computed with the (double-precision)
+    // operator of the fine system, which is owned by the caller
+    if (d_refinements > 0)
     {
-        d_smoothers.back()->set_preconditioner(fine_system->get_Matrix());
+        d_fine_operator     = fine_system->get_Operator();
+        d_refine_residual   = VectorTraits<T>::build_vector(d_maps[0]);
+        d_refine_correction = VectorTraits<T>::build_vector(d_maps[0]);
     }
 
+    // Build level 0 smoother
+    add_smoother(fine_system, smoother_db(prec_db, 0), fine_groups);
+
     // loop through levels
     int level = 0;
+    bool more_levels = true;
     do
     {
         level++;
 
+        // Determine whether this level coarsens in energy and/or space;
+        // alternating coarsening does one at a time while both are possible
+        Mesh_Coarsener coarsener(level_mesh, level_indexer, level_data);
+        bool coarsen_energy = !space || new_groups > 1;
+        bool coarsen_space  = space && coarsener.coarsenable();
+        if (coarsening == "alternating" && coarsen_energy && coarsen_space)
+        {
+            coarsen_energy = (level % 2 == 1);
+            coarsen_space  = !coarsen_energy;
+        }
+        CHECK(coarsen_energy || coarsen_space);
+
         // Determine number of groups at next level
         old_groups = new_groups;
-        new_groups = old_groups / coarse_factor;
-        std::vector<int> collapse(new_groups,coarse_factor);
-        int extra_grps = old_groups%coarse_factor;
-        if( extra_grps > 0 )
+        std::vector<int> collapse;
+        if (coarsen_energy)
+        {
+            new_groups = old_groups / coarse_factor;
+            collapse.assign(new_groups,coarse_factor);
+            int extra_grps = old_groups%coarse_factor;
+            if( extra_grps > 0 )
+            {
+                new_groups++;
+                collapse.push_back(extra_grps);
+            }
+        }
+        else
         {
-            new_groups++;
-            collapse.push_back(extra_grps);
+            collapse.assign(old_groups,1);
         }
 
         // Create new Mat_DB
-        std::vector<double> weights(old_groups,1.0);
         old_mat = new_mat;
-        new_mat = Energy_Collapse::collapse_all_mats(
-            old_mat, collapse, weights);
-        CHECK( !new_mat.is_null() );
+        if (coarsen_energy)
+        {
+            std::vector<double> weights(old_groups,1.0);
+            new_mat = Energy_Collapse::collapse_all_mats(
+                old_mat, collapse, weights, d_collapse_cache);
+            CHECK( !new_mat.is_null() );
+        }
+
+        // Agglomerate the mesh and homogenize the materials on it
+        Teuchos::RCP<Mesh> old_mesh = level_mesh;
+        if (coarsen_space)
+        {
+            coarsener.build();
+            new_mat       = collapse_space(new_mat, old_mesh, coarsener);
+            level_mesh    = coarsener.get_mesh();
+            level_indexer = coarsener.get_indexer();
+            level_data    = coarsener.get_global_data();
+        }
 
         // Build linear system
-        RCP<Linear_System<T> > system = rcp(
+        RCP<Linear_System_FV<T> > system = rcp(
             new Linear_System_FV<T>(
-                main_db, dim, new_mat, mesh, indexer, data));
+                main_db, dim, new_mat, level_mesh, level_indexer,
+                level_data));
 
         system->build_Matrix();
-        d_operators.push_back( system->get_Operator() );
+        d_operators.push_back( build_operator(system, d_single) );
         CHECK( d_operators.back() != Teuchos::null );
 
         // Allocate vectors
@@ -114,36 +213,54 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
         d_rhss.push_back(      VectorTraits<T>::build_vector(d_maps[level]));
         d_residuals.push_back( VectorTraits<T>::build_vector(d_maps[level]));
 
-        // Build Restriction
-        d_restrictions.push_back(
-            rcp(new Energy_Restriction<T>(d_maps[level-1],
-                                          d_maps[level],
-                                          collapse)));
-
-        // Build Prolongation
-        d_prolongations.push_back(
-            rcp(new Energy_Prolongation<T>(d_maps[level],
-                                           d_maps[level-1],
-                                           collapse)));
-
-        // Build smoother
-        d_smoothers.push_back(
-            LinearSolverBuilder<T>::build_solver(smoother_db));
-        d_smoothers.back()->set_operator(d_operators.back());
-
-        // Store and set preconditioner
-        d_preconditioners.push_back(PreconditionerBuilder<T>::
-            build_preconditioner(system->get_Matrix(),smoother_db) );
-        if( d_preconditioners.back() != Teuchos::null )
+        if (coarsen_space)
         {
-            d_smoothers.back()->set_preconditioner(d_preconditioners.back());
+            // Map the fine spatial unknowns to the coarse spatial unknowns
+            std::vector<int>    spatial_map;
+            std::vector<double> spatial_weights;
+            map_spatial_unknowns(*old_system, *system, *old_mesh, coarsener,
+                                 spatial_map, spatial_weights);
+
+            // Build Restriction
+            d_restrictions.push_back(
+                rcp(new Space_Energy_Restriction<T>(
+                        d_maps[level-1], d_maps[level], spatial_map,
+                        spatial_weights, collapse)));
+
+            // Build Prolongation
+            d_prolongations.push_back(
+                rcp(new Space_Energy_Prolongation<T>(
+                        d_maps[level], d_maps[level-1], spatial_map,
+                        collapse)));
         }
         else
         {
-            d_smoothers.back()->set_preconditioner(system->get_Matrix());
+            // Build Restriction
+            d_restrictions.push_back(
+                rcp(new Energy_Restriction<T>(d_maps[level-1],
+                                              d_maps[level],
+                                              collapse)));
+
+            // Build Prolongation
+            d_prolongations.push_back(
+                rcp(new Energy_Prolongation<T>(d_maps[level],
+                                               d_maps[level-1],
+                                               collapse)));
         }
+        old_system = system;
 
-    } while( new_groups!=1 && level!=max_depth );
+        // Build smoother
+        add_smoother(system, smoother_db(prec_db, level), new_groups);
+
+        // Continue while the problem can be coarsened in energy or space
+        more_levels = new_groups != 1;
+        if (space && !more_levels)
+        {
+            more_levels = Mesh_Coarsener(
+                level_mesh, level_indexer, level_data).coarsenable();
+        }
+
+    } while( more_levels && level!=max_depth );
 
     d_num_levels = level+1;
 
@@ -162,7 +279,7 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
         {
             d_smoothers.back()->set_preconditioner(d_preconditioners.back());
         }
-        else
+        else if (d_smoothers.back()->uses_operator_preconditioner())
         {
             d_smoothers.back()->set_preconditioner(d_operators.back());
         }
@@ -180,60 +297,472 @@ void Energy_Multigrid<T>::ApplyImpl(const MV &x,
     int num_vectors = MVT::GetNumberVecs(x);
     REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
 
-    // Process each vector in multivec individually (all of the
-    //  multivecs have been allocated for a single vec)
+    // Process the whole block at once; smoothers that do not support
+    //  blocks work on individual vectors
+    resize_work_vectors(num_vectors);
+    d_max_block_size = std::max(d_max_block_size, num_vectors);
+
+    v_cycle(x,y);
+
+    // Iterative refinement: the residual of the cycle is computed in
+    //  double precision and corrected with another cycle
+    for( int k=0; k<d_refinements; ++k )
+    {
+        OPT::Apply(*d_fine_operator,y,*d_refine_residual);
+        MVT::MvAddMv(1.0,x,-1.0,*d_refine_residual,*d_refine_residual);
+
+        v_cycle(*d_refine_residual,*d_refine_correction);
+        MVT::MvAddMv(1.0,y,1.0,*d_refine_correction,y);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply one V-cycle to a block.
+ *
+ * The work vectors must already be sized for the block.
+ */
+template <class T>
+void Energy_Multigrid<T>::v_cycle(const MV &x,
+                                        MV &y ) const
+{
+    REQUIRE(MVT::GetNumberVecs(x) == MVT::GetNumberVecs(*d_solutions[0]));
+
+    MVT::Assign(x,*d_residuals[0]);
+    MVT::Assign(x,*d_rhss[0]);
+    MVT::MvInit(*d_solutions[0],0.0);
+
+    // In a true multigrid V-cycle, the first operation is a
+    //  restriction rather than smoothing.  Smoothing on the finest
+    //  level is only done at the end of the cycle.  This way if two
+    //  V-cycles are stacked back-to-back, only a single smoothing
+    //  step is done in the middle.
+
+    for( int ilevel=1; ilevel<d_num_levels; ++ilevel )
+    {
+        // Restrict residual from previous level
+        OPT::Apply(*d_restrictions[ilevel-1],
+                   *d_residuals[ilevel-1],
+                   *d_rhss[ilevel]);
+
+        // Apply smoother
+        MVT::MvInit(*d_solutions[ilevel],0.0);
+        smooth(ilevel);
+
+        // Compute residual (except on coarsest level)
+        if( ilevel != d_num_levels-1 )
+        {
+            OPT::Apply(*d_operators[ilevel],
+                       *d_solutions[ilevel],
+                       *d_residuals[ilevel]);
+
+            MVT::MvAddMv(1.0,*d_rhss[ilevel],-1.0,*d_residuals[ilevel],
+                         *d_residuals[ilevel]);
+        }
+    }
+
+    for( int ilevel=d_num_levels-2; ilevel>=0; --ilevel )
+    {
+        // Prolong solution vector to next level: x[l] = x[l] + P*x[l-1]
+        // Residual is used for tmp storage here
+        OPT::Apply(*d_prolongations[ilevel],*d_solutions[ilevel+1],
+                   *d_residuals[ilevel]);
+        MVT::MvAddMv(1.0,*d_residuals[ilevel],1.0,*d_solutions[ilevel],
+                     *d_solutions[ilevel]);
+
+        // Apply smoother
+        smooth(ilevel);
+    }
+
+    MVT::Assign(*d_solutions[0],y);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Size the level work vectors for a block of vectors.
+ *
+ * The work vectors are only reallocated when the block size changes.
+ */
+template <class T>
+void Energy_Multigrid<T>::resize_work_vectors(int num_vectors) const
+{
+    REQUIRE(num_vectors > 0);
+
+    if( MVT::GetNumberVecs(*d_solutions[0]) == num_vectors )
+        return;
+
+    for( int ilevel=0; ilevel<d_num_levels; ++ilevel )
+    {
+        d_solutions[ilevel] = MVT::Clone(*d_solutions[ilevel],num_vectors);
+        d_residuals[ilevel] = MVT::Clone(*d_residuals[ilevel],num_vectors);
+        d_rhss[ilevel]      = MVT::Clone(*d_rhss[ilevel],num_vectors);
+    }
+    if( d_refinements > 0 )
+    {
+        d_refine_residual   = MVT::Clone(*d_refine_residual,num_vectors);
+        d_refine_correction = MVT::Clone(*d_refine_correction,num_vectors);
+    }
+
+    ENSURE(MVT::GetNumberVecs(*d_solutions[0]) == num_vectors);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the smoother on a level to the block.
+ *
+ * Smoothers that do not support blocks are applied to each vector in turn.
+ */
+template <class T>
+void Energy_Multigrid<T>::smooth(int level) const
+{
+    REQUIRE(level < d_num_levels);
+
+    int num_vectors = MVT::GetNumberVecs(*d_solutions[level]);
+    if( num_vectors == 1 || d_smoothers[level]->supports_blocks() )
+    {
+        d_smoothers[level]->solve(d_solutions[level],d_rhss[level]);
+        return;
+    }
+
     for( int ivec=0; ivec<num_vectors; ++ivec )
     {
         std::vector<int> ind(1,ivec);
-        Teuchos::RCP<const MV> xi = MVT::CloneView(x,ind);
-        MVT::Assign(*xi,*d_residuals[0]);
-        MVT::Assign(*xi,*d_rhss[0]);
-        MVT::MvInit(*d_solutions[0],0.0);
-
-        // In a true multigrid V-cycle, the first operation is a
-        //  restriction rather than smoothing.  Smoothing on the finest
-        //  level is only done at the end of the cycle.  This way if two
-        //  V-cycles are stacked back-to-back, only a single smoothing
-        //  step is done in the middle.
-
-        for( int ilevel=1; ilevel<d_num_levels; ++ilevel )
-        {
-            // Restrict residual from previous level
-            OPT::Apply(*d_restrictions[ilevel-1],
-                       *d_residuals[ilevel-1],
-                       *d_rhss[ilevel]);
-
-            // Apply smoother
-            MVT::MvInit(*d_solutions[ilevel],0.0);
-            d_smoothers[ilevel]->solve(d_solutions[ilevel],d_rhss[ilevel]);
-
-            // Compute residual (except on coarsest level)
-            if( ilevel != d_num_levels-1 )
+        Teuchos::RCP<MV> xi = MVT::CloneViewNonConst(*d_solutions[level],ind);
+        Teuchos::RCP<const MV> bi = MVT::CloneView(*d_rhss[level],ind);
+        d_smoothers[level]->solve(xi,bi);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the operator applied by the smoother on a level.
+ *
+ * In single precision the (point) matrix of the system is copied into a
+ * Single_Precision_Matrix; otherwise the operator of the system is used
+ * directly.
+ */
+template <class T>
+Teuchos::RCP<typename T::OP>
+Energy_Multigrid<T>::build_operator(
+    Teuchos::RCP<Linear_System<T> > system,
+    bool                            single) const
+{
+    if (!single)
+        return system->get_Operator();
+
+    VALIDATE(system->get_Matrix() != Teuchos::null,
+             "Single-precision multigrid requires an assembled 'crs' "
+             "matrix.");
+    return Teuchos::rcp(new Single_Precision_Matrix<T>(
+                            system->get_Map(), system->get_Matrix()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the preconditioner for the smoother on the newest level.
+ *
+ * A "Block Jacobi" preconditioner inverts the diagonal (GXG) blocks of a
+ * system stored in "bsr" format; all other preconditioners are built from
+ * the (point) matrix by the PreconditionerBuilder.
+ *
+ * In single precision only "None" and "Block Jacobi" are allowed, and the
+ * diagonal blocks are taken from the single-precision level operator, so
+ * that the preconditioner does not reference the double-precision matrix.
+ */
+template <class T>
+Teuchos::RCP<typename T::OP>
+Energy_Multigrid<T>::build_preconditioner(
+    Teuchos::RCP<Linear_System<T> > system,
+    RCP_ParameterList               smoother_db,
+    int                             num_groups) const
+{
+    std::string prec_type = profugus::lower(
+        smoother_db->get("Preconditioner", std::string("ifpack")));
+
+    if (d_single)
+    {
+        VALIDATE(prec_type == "none" || prec_type == "block jacobi",
+                 "Invalid single-precision smoother preconditioner "
+                 << prec_type << "; must be 'None' or 'Block Jacobi'.");
+        if (prec_type == "none")
+            return Teuchos::null;
+
+        Teuchos::RCP<const Single_Precision_Matrix<T> > A =
+            Teuchos::rcp_dynamic_cast<const Single_Precision_Matrix<T> >(
+                d_operators.back());
+        CHECK(!A.is_null());
+        return Teuchos::rcp(new Single_Precision_Block_Jacobi<T>(
+                                A, num_groups));
+    }
+
+    if (prec_type == "block jacobi")
+    {
+        Teuchos::RCP<const BSR_Matrix<T> > A =
+            Teuchos::rcp_dynamic_cast<const BSR_Matrix<T> >(
+                system->get_Operator());
+        INSIST(!A.is_null(),
+               "Block Jacobi preconditioning requires 'bsr' matrix storage.");
+        return Teuchos::rcp(new BSR_Block_Jacobi<T>(A));
+    }
+
+    return PreconditionerBuilder<T>::build_preconditioner(
+        system->get_Matrix(), smoother_db);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the smoother database for a level.
+ *
+ * A "Smoother Level <n>" sublist of the preconditioner database overrides
+ * the "Smoother" sublist on level \e n.
+ */
+template <class T>
+typename Energy_Multigrid<T>::RCP_ParameterList
+Energy_Multigrid<T>::smoother_db(RCP_ParameterList prec_db, int level) const
+{
+    std::ostringstream name;
+    name << "Smoother Level " << level;
+    if (prec_db->isSublist(name.str()))
+    {
+        return sublist(prec_db, name.str());
+    }
+    return sublist(prec_db, "Smoother");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the smoother and its preconditioner for the newest level.
+ *
+ * When there is no preconditioner the level operator is used if the smoother
+ * asks for it (LinearSolver::uses_operator_preconditioner()).  The level
+ * operator is the single-precision copy when one was made, so that no
+ * reference to the double-precision coarse matrix is kept.  \a Ng is the
+ * number of groups on the level (the size of the diagonal blocks).
+ */
+template <class T>
+void Energy_Multigrid<T>::add_smoother(Teuchos::RCP<Linear_System<T> > system,
+                                       RCP_ParameterList               db,
+                                       int                             Ng)
+{
+    REQUIRE(d_smoothers.size() + 1 == d_operators.size());
+
+    d_smoothers.push_back(LinearSolverBuilder<T>::build_solver(db));
+    d_smoothers.back()->set_operator(d_operators.back());
+
+    // Store and set preconditioner
+    d_preconditioners.push_back(build_preconditioner(system, db, Ng));
+    if (d_preconditioners.back() != Teuchos::null)
+    {
+        d_smoothers.back()->set_preconditioner(d_preconditioners.back());
+    }
+    else if (system->get_Matrix() != Teuchos::null &&
+             d_smoothers.back()->uses_operator_preconditioner())
+    {
+        d_smoothers.back()->set_preconditioner(d_operators.back());
+    }
+
+    ENSURE(d_smoothers.size() == d_preconditioners.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Homogenize the materials of a level on the coarse mesh.
+ *
+ * The cross sections of each coarse cell are the volume-weighted averages
+ * of the cross sections of its fine cells (flat flux weighting, as used for
+ * the energy collapse).  The fission spectrum is weighted by the fission
+ * production.  Coarse cells with the same material composition share a
+ * material.
+ */
+template <class T>
+Teuchos::RCP<Mat_DB>
+Energy_Multigrid<T>::collapse_space(Teuchos::RCP<Mat_DB>  mat,
+                                    Teuchos::RCP<Mesh>    mesh,
+                                    const Mesh_Coarsener &coarsener) const
+{
+    typedef Mat_DB::XS_t        XS_t;
+    typedef std::map<int,double> Composition;
+
+    REQUIRE(!mat.is_null());
+    REQUIRE(!coarsener.get_mesh().is_null());
+
+    const XS_t &xs = mat->xs();
+    int Ng  = xs.num_groups();
+    int Pn  = xs.pn_order();
+    int Ncc = coarsener.get_mesh()->num_cells();
+
+    // volume fraction of each fine material in each coarse cell
+    std::vector<Composition> comp(Ncc);
+    std::vector<double>      volume(Ncc, 0.0);
+    for (int cell = 0; cell < mesh->num_cells(); ++cell)
+    {
+        int cc = coarsener.coarse_cell(cell);
+        comp[cc][mat->matid(cell)] += mesh->volume(cell);
+        volume[cc]                 += mesh->volume(cell);
+    }
+
+    // assign a coarse material to each unique composition
+    std::map<Composition,int> ids;
+    std::vector<int>          matids(Ncc);
+    for (int cc = 0; cc < Ncc; ++cc)
+    {
+        CHECK(volume[cc] > 0.0);
+        for (auto &f : comp[cc])
+        {
+            f.second /= volume[cc];
+        }
+        matids[cc] = ids.insert(
+            std::make_pair(comp[cc], static_cast<int>(ids.size())))
+                     .first->second;
+    }
+
+    // homogenized cross sections
+    Mat_DB::RCP_XS coarse_xs = Teuchos::rcp(new XS_t);
+    coarse_xs->set(Pn, Ng);
+    for (const auto &m : ids)
+    {
+        XS_t::OneDArray tot(Ng, 0.0), nusigf(Ng, 0.0), chi(Ng, 0.0);
+        std::vector<XS_t::TwoDArray> scat(Pn + 1,
+                                          XS_t::TwoDArray(Ng, Ng, 0.0));
+
+        double production = 0.0;
+        for (const auto &f : m.first)
+        {
+            const XS_t::Vector &sig = xs.vector(f.first, XS_t::TOTAL);
+            const XS_t::Vector &nu  = xs.vector(f.first, XS_t::NU_SIG_F);
+            const XS_t::Vector &ch  = xs.vector(f.first, XS_t::CHI);
+
+            double p = 0.0;
+            for (int g = 0; g < Ng; ++g)
+            {
+                tot[g]    += f.second * sig[g];
+                nusigf[g] += f.second * nu[g];
+                p         += f.second * nu[g];
+            }
+            for (int g = 0; g < Ng; ++g)
             {
-                OPT::Apply(*d_operators[ilevel],
-                           *d_solutions[ilevel],
-                           *d_residuals[ilevel]);
+                chi[g] += p * ch[g];
+            }
+            production += p;
 
-                MVT::MvAddMv(1.0,*d_rhss[ilevel],-1.0,*d_residuals[ilevel],
-                             *d_residuals[ilevel]);
+            for (int n = 0; n <= Pn; ++n)
+            {
+                const XS_t::Matrix &sct = xs.matrix(f.first, n);
+                for (int g = 0; g < Ng; ++g)
+                {
+                    for (int gp = 0; gp < Ng; ++gp)
+                    {
+                        scat[n](g, gp) += f.second * sct(g, gp);
+                    }
+                }
             }
         }
 
-        for( int ilevel=d_num_levels-2; ilevel>=0; --ilevel )
+        coarse_xs->add(m.second, XS_t::TOTAL, tot);
+        if (production > 0.0)
         {
-            // Prolong solution vector to next level: x[l] = x[l] + P*x[l-1]
-            // Residual is used for tmp storage here
-            OPT::Apply(*d_prolongations[ilevel],*d_solutions[ilevel+1],
-                       *d_residuals[ilevel]);
-            MVT::MvAddMv(1.0,*d_residuals[ilevel],1.0,*d_solutions[ilevel],
-                         *d_solutions[ilevel]);
-
-            // Apply smoother
-            d_smoothers[ilevel]->solve(d_solutions[ilevel],d_rhss[ilevel]);
+            for (int g = 0; g < Ng; ++g)
+            {
+                chi[g] /= production;
+            }
+            coarse_xs->add(m.second, XS_t::NU_SIG_F, nusigf);
+            coarse_xs->add(m.second, XS_t::CHI, chi);
+        }
+        for (int n = 0; n <= Pn; ++n)
+        {
+            coarse_xs->add(m.second, n, scat[n]);
         }
+    }
+    coarse_xs->complete();
 
-        MVT::SetBlock(*d_solutions[0],ind,y);
+    // coarse material database
+    Teuchos::RCP<Mat_DB> coarse_mat = Teuchos::rcp(new Mat_DB);
+    coarse_mat->set(coarse_xs, Ncc);
+    for (int cc = 0; cc < Ncc; ++cc)
+    {
+        coarse_mat->matid(cc) = matids[cc];
     }
+
+    ENSURE(coarse_mat->xs().num_groups() == Ng);
+    return coarse_mat;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Map the spatial unknowns of a level to the next coarser level.
+ *
+ * Cells map to their coarse cells with volume-fraction weights.  Boundary
+ * faces map to the coarse boundary faces that contain them with
+ * area-fraction weights.
+ */
+template <class T>
+void Energy_Multigrid<T>::map_spatial_unknowns(
+    const Linear_System_FV<T> &fine_system,
+    const Linear_System_FV<T> &coarse_system,
+    const Mesh                &fine_mesh,
+    const Mesh_Coarsener      &coarsener,
+    std::vector<int>          &spatial_map,
+    std::vector<double>       &weights) const
+{
+    using def::I; using def::J; using def::K;
+
+    const Mesh &coarse_mesh = *coarsener.get_mesh();
+
+    int Nc  = fine_mesh.num_cells();
+    int Ncc = coarse_mesh.num_cells();
+
+    // number of local spatial unknowns (cells and boundary faces)
+    int N_local = VectorTraits<T>::local_size(fine_system.get_Map());
+    int Nu      = (N_local - fine_system.bnd_unknowns()) / Nc;
+    int Ns      = N_local / Nu;
+
+    spatial_map.assign(Ns, -1);
+    weights.assign(Ns, 0.0);
+
+    // volume cells
+    for (int cell = 0; cell < Nc; ++cell)
+    {
+        int cc = coarsener.coarse_cell(cell);
+        spatial_map[cell] = cc;
+        weights[cell]     = fine_mesh.volume(cell) / coarse_mesh.volume(cc);
+    }
+
+    // boundary faces (abscissa, ordinate) are (j,k) on x faces, (i,k) on y
+    // faces, and (i,j) on z faces
+    int ab[6] = {J, J, I, I, I, I};
+    int od[6] = {K, K, K, K, J, J};
+    for (int face = 0; face < 6; ++face)
+    {
+        typename Linear_System_FV<T>::RCP_Bnd_Indexer fine_bnd =
+            fine_system.bnd_indexer(face);
+        if (fine_bnd.is_null())
+            continue;
+
+        typename Linear_System_FV<T>::RCP_Bnd_Indexer coarse_bnd =
+            coarse_system.bnd_indexer(face);
+        CHECK(!coarse_bnd.is_null());
+
+        for (int o = 0; o < fine_mesh.num_cells_dim(od[face]); ++o)
+        {
+            for (int a = 0; a < fine_mesh.num_cells_dim(ab[face]); ++a)
+            {
+                int s = Nc + fine_bnd->local(a, o);
+                CHECK(s < Ns);
+
+                spatial_map[s] = Ncc + coarse_bnd->local(a / 2, o / 2);
+                weights[s]     =
+                    fine_mesh.width(a, ab[face]) *
+                    fine_mesh.width(o, od[face]) /
+                    (coarse_mesh.width(a / 2, ab[face]) *
+                     coarse_mesh.width(o / 2, od[face]));
+            }
+        }
+    }
+
+    ENSURE(std::find(spatial_map.begin(), spatial_map.end(), -1) ==
+           spatial_map.end());
 }
 
 } // end namespace profugus
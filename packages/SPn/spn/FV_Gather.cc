@@ -8,6 +8,8 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+
 #include "Dimensions.hh"
 #include "FV_Gather.hh"
 
@@ -25,6 +27,12 @@ FV_Gather::FV_Gather(RCP_Mesh                 mesh,
                      const Indexer_t         &indexer)
     : d_mesh(mesh)
     , d_coefficients(coefficients)
+    , d_incoming_I(Dimensions::max_num_equations())
+    , d_incoming_J(Dimensions::max_num_equations())
+    , d_first(0)
+    , d_last(0)
+    , d_pending(false)
+    , d_eqn(0)
     , d_Nb(indexer.num_blocks(def::I), indexer.num_blocks(def::J))
     , d_ij(mesh->block(def::I), mesh->block(def::J))
     , d_domain(profugus::node())
@@ -61,11 +69,11 @@ FV_Gather::FV_Gather(RCP_Mesh                 mesh,
     int last_I = d_Nb[I] - 1;
     int last_J = d_Nb[J] - 1;
 
-    // make face fields and define neighbor blocks
+    // make outgoing face fields and define neighbor blocks; the incoming
+    // fields are made when the equations are gathered
     if (d_ij[I] > first)
     {
         d_neighbor_I[LO] = convert(d_ij[I] - 1, d_ij[J]);
-        d_incoming_I[LO] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, X, Ng));
         d_outgoing_I[LO] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, X, Ng));
 
         CHECK(d_neighbor_I[LO] < d_domains);
@@ -74,7 +82,6 @@ FV_Gather::FV_Gather(RCP_Mesh                 mesh,
     if (d_ij[I] < last_I)
     {
         d_neighbor_I[HI] = convert(d_ij[I] + 1, d_ij[J]);
-        d_incoming_I[HI] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, X, Ng));
         d_outgoing_I[HI] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, X, Ng));
 
         CHECK(d_neighbor_I[HI] < d_domains);
@@ -83,7 +90,6 @@ FV_Gather::FV_Gather(RCP_Mesh                 mesh,
     if (d_ij[J] > first)
     {
         d_neighbor_J[LO] = convert(d_ij[I], d_ij[J] - 1);
-        d_incoming_J[LO] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, Y, Ng));
         d_outgoing_J[LO] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, Y, Ng));
 
         CHECK(d_neighbor_J[LO] < d_domains);
@@ -92,17 +98,16 @@ FV_Gather::FV_Gather(RCP_Mesh                 mesh,
     if (d_ij[J] < last_J)
     {
         d_neighbor_J[HI] = convert(d_ij[I], d_ij[J] + 1);
-        d_incoming_J[HI] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, Y, Ng));
         d_outgoing_J[HI] = Teuchos::rcp(new SDM_Face_Field(*d_mesh, Y, Ng));
 
         CHECK(d_neighbor_J[HI] < d_domains);
         CHECK(d_neighbor_J[HI] >= 0);
     }
 
-    ENSURE(d_domains == 1 ? d_incoming_I[LO].is_null() : true);
-    ENSURE(d_domains == 1 ? d_incoming_J[LO].is_null() : true);
-    ENSURE(d_domains == 1 ? d_incoming_I[HI].is_null() : true);
-    ENSURE(d_domains == 1 ? d_incoming_J[HI].is_null() : true);
+    ENSURE(d_domains == 1 ? d_outgoing_I[LO].is_null() : true);
+    ENSURE(d_domains == 1 ? d_outgoing_J[LO].is_null() : true);
+    ENSURE(d_domains == 1 ? d_outgoing_I[HI].is_null() : true);
+    ENSURE(d_domains == 1 ? d_outgoing_J[HI].is_null() : true);
     ENSURE(d_domains == 1 ? d_neighbor_I[LO] == PROBLEM_BOUNDARY : true);
     ENSURE(d_domains == 1 ? d_neighbor_J[LO] == PROBLEM_BOUNDARY : true);
     ENSURE(d_domains == 1 ? d_neighbor_I[HI] == PROBLEM_BOUNDARY : true);
@@ -119,69 +124,94 @@ FV_Gather::FV_Gather(RCP_Mesh                 mesh,
  */
 void FV_Gather::gather(int eqn)
 {
-    using def::I; using def::J; using def::PROBLEM_BOUNDARY;
-
     REQUIRE(eqn >= 0 && eqn < Dimensions::max_num_equations());
 
+    d_eqn = eqn;
+
     // return immediately if only running on 1 domain (although it works
     // without this, we use if for efficiency only)
     if (d_domains == 1) return;
 
-    // post receives
-    post_receives();
+    exchange(eqn, eqn + 1);
+    finish_gather();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Start gathering data for several equations on all blocks.
+ *
+ * The face data of all equations is sent to each neighbor in a single
+ * message.  The fields are not valid until finish_gather() is called.
+ *
+ * \param num_eqns gather equations [0, num_eqns)
+ */
+void FV_Gather::start_gather(int num_eqns)
+{
+    REQUIRE(num_eqns > 0 && num_eqns <= Dimensions::max_num_equations());
 
-    // fill low faces with local diffusion coefficients
-    fill_I_face(eqn, d_outgoing_I[LO], 0);
-    fill_J_face(eqn, d_outgoing_J[LO], 0);
-    fill_I_face(eqn, d_outgoing_I[HI], d_mesh->num_cells_dim(I) - 1);
-    fill_J_face(eqn, d_outgoing_J[HI], d_mesh->num_cells_dim(J) - 1);
+    if (d_domains == 1) return;
 
-    // send out data on low sides
-    if (!d_outgoing_I[LO].is_null())
-    {
-        CHECK(!d_incoming_I[LO].is_null());
-        CHECK(d_neighbor_I[LO] != PROBLEM_BOUNDARY);
-        profugus::send(
-            d_outgoing_I[LO]->data_pointer(), d_outgoing_I[LO]->data_size(),
-            d_neighbor_I[LO], 452);
-    }
-    if (!d_outgoing_J[LO].is_null())
-    {
-        CHECK(!d_incoming_J[LO].is_null());
-        CHECK(d_neighbor_J[LO] != PROBLEM_BOUNDARY);
-        profugus::send(
-            d_outgoing_J[LO]->data_pointer(), d_outgoing_J[LO]->data_size(),
-            d_neighbor_J[LO], 453);
-    }
+    exchange(0, num_eqns);
+}
 
-    // send out data on high sides
-    if (!d_outgoing_I[HI].is_null())
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Complete a gather.
+ */
+void FV_Gather::finish_gather()
+{
+    if (!d_pending) return;
+
+    // wait on the receives and unpack the fields of each equation
+    Face_Fields *incoming[2] = {&d_incoming_I[0], &d_incoming_J[0]};
+    Handles     *requests[2] = {&d_request_I, &d_request_J};
+    Buffers     *buffers[2]  = {&d_recv_I, &d_recv_J};
+    for (int d = 0; d < 2; ++d)
     {
-        CHECK(!d_incoming_I[HI].is_null());
-        CHECK(d_neighbor_I[HI] != PROBLEM_BOUNDARY);
-        profugus::send(
-            d_outgoing_I[HI]->data_pointer(), d_outgoing_I[HI]->data_size(),
-            d_neighbor_I[HI], 450);
+        for (int side = LO; side <= HI; ++side)
+        {
+            (*requests[d])[side].wait();
+
+            const def::Vec_Dbl &buffer = (*buffers[d])[side];
+            if (buffer.empty())
+                continue;
+
+            const double *data = &buffer[0];
+            for (int eqn = d_first; eqn < d_last; ++eqn)
+            {
+                RCP_Face_Field field = incoming[d][eqn][side];
+                CHECK(!field.is_null());
+                field->fast_copy(data, data + field->data_size());
+                data += field->data_size();
+            }
+            CHECK(data == &buffer[0] + buffer.size());
+        }
     }
-    if (!d_outgoing_J[HI].is_null())
+
+    // wait on the sends before releasing their buffers
+    d_send_request_I[LO].wait();
+    d_send_request_I[HI].wait();
+    d_send_request_J[LO].wait();
+    d_send_request_J[HI].wait();
+
+    for (int side = LO; side <= HI; ++side)
     {
-        CHECK(!d_incoming_J[HI].is_null());
-        CHECK(d_neighbor_J[HI] != PROBLEM_BOUNDARY);
-        profugus::send(
-            d_outgoing_J[HI]->data_pointer(), d_outgoing_J[HI]->data_size(),
-            d_neighbor_J[HI], 451);
+        def::Vec_Dbl().swap(d_recv_I[side]);
+        def::Vec_Dbl().swap(d_recv_J[side]);
+        def::Vec_Dbl().swap(d_send_I[side]);
+        def::Vec_Dbl().swap(d_send_J[side]);
     }
 
-    // wait on all of the posted receives
-    d_request_I[LO].wait();
-    d_request_I[HI].wait();
-    d_request_J[LO].wait();
-    d_request_J[HI].wait();
+    d_pending = false;
 
     ENSURE(!d_request_I[LO].inuse());
     ENSURE(!d_request_I[HI].inuse());
     ENSURE(!d_request_J[LO].inuse());
     ENSURE(!d_request_J[HI].inuse());
+    ENSURE(!d_send_request_I[LO].inuse());
+    ENSURE(!d_send_request_I[HI].inuse());
+    ENSURE(!d_send_request_J[LO].inuse());
+    ENSURE(!d_send_request_J[HI].inuse());
 }
 
 //---------------------------------------------------------------------------//
@@ -190,48 +220,125 @@ void FV_Gather::gather(int eqn)
  *
  * \param face I or J enumeration indicating face direction
  *
+ * \return face field of diffusion coefficients from the low-side neighbor
+ * for the equation of the last call to gather(); it could be unassigned if
+ * the face is adjacent to a problem boundary
+ */
+FV_Gather::RCP_Face_Field FV_Gather::low_side_D(int face) const
+{
+    return low_side_D(face, d_eqn);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get diffusion matrices from the high side neighbor.
+ *
+ * \param face I or J enumeration indicating face direction
+ *
+ * \return face field of diffusion coefficients from the high-side neighbor
+ * for the equation of the last call to gather(); it could be unassigned if
+ * the face is adjacent to a problem boundary
+ */
+FV_Gather::RCP_Face_Field FV_Gather::high_side_D(int face) const
+{
+    return high_side_D(face, d_eqn);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get diffusion matrices for an equation from the low side neighbor.
+ *
+ * \param face I or J enumeration indicating face direction
+ * \param eqn equation order of diffusion coefficients
+ *
  * \return face field of diffusion coefficients from the low-side neighbor; it
  * could be unassigned if the face is adjacent to a problem boundary
  */
-FV_Gather::RCP_Face_Field FV_Gather::low_side_D(int face) const
+FV_Gather::RCP_Face_Field FV_Gather::low_side_D(int face, int eqn) const
 {
     using def::I; using def::J; using def::K;
 
     REQUIRE(face < K);
+    REQUIRE(eqn >= 0 && eqn < d_incoming_I.size());
+    REQUIRE(!d_pending);
 
     // return the appropriate field
     if (face == I)
     {
-        return d_incoming_I[LO];
+        return d_incoming_I[eqn][LO];
     }
-    return d_incoming_J[LO];
+    return d_incoming_J[eqn][LO];
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Get diffusion matrices from the low side neighbor.
+ * \brief Get diffusion matrices for an equation from the high side neighbor.
  *
  * \param face I or J enumeration indicating face direction
+ * \param eqn equation order of diffusion coefficients
  *
- * \return face field of diffusion coefficients from the low-side neighbor; it
- * could be unassigned if the face is adjacent to a problem boundary
+ * \return face field of diffusion coefficients from the high-side neighbor;
+ * it could be unassigned if the face is adjacent to a problem boundary
  */
-FV_Gather::RCP_Face_Field FV_Gather::high_side_D(int face) const
+FV_Gather::RCP_Face_Field FV_Gather::high_side_D(int face, int eqn) const
 {
     using def::I; using def::J; using def::K;
 
     REQUIRE(face < K);
+    REQUIRE(eqn >= 0 && eqn < d_incoming_I.size());
+    REQUIRE(!d_pending);
 
     // return the appropriate field
     if (face == I)
     {
-        return d_incoming_I[HI];
+        return d_incoming_I[eqn][HI];
     }
-    return d_incoming_J[HI];
+    return d_incoming_J[eqn][HI];
 }
 
 //---------------------------------------------------------------------------//
 // PRIVATE IMPLEMENTATION
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Start the exchange of equations [first, last).
+ */
+void FV_Gather::exchange(int first, int last)
+{
+    using def::X; using def::Y;
+
+    REQUIRE(!d_pending);
+    REQUIRE(first >= 0 && first < last);
+    REQUIRE(last <= d_incoming_I.size());
+
+    d_first   = first;
+    d_last    = last;
+    d_pending = true;
+
+    // make the incoming fields of these equations
+    int Ng = d_coefficients->num_groups();
+    for (int eqn = first; eqn < last; ++eqn)
+    {
+        for (int side = LO; side <= HI; ++side)
+        {
+            if (!d_outgoing_I[side].is_null() &&
+                d_incoming_I[eqn][side].is_null())
+            {
+                d_incoming_I[eqn][side] = Teuchos::rcp(
+                    new SDM_Face_Field(*d_mesh, X, Ng));
+            }
+            if (!d_outgoing_J[side].is_null() &&
+                d_incoming_J[eqn][side].is_null())
+            {
+                d_incoming_J[eqn][side] = Teuchos::rcp(
+                    new SDM_Face_Field(*d_mesh, Y, Ng));
+            }
+        }
+    }
+
+    post_receives();
+    post_sends();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Post receives.
@@ -243,38 +350,104 @@ void FV_Gather::post_receives()
     REQUIRE(!d_request_J[LO].inuse());
     REQUIRE(!d_request_J[HI].inuse());
 
+    // number of equations in each message
+    int Ne = d_last - d_first;
+
     // post receives on this block
 
     // low sides
-    if (!d_incoming_I[LO].is_null())
+    if (!d_outgoing_I[LO].is_null())
     {
-        CHECK(!d_outgoing_I[LO].is_null());
+        d_recv_I[LO].resize(Ne * d_outgoing_I[LO]->data_size());
         profugus::receive_async(
-            d_request_I[LO], d_incoming_I[LO]->data_pointer(),
-            d_incoming_I[LO]->data_size(), d_neighbor_I[LO], 450);
+            d_request_I[LO], &d_recv_I[LO][0], d_recv_I[LO].size(),
+            d_neighbor_I[LO], 450);
     }
-    if (!d_incoming_J[LO].is_null())
+    if (!d_outgoing_J[LO].is_null())
     {
-        CHECK(!d_outgoing_J[LO].is_null());
+        d_recv_J[LO].resize(Ne * d_outgoing_J[LO]->data_size());
         profugus::receive_async(
-            d_request_J[LO], d_incoming_J[LO]->data_pointer(),
-            d_incoming_J[LO]->data_size(), d_neighbor_J[LO], 451);
+            d_request_J[LO], &d_recv_J[LO][0], d_recv_J[LO].size(),
+            d_neighbor_J[LO], 451);
     }
 
     // high sides
-    if (!d_incoming_I[HI].is_null())
+    if (!d_outgoing_I[HI].is_null())
     {
-        CHECK(!d_outgoing_I[HI].is_null());
+        d_recv_I[HI].resize(Ne * d_outgoing_I[HI]->data_size());
         profugus::receive_async(
-            d_request_I[HI], d_incoming_I[HI]->data_pointer(),
-            d_incoming_I[HI]->data_size(), d_neighbor_I[HI], 452);
+            d_request_I[HI], &d_recv_I[HI][0], d_recv_I[HI].size(),
+            d_neighbor_I[HI], 452);
     }
-    if (!d_incoming_J[HI].is_null())
+    if (!d_outgoing_J[HI].is_null())
     {
-        CHECK(!d_outgoing_J[HI].is_null());
+        d_recv_J[HI].resize(Ne * d_outgoing_J[HI]->data_size());
         profugus::receive_async(
-            d_request_J[HI], d_incoming_J[HI]->data_pointer(),
-            d_incoming_J[HI]->data_size(), d_neighbor_J[HI], 453);
+            d_request_J[HI], &d_recv_J[HI][0], d_recv_J[HI].size(),
+            d_neighbor_J[HI], 453);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pack the local diffusion coefficients and send them.
+ */
+void FV_Gather::post_sends()
+{
+    using def::I; using def::J; using def::PROBLEM_BOUNDARY;
+
+    REQUIRE(!d_send_request_I[LO].inuse());
+    REQUIRE(!d_send_request_I[HI].inuse());
+    REQUIRE(!d_send_request_J[LO].inuse());
+    REQUIRE(!d_send_request_J[HI].inuse());
+
+    // local face index on each side
+    int last[2] = {d_mesh->num_cells_dim(I) - 1, d_mesh->num_cells_dim(J) - 1};
+
+    // pack the face data of each equation (low sides send to the low
+    // neighbor's high-side receive and vice versa)
+    int tags[2][2] = {{452, 450}, {453, 451}};
+    for (int side = LO; side <= HI; ++side)
+    {
+        if (!d_outgoing_I[side].is_null())
+        {
+            CHECK(d_neighbor_I[side] != PROBLEM_BOUNDARY);
+
+            RCP_Face_Field field = d_outgoing_I[side];
+            def::Vec_Dbl  &buffer = d_send_I[side];
+            buffer.resize((d_last - d_first) * field->data_size());
+
+            double *data = &buffer[0];
+            for (int eqn = d_first; eqn < d_last; ++eqn)
+            {
+                fill_I_face(eqn, field, side == LO ? 0 : last[0]);
+                data = std::copy(field->begin_data(), field->end_data(), data);
+            }
+
+            profugus::send_async(
+                d_send_request_I[side], &buffer[0], buffer.size(),
+                d_neighbor_I[side], tags[0][side]);
+        }
+
+        if (!d_outgoing_J[side].is_null())
+        {
+            CHECK(d_neighbor_J[side] != PROBLEM_BOUNDARY);
+
+            RCP_Face_Field field = d_outgoing_J[side];
+            def::Vec_Dbl  &buffer = d_send_J[side];
+            buffer.resize((d_last - d_first) * field->data_size());
+
+            double *data = &buffer[0];
+            for (int eqn = d_first; eqn < d_last; ++eqn)
+            {
+                fill_J_face(eqn, field, side == LO ? 0 : last[1]);
+                data = std::copy(field->begin_data(), field->end_data(), data);
+            }
+
+            profugus::send_async(
+                d_send_request_J[side], &buffer[0], buffer.size(),
+                d_neighbor_J[side], tags[1][side]);
+        }
     }
 }
 
@@ -11,6 +11,8 @@
 #ifndef SPn_spn_FV_Gather_hh
 #define SPn_spn_FV_Gather_hh
 
+#include <vector>
+
 #include "Teuchos_RCP.hpp"
 
 #include "harness/DBC.hh"
@@ -27,6 +29,14 @@ namespace profugus
 /*!
  * \class FV_Gather
  * \brief Gather off-processor diffusion matrices.
+ *
+ * The diffusion matrices of the cells on each side of this block are
+ * exchanged with the neighboring blocks in (i,j).  gather() performs a
+ * blocking exchange for a single equation.  start_gather() exchanges the
+ * face data of all equations in one nonblocking message per neighbor so
+ * that work that does not need the neighbor data can overlap the exchange;
+ * finish_gather() completes it.  The received fields are accessed per
+ * equation with low_side_D() and high_side_D().
  */
 /*!
  * \example spn/test/tstFV_Gather.cc
@@ -60,11 +70,11 @@ class FV_Gather
     // Moment coefficient generator.
     RCP_Moment_Coefficients d_coefficients;
 
-    // Incoming face fields.
-    Face_Fields d_incoming_I;
-    Face_Fields d_incoming_J;
+    // Incoming face fields for each equation.
+    std::vector<Face_Fields> d_incoming_I;
+    std::vector<Face_Fields> d_incoming_J;
 
-    // Outgoing face fields.
+    // Outgoing face fields (work space for packing the messages).
     Face_Fields d_outgoing_I;
     Face_Fields d_outgoing_J;
 
@@ -76,17 +86,28 @@ class FV_Gather
     // Gather data for a given equation order.
     void gather(int eqn);
 
+    // Start a nonblocking gather of data for equations [0, num_eqns).
+    void start_gather(int num_eqns);
+
+    // Complete a nonblocking gather.
+    void finish_gather();
+
     // >>> ACCESSORS
 
-    // Get diffusion matrices on a given face.
+    // Get diffusion matrices on a given face for the last gather(eqn).
     RCP_Face_Field low_side_D(int face) const;
     RCP_Face_Field high_side_D(int face) const;
 
+    // Get diffusion matrices on a given face for an equation.
+    RCP_Face_Field low_side_D(int face, int eqn) const;
+    RCP_Face_Field high_side_D(int face, int eqn) const;
+
   private:
     // >>> IMPLEMENTATION
 
     typedef profugus::Vector_Lite<int, 2>               Tuple;
     typedef profugus::Vector_Lite<profugus::Request, 2> Handles;
+    typedef profugus::Vector_Lite<def::Vec_Dbl, 2>      Buffers;
     typedef Moment_Coefficients::Serial_Matrix          Serial_Matrix;
 
     // Neighbor blocks (domains).
@@ -96,6 +117,21 @@ class FV_Gather
     // Request handles.
     Handles d_request_I;
     Handles d_request_J;
+    Handles d_send_request_I;
+    Handles d_send_request_J;
+
+    // Message buffers holding the face data of all exchanged equations.
+    Buffers d_recv_I, d_recv_J;
+    Buffers d_send_I, d_send_J;
+
+    // Equations [first, last) in the current exchange.
+    int d_first, d_last;
+
+    // Whether an exchange is in progress.
+    bool d_pending;
+
+    // Equation of the last gather(eqn).
+    int d_eqn;
 
     // Number of block meshes in (i,j) directions.
     Tuple d_Nb;
@@ -115,9 +151,15 @@ class FV_Gather
         return i + j * d_Nb[def::I];
     }
 
+    // Start the exchange of equations [first, last).
+    void exchange(int first, int last);
+
     // Post receives.
     void post_receives();
 
+    // Pack the face data of equations [first, last) and send it.
+    void post_sends();
+
     // Fill i,j face fields.
     void fill_I_face(int eqn, RCP_Face_Field field, int i);
     void fill_J_face(int eqn, RCP_Face_Field field, int j);
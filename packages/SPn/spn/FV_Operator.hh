@@ -0,0 +1,197 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/FV_Operator.hh
+ * \author agent
+ * \date   Mon Oct 19 03:17:10 2026
+ * \brief  FV_Operator class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_FV_Operator_hh
+#define SPn_spn_FV_Operator_hh
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "utils/Definitions.hh"
+#include "utils/Vector_Lite.hh"
+#include "xs/Mat_DB.hh"
+#include "mesh/Mesh.hh"
+#include "mesh/LG_Indexer.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "FV_Bnd_Indexer.hh"
+#include "FV_Gather.hh"
+#include "Moment_Coefficients.hh"
+#include "OperatorAdapter.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class FV_Operator
+ * \brief Matrix-free SPN finite-volume operator.
+ *
+ * This operator applies the same SPN operator that Linear_System_FV
+ * assembles into a CRS matrix without storing the \f$N_g\times N_g\f$ blocks
+ * of each cell.  A row of the volume equations is applied as
+ * \f[
+   \mathbf{y}_{n} = \sum_m \mathbf{A}_{nm}\mathbf{x}_{m}
+   - \sum_{f}\frac{2}{\Delta_c}\mathbf{M}_{f,n}
+     (\mathbf{x}_{n}^{f} - \mathbf{x}_{n})\:,
+ * \f]
+ * where \f$\mathbf{A}_{nm}\f$ are the per-material blocks cached by
+ * Moment_Coefficients and
+ * \f$\mathbf{M}_{f,n} = \mathbf{D}_l(\Delta_l\mathbf{D}_l +
+ * \Delta_r\mathbf{D}_r)^{-1}\mathbf{D}_r\f$ is the coupling across face
+ * \f$f\f$.  The face couplings depend only on the materials and widths on
+ * either side of the face, so each distinct coupling is computed and stored
+ * once; faces only hold an index to their coupling block.  Couplings across
+ * domain boundaries use the diffusion matrices from FV_Gather and are stored
+ * per face.
+ *
+ * Off-processor values of \b x on the (I,J) domain faces are exchanged
+ * before each application.  Cells are applied in parallel with OpenMP and
+ * the innermost loops run over groups.
+ *
+ * The operator does not support transposes, so adjoint solves require the
+ * assembled matrix.
+ */
+//===========================================================================//
+
+template <class T>
+class FV_Operator : public OperatorAdapter<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                           MV;
+    typedef typename T::MAP                          MAP;
+    typedef Anasazi::MultiVecTraits<double,MV>       MVT;
+    typedef Moment_Coefficients::Serial_Matrix       Serial_Matrix;
+    typedef Teuchos::RCP<Moment_Coefficients>        RCP_Moment_Coefficients;
+    typedef Teuchos::RCP<Mat_DB>                     RCP_Mat_DB;
+    typedef Teuchos::RCP<Mesh>                       RCP_Mesh;
+    typedef Teuchos::RCP<LG_Indexer>                 RCP_Indexer;
+    typedef Teuchos::RCP<FV_Bnd_Indexer>             RCP_Bnd_Indexer;
+    typedef profugus::Vector_Lite<def::Vec_Dbl, 3>   Widths;
+    typedef def::Vec_Int                             Vec_Int;
+    typedef def::Vec_Dbl                             Vec_Dbl;
+    //@}
+
+  public:
+    // Constructor.
+    FV_Operator(Teuchos::RCP<const MAP>             map,
+                RCP_Moment_Coefficients             coefficients,
+                RCP_Mat_DB                          mat,
+                RCP_Mesh                            mesh,
+                RCP_Indexer                         indexer,
+                const Widths                       &widths,
+                const std::vector<RCP_Bnd_Indexer> &bnd_index,
+                FV_Gather                          &gather);
+
+    // >>> ACCESSORS
+
+    //! Number of distinct face-coupling blocks stored.
+    int num_blocks() const { return d_blocks.size() / (d_Ng * d_Ng); }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Types.
+    typedef profugus::Vector_Lite<int, 2>               Tuple;
+    typedef profugus::Vector_Lite<profugus::Request, 2> Handles;
+
+    //! Location of the data across a face.
+    enum Face_Type {NONE = 0, LOCAL, GHOST};
+
+    // Apply the operator.
+    void ApplyImpl(const MV &x, MV &y) const;
+
+    // Build the couplings on each face of each cell.
+    void build_faces(FV_Gather &gather, const Widths &widths,
+                     const std::vector<RCP_Bnd_Indexer> &bnd_index);
+
+    // Store a face-coupling block.
+    int add_block(const Serial_Matrix &M);
+
+    // Make the coupling across a face.
+    void face_coupling(const Serial_Matrix &Dl, const Serial_Matrix &Dr,
+                       double delta_l, double delta_r, Serial_Matrix &M) const;
+
+    // Set the neighbor domains and exchange buffers.
+    void set_neighbors();
+
+    // Exchange off-processor values of x.
+    void exchange(const double *x) const;
+
+    // y += a * M * x for a (Ng x Ng) column-major block.
+    inline void multiply(const double *M, int ld, double a, const double *x,
+                         double *y) const;
+
+    // Offset of a cell's (or boundary unknown's) data in the local vector.
+    int offset(int cell) const { return cell * d_Ne * d_Ng; }
+
+    // >>> DATA
+
+    // Moment coefficients.
+    RCP_Moment_Coefficients d_coefficients;
+
+    // Mesh and indexer.
+    RCP_Mesh    d_mesh;
+    RCP_Indexer d_indexer;
+
+    // Number of groups, equations, and local cells.
+    int d_Ng, d_Ne, d_Nc;
+
+    // Local mesh dimensions.
+    int d_N[3];
+
+    // Material id of each local cell.
+    Vec_Int d_matid;
+
+    // Face-coupling blocks (column-major, Ng x Ng each).
+    Vec_Dbl d_blocks;
+
+    // Face type, offset of the neighbor data, and coupling block for each
+    // equation on the 6 faces (-x,+x,-y,+y,-z,+z) of each cell.
+    std::vector<char> d_face_type;
+    Vec_Int           d_face_offset;
+    Vec_Int           d_face_block;
+
+    // Row scale (-2/width) of each cell in (i,j,k).
+    Vec_Dbl d_scale;
+
+    // Boundary equations: offset of the volume cell and the (scaled)
+    // diffusion block for each equation of each local boundary unknown.
+    Vec_Int d_bnd_cell;
+    Vec_Int d_bnd_block;
+
+    // B-matrix coefficients (each B block is a scalar times the identity).
+    Vec_Dbl d_b;
+
+    // Neighbor domains in (i,j).
+    Tuple d_neighbor_I, d_neighbor_J;
+
+    // Offsets of each (I-lo,I-hi,J-lo,J-hi) side in the exchange buffers.
+    int d_side_offset[5];
+
+    // Exchange buffers.
+    mutable Vec_Dbl d_send;
+    mutable Vec_Dbl d_ghost;
+
+    // Receive handles.
+    mutable Handles d_request_I, d_request_J;
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_FV_Operator_hh
+
+//---------------------------------------------------------------------------//
+//                 end of FV_Operator.hh
+//---------------------------------------------------------------------------//
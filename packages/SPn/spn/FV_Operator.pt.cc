@@ -0,0 +1,28 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/FV_Operator.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:17:10 2026
+ * \brief  FV_Operator explicit instantiation.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "FV_Operator.t.hh"
+#include "solvers/LinAlgTypedefs.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+namespace profugus
+{
+
+template class FV_Operator<EpetraTypes>;
+template class FV_Operator<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of FV_Operator.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,681 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/FV_Operator.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:17:10 2026
+ * \brief  FV_Operator template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_FV_Operator_t_hh
+#define SPn_spn_FV_Operator_t_hh
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+#include "Teuchos_LAPACK.hpp"
+
+#include "FV_Operator.hh"
+#include "VectorTraits.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * Construction is collective because the diffusion matrices on the domain
+ * faces are gathered from the neighboring domains.
+ *
+ * \param map map of the SPN vector space (volume and boundary unknowns)
+ * \param coefficients moment coefficients
+ * \param mat material database
+ * \param mesh local mesh block
+ * \param indexer local-to-global cell indexer
+ * \param widths global cell widths in (i,j,k)
+ * \param bnd_index boundary indexers for each face (-x,+x,-y,+y,-z,+z); null
+ * if there are no boundary unknowns on the face
+ * \param gather gather object for off-processor diffusion matrices
+ */
+template <class T>
+FV_Operator<T>::FV_Operator(
+    Teuchos::RCP<const MAP>             map,
+    RCP_Moment_Coefficients             coefficients,
+    RCP_Mat_DB                          mat,
+    RCP_Mesh                            mesh,
+    RCP_Indexer                         indexer,
+    const Widths                       &widths,
+    const std::vector<RCP_Bnd_Indexer> &bnd_index,
+    FV_Gather                          &gather)
+    : OperatorAdapter<T>(map)
+    , d_coefficients(coefficients)
+    , d_mesh(mesh)
+    , d_indexer(indexer)
+    , d_Ng(coefficients->num_groups())
+    , d_Ne(coefficients->num_equations())
+    , d_Nc(mesh->num_cells())
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(!coefficients.is_null());
+    REQUIRE(!mat.is_null());
+    REQUIRE(!mesh.is_null());
+    REQUIRE(!indexer.is_null());
+    REQUIRE(bnd_index.size() == 6);
+    REQUIRE(mat->num_cells() == d_Nc);
+
+    d_N[I] = mesh->num_cells_dim(I);
+    d_N[J] = mesh->num_cells_dim(J);
+    d_N[K] = mesh->num_cells_dim(K);
+    CHECK(d_N[I] * d_N[J] * d_N[K] == d_Nc);
+
+    // material ids in each cell
+    d_matid.resize(d_Nc);
+    for (int cell = 0; cell < d_Nc; ++cell)
+    {
+        d_matid[cell] = mat->matid(cell);
+    }
+
+    // B-matrix coefficients
+    Serial_Matrix B(d_Ng, d_Ng);
+    d_b.resize(d_Ne * d_Ne);
+    for (int n = 0; n < d_Ne; ++n)
+    {
+        for (int m = 0; m < d_Ne; ++m)
+        {
+            d_coefficients->make_B(n, m, B);
+            d_b[m + n * d_Ne] = B(0, 0);
+        }
+    }
+
+    // setup communication with neighboring domains
+    set_neighbors();
+
+    // build the face couplings and boundary equations
+    build_faces(gather, widths, bnd_index);
+
+    ENSURE(VectorTraits<T>::local_size(map) ==
+           offset(d_Nc + d_bnd_cell.size()));
+    ENSURE(d_face_type.size() == 6 * d_Nc);
+}
+
+//---------------------------------------------------------------------------//
+// APPLY
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the operator, \f$\mathbf{y} = \mathbf{A}\mathbf{x}\f$.
+ */
+template <class T>
+void FV_Operator<T>::ApplyImpl(const MV &x,
+                                     MV &y) const
+{
+    int num_vectors = MVT::GetNumberVecs(x);
+    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+
+    // number of boundary unknowns (blocks)
+    const int Nb = d_bnd_cell.size();
+
+    for (int ivec = 0; ivec < num_vectors; ++ivec)
+    {
+        Teuchos::ArrayRCP<const double> x_data =
+            VectorTraits<T>::get_data(Teuchos::rcpFromRef(x), ivec);
+        Teuchos::ArrayRCP<double> y_data =
+            VectorTraits<T>::get_data_nonconst(Teuchos::rcpFromRef(y), ivec);
+        CHECK(x_data.size() == offset(d_Nc + Nb));
+        CHECK(y_data.size() == offset(d_Nc + Nb));
+
+        const double *xp = x_data.getRawPtr();
+        double       *yp = y_data.getRawPtr();
+
+        // get the off-processor data on the domain faces
+        exchange(xp);
+        const double *ghost = d_ghost.empty() ? nullptr : &d_ghost[0];
+
+#pragma omp parallel
+        {
+            // difference across a face
+            Vec_Dbl diff(d_Ng);
+
+            // >>> VOLUME EQUATIONS
+#pragma omp for schedule(static)
+            for (int cell = 0; cell < d_Nc; ++cell)
+            {
+                const double *xc = xp + offset(cell);
+                double       *yc = yp + offset(cell);
+                int matid        = d_matid[cell];
+
+                for (int n = 0; n < d_Ne; ++n)
+                {
+                    double *yn = yc + n * d_Ng;
+                    std::fill(yn, yn + d_Ng, 0.0);
+
+                    // within-cell coupling between moment equations
+                    for (int m = 0; m < d_Ne; ++m)
+                    {
+                        const Serial_Matrix &A =
+                            d_coefficients->A_block(n, m, matid);
+                        multiply(A.values(), A.stride(), 1.0, xc + m * d_Ng,
+                                 yn);
+                    }
+
+                    // coupling across faces
+                    for (int f = 0; f < 6; ++f)
+                    {
+                        int face = f + cell * 6;
+                        if (d_face_type[face] == NONE)
+                            continue;
+
+                        // neighbor data across the face
+                        const double *xf =
+                            (d_face_type[face] == GHOST ? ghost : xp) +
+                            d_face_offset[face] + n * d_Ng;
+
+                        for (int g = 0; g < d_Ng; ++g)
+                        {
+                            diff[g] = xf[g] - xc[g + n * d_Ng];
+                        }
+
+                        int block = d_face_block[n + face * d_Ne];
+                        multiply(&d_blocks[block * d_Ng * d_Ng], d_Ng,
+                                 d_scale[f / 2 + cell * 3], &diff[0], yn);
+                    }
+                }
+            }
+
+            // >>> BOUNDARY EQUATIONS
+#pragma omp for schedule(static)
+            for (int b = 0; b < Nb; ++b)
+            {
+                const double *xb = xp + offset(d_Nc + b);
+                const double *xc = xp + d_bnd_cell[b];
+                double       *yb = yp + offset(d_Nc + b);
+
+                for (int n = 0; n < d_Ne; ++n)
+                {
+                    double *yn = yb + n * d_Ng;
+                    std::fill(yn, yn + d_Ng, 0.0);
+
+                    // B-matrix coupling (diagonal blocks)
+                    for (int m = 0; m < d_Ne; ++m)
+                    {
+                        double c = d_b[m + n * d_Ne];
+                        for (int g = 0; g < d_Ng; ++g)
+                        {
+                            yn[g] += c * xb[g + m * d_Ng];
+                        }
+                    }
+
+                    // coupling to the volume cell
+                    for (int g = 0; g < d_Ng; ++g)
+                    {
+                        diff[g] = xc[g + n * d_Ng] - xb[g + n * d_Ng];
+                    }
+
+                    int block = d_bnd_block[n + b * d_Ne];
+                    multiply(&d_blocks[block * d_Ng * d_Ng], d_Ng, -2.0,
+                             &diff[0], yn);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the couplings on each face of each cell.
+ *
+ * Faces between two cells on this domain share a coupling block with every
+ * other face that has the same equation, materials, and widths.  Faces on a
+ * problem boundary with boundary unknowns store the block
+ * \f$\mathbf{D}_n/\Delta_c\f$, which couples both the volume and the
+ * boundary equations.
+ */
+template <class T>
+void FV_Operator<T>::build_faces(
+    FV_Gather                          &gather,
+    const Widths                       &widths,
+    const std::vector<RCP_Bnd_Indexer> &bnd_index)
+{
+    using def::I; using def::J; using def::K;
+
+    typedef FV_Gather::RCP_Face_Field                 RCP_Face_Field;
+    typedef std::tuple<int, int, int, double, double> Face_Key;
+    typedef std::tuple<int, int, double>              Bnd_Key;
+
+    const LG_Indexer &indexer = *d_indexer;
+
+    // global offsets and global number of cells in each direction
+    int off[3] = {indexer.offset(I), indexer.offset(J), 0};
+    int G[3]   = {static_cast<int>(widths[I].size()),
+                  static_cast<int>(widths[J].size()),
+                  static_cast<int>(widths[K].size())};
+
+    // number of local boundary unknowns
+    int Nb = 0;
+    for (int f = 0; f < 6; ++f)
+    {
+        if (!bnd_index[f].is_null())
+            Nb += bnd_index[f]->num_local();
+    }
+
+    d_face_type.assign(6 * d_Nc, NONE);
+    d_face_offset.assign(6 * d_Nc, 0);
+    d_face_block.assign(6 * d_Nc * d_Ne, -1);
+    d_scale.resize(3 * d_Nc);
+    d_bnd_cell.assign(Nb, -1);
+    d_bnd_block.assign(Nb * d_Ne, -1);
+
+    // distinct face-coupling blocks
+    std::map<Face_Key, int> face_blocks;
+    std::map<Bnd_Key, int>  bnd_blocks;
+
+    // work matrix
+    Serial_Matrix M(d_Ng, d_Ng);
+
+    // gather the diffusion matrices of all equations on the domain faces
+    gather.start_gather(d_Ne);
+    gather.finish_gather();
+
+    for (int eqn = 0; eqn < d_Ne; ++eqn)
+    {
+        // the fields are null if there is no neighbor domain
+        RCP_Face_Field fields[4] = {gather.low_side_D(I, eqn),
+                                    gather.high_side_D(I, eqn),
+                                    gather.low_side_D(J, eqn),
+                                    gather.high_side_D(J, eqn)};
+
+        for (int cell = 0; cell < d_Nc; ++cell)
+        {
+            int l[3];
+            indexer.l2l(cell, l[I], l[J], l[K]);
+            int g[3] = {l[I] + off[I], l[J] + off[J], l[K]};
+
+            int matid = d_matid[cell];
+
+            // row scale in each direction
+            if (eqn == 0)
+            {
+                for (int d = 0; d < 3; ++d)
+                {
+                    d_scale[d + cell * 3] = -2.0 / widths[d][g[d]];
+                }
+            }
+
+            for (int f = 0; f < 6; ++f)
+            {
+                // direction and side of the face
+                int d    = f / 2;
+                int side = f % 2 ? 1 : -1;
+                int face = f + cell * 6;
+
+                // abscissa and ordinate of the face
+                int a = d == I ? l[J] : l[I];
+                int o = d == K ? l[J] : l[K];
+
+                // global index of the neighbor across the face
+                int gn = g[d] + side;
+
+                // >>> PROBLEM BOUNDARY
+                if (gn < 0 || gn >= G[d])
+                {
+                    // reflecting faces have no boundary unknowns
+                    if (bnd_index[f].is_null())
+                        continue;
+
+                    double delta = widths[d][g[d]];
+                    int    b     = bnd_index[f]->local(a, o);
+                    CHECK(b >= 0 && b < Nb);
+
+                    Bnd_Key key(eqn, matid, delta);
+                    auto itr = bnd_blocks.find(key);
+                    if (itr == bnd_blocks.end())
+                    {
+                        M.assign(d_coefficients->D_block(eqn, matid));
+                        M *= 1.0 / delta;
+                        itr = bnd_blocks.insert(
+                            std::make_pair(key, add_block(M))).first;
+                    }
+
+                    d_face_type[face]               = LOCAL;
+                    d_face_offset[face]             = offset(d_Nc + b);
+                    d_face_block[eqn + face * d_Ne] = itr->second;
+
+                    d_bnd_cell[b]               = offset(cell);
+                    d_bnd_block[eqn + b * d_Ne] = itr->second;
+                    continue;
+                }
+
+                // low and high widths
+                double delta_l = widths[d][side < 0 ? gn : g[d]];
+                double delta_r = widths[d][side < 0 ? g[d] : gn];
+
+                // own diffusion matrix
+                const Serial_Matrix &Dc = d_coefficients->D_block(eqn, matid);
+
+                // >>> NEIGHBOR ON THIS DOMAIN
+                int ln = l[d] + side;
+                if (ln >= 0 && ln < d_N[d])
+                {
+                    int nl[3] = {l[I], l[J], l[K]};
+                    nl[d]     = ln;
+                    int ncell = indexer.l2l(nl[I], nl[J], nl[K]);
+                    int nmat  = d_matid[ncell];
+
+                    Face_Key key(eqn, side < 0 ? nmat : matid,
+                                 side < 0 ? matid : nmat, delta_l, delta_r);
+                    auto itr = face_blocks.find(key);
+                    if (itr == face_blocks.end())
+                    {
+                        const Serial_Matrix &Dn =
+                            d_coefficients->D_block(eqn, nmat);
+                        if (side < 0)
+                            face_coupling(Dn, Dc, delta_l, delta_r, M);
+                        else
+                            face_coupling(Dc, Dn, delta_l, delta_r, M);
+                        itr = face_blocks.insert(
+                            std::make_pair(key, add_block(M))).first;
+                    }
+
+                    d_face_type[face]               = LOCAL;
+                    d_face_offset[face]             = offset(ncell);
+                    d_face_block[eqn + face * d_Ne] = itr->second;
+                }
+
+                // >>> NEIGHBOR ON ANOTHER DOMAIN
+                else
+                {
+                    CHECK(d < K);
+                    CHECK(!fields[f].is_null());
+
+                    // this is a *View* into the field data
+                    Serial_Matrix Dn = fields[f]->view(a, o);
+
+                    if (side < 0)
+                        face_coupling(Dn, Dc, delta_l, delta_r, M);
+                    else
+                        face_coupling(Dc, Dn, delta_l, delta_r, M);
+
+                    // number of cells along the abscissa of the face
+                    int Na = d == I ? d_N[J] : d_N[I];
+
+                    d_face_type[face]   = GHOST;
+                    d_face_offset[face] =
+                        d_side_offset[f] + offset(a + o * Na);
+                    d_face_block[eqn + face * d_Ne] = add_block(M);
+                }
+            }
+        }
+    }
+
+    ENSURE(std::find(d_bnd_cell.begin(), d_bnd_cell.end(), -1) ==
+           d_bnd_cell.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Store a face-coupling block.
+ *
+ * \return index of the block
+ */
+template <class T>
+int FV_Operator<T>::add_block(const Serial_Matrix &M)
+{
+    REQUIRE(M.numRows() == d_Ng);
+    REQUIRE(M.numCols() == d_Ng);
+
+    int block = d_blocks.size() / (d_Ng * d_Ng);
+    for (int gp = 0; gp < d_Ng; ++gp)
+    {
+        for (int g = 0; g < d_Ng; ++g)
+        {
+            d_blocks.push_back(M(g, gp));
+        }
+    }
+    return block;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Make the coupling across a face.
+ *
+ * \f[
+   \mathbf{M} = \mathbf{D}_l(\Delta_l\mathbf{D}_l +
+                \Delta_r\mathbf{D}_r)^{-1}\mathbf{D}_r
+ * \f]
+ */
+template <class T>
+void FV_Operator<T>::face_coupling(const Serial_Matrix &Dl,
+                                   const Serial_Matrix &Dr,
+                                   double               delta_l,
+                                   double               delta_r,
+                                   Serial_Matrix       &M) const
+{
+    REQUIRE(delta_l > 0.0);
+    REQUIRE(delta_r > 0.0);
+
+    Teuchos::LAPACK<int, double> lapack;
+    Vec_Int ipiv(d_Ng);
+    int     info = 0;
+
+    // make the sum term (delta_l * Dl + delta_r * Dr)
+    Serial_Matrix W(Dl);
+    W *= delta_l;
+    Serial_Matrix R(Dr);
+    R *= delta_r;
+    W += R;
+
+    // solve W * R = Dr
+    R.assign(Dr);
+    lapack.GETRF(d_Ng, d_Ng, W.values(), W.stride(), &ipiv[0], &info);
+    CHECK(info == 0);
+    lapack.GETRS('N', d_Ng, d_Ng, W.values(), W.stride(), &ipiv[0],
+                 R.values(), R.stride(), &info);
+    CHECK(info == 0);
+
+    // M = Dl * R
+    M.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, Dl, R, 0.0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the neighbor domains and size the exchange buffers.
+ */
+template <class T>
+void FV_Operator<T>::set_neighbors()
+{
+    using def::I; using def::J; using def::K;
+    using def::PROBLEM_BOUNDARY;
+
+    const int LO = FV_Gather::LO, HI = FV_Gather::HI;
+
+    // number of blocks and the (i,j) index of this block
+    int Nb_I = d_indexer->num_blocks(I);
+    int Nb_J = d_indexer->num_blocks(J);
+    int b_i  = d_mesh->block(I);
+    int b_j  = d_mesh->block(J);
+
+    d_neighbor_I[LO] = PROBLEM_BOUNDARY;
+    d_neighbor_I[HI] = PROBLEM_BOUNDARY;
+    d_neighbor_J[LO] = PROBLEM_BOUNDARY;
+    d_neighbor_J[HI] = PROBLEM_BOUNDARY;
+
+    if (b_i > 0)
+        d_neighbor_I[LO] = (b_i - 1) + b_j * Nb_I;
+    if (b_i < Nb_I - 1)
+        d_neighbor_I[HI] = (b_i + 1) + b_j * Nb_I;
+    if (b_j > 0)
+        d_neighbor_J[LO] = b_i + (b_j - 1) * Nb_I;
+    if (b_j < Nb_J - 1)
+        d_neighbor_J[HI] = b_i + (b_j + 1) * Nb_I;
+
+    // sizes of each side (-x,+x,-y,+y) in the exchange buffers
+    int size[4] = {
+        d_neighbor_I[LO] != PROBLEM_BOUNDARY ? offset(d_N[J] * d_N[K]) : 0,
+        d_neighbor_I[HI] != PROBLEM_BOUNDARY ? offset(d_N[J] * d_N[K]) : 0,
+        d_neighbor_J[LO] != PROBLEM_BOUNDARY ? offset(d_N[I] * d_N[K]) : 0,
+        d_neighbor_J[HI] != PROBLEM_BOUNDARY ? offset(d_N[I] * d_N[K]) : 0};
+
+    d_side_offset[0] = 0;
+    for (int s = 0; s < 4; ++s)
+    {
+        d_side_offset[s + 1] = d_side_offset[s] + size[s];
+    }
+
+    d_send.resize(d_side_offset[4]);
+    d_ghost.resize(d_side_offset[4]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Exchange the values of x on the (I,J) domain faces.
+ *
+ * The values of each neighbor's cells adjacent to this domain are written
+ * into the ghost buffer.
+ */
+template <class T>
+void FV_Operator<T>::exchange(const double *x) const
+{
+    using def::I; using def::J; using def::K;
+    using def::PROBLEM_BOUNDARY;
+
+    const int LO = FV_Gather::LO, HI = FV_Gather::HI;
+
+    // return immediately if there are no neighbors
+    if (d_ghost.empty()) return;
+
+    // number of unknowns in a cell
+    const int Nu = d_Ne * d_Ng;
+
+    // post receives
+    if (d_neighbor_I[LO] != PROBLEM_BOUNDARY)
+    {
+        profugus::receive_async(
+            d_request_I[LO], &d_ghost[d_side_offset[0]],
+            d_side_offset[1] - d_side_offset[0], d_neighbor_I[LO], 460);
+    }
+    if (d_neighbor_I[HI] != PROBLEM_BOUNDARY)
+    {
+        profugus::receive_async(
+            d_request_I[HI], &d_ghost[d_side_offset[1]],
+            d_side_offset[2] - d_side_offset[1], d_neighbor_I[HI], 462);
+    }
+    if (d_neighbor_J[LO] != PROBLEM_BOUNDARY)
+    {
+        profugus::receive_async(
+            d_request_J[LO], &d_ghost[d_side_offset[2]],
+            d_side_offset[3] - d_side_offset[2], d_neighbor_J[LO], 461);
+    }
+    if (d_neighbor_J[HI] != PROBLEM_BOUNDARY)
+    {
+        profugus::receive_async(
+            d_request_J[HI], &d_ghost[d_side_offset[3]],
+            d_side_offset[4] - d_side_offset[3], d_neighbor_J[HI], 463);
+    }
+
+    // pack the cells on each side
+    for (int k = 0; k < d_N[K]; ++k)
+    {
+        for (int j = 0; j < d_N[J]; ++j)
+        {
+            int a = offset(j + k * d_N[J]);
+            if (d_neighbor_I[LO] != PROBLEM_BOUNDARY)
+            {
+                const double *xc = x + offset(d_indexer->l2l(0, j, k));
+                std::copy(xc, xc + Nu, &d_send[d_side_offset[0] + a]);
+            }
+            if (d_neighbor_I[HI] != PROBLEM_BOUNDARY)
+            {
+                const double *xc =
+                    x + offset(d_indexer->l2l(d_N[I] - 1, j, k));
+                std::copy(xc, xc + Nu, &d_send[d_side_offset[1] + a]);
+            }
+        }
+        for (int i = 0; i < d_N[I]; ++i)
+        {
+            int a = offset(i + k * d_N[I]);
+            if (d_neighbor_J[LO] != PROBLEM_BOUNDARY)
+            {
+                const double *xc = x + offset(d_indexer->l2l(i, 0, k));
+                std::copy(xc, xc + Nu, &d_send[d_side_offset[2] + a]);
+            }
+            if (d_neighbor_J[HI] != PROBLEM_BOUNDARY)
+            {
+                const double *xc =
+                    x + offset(d_indexer->l2l(i, d_N[J] - 1, k));
+                std::copy(xc, xc + Nu, &d_send[d_side_offset[3] + a]);
+            }
+        }
+    }
+
+    // send to the neighbors
+    if (d_neighbor_I[LO] != PROBLEM_BOUNDARY)
+    {
+        profugus::send(&d_send[d_side_offset[0]],
+                       d_side_offset[1] - d_side_offset[0],
+                       d_neighbor_I[LO], 462);
+    }
+    if (d_neighbor_I[HI] != PROBLEM_BOUNDARY)
+    {
+        profugus::send(&d_send[d_side_offset[1]],
+                       d_side_offset[2] - d_side_offset[1],
+                       d_neighbor_I[HI], 460);
+    }
+    if (d_neighbor_J[LO] != PROBLEM_BOUNDARY)
+    {
+        profugus::send(&d_send[d_side_offset[2]],
+                       d_side_offset[3] - d_side_offset[2],
+                       d_neighbor_J[LO], 463);
+    }
+    if (d_neighbor_J[HI] != PROBLEM_BOUNDARY)
+    {
+        profugus::send(&d_send[d_side_offset[3]],
+                       d_side_offset[4] - d_side_offset[3],
+                       d_neighbor_J[HI], 461);
+    }
+
+    // wait on all of the posted receives
+    d_request_I[LO].wait();
+    d_request_I[HI].wait();
+    d_request_J[LO].wait();
+    d_request_J[HI].wait();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add a scaled block-vector product, \f$y \leftarrow y + aMx\f$.
+ *
+ * The inner loop runs down the columns of \b M (over groups) so that it
+ * vectorizes.
+ */
+template <class T>
+void FV_Operator<T>::multiply(const double *M,
+                              int           ld,
+                              double        a,
+                              const double *x,
+                              double       *y) const
+{
+    for (int gp = 0; gp < d_Ng; ++gp)
+    {
+        const double *col = M + gp * ld;
+        double        ax  = a * x[gp];
+        for (int g = 0; g < d_Ng; ++g)
+        {
+            y[g] += col[g] * ax;
+        }
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_FV_Operator_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of FV_Operator.t.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,210 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/ImportTraits.hh
+ * \author agent
+ * \date   Mon Oct 19 03:25:24 2026
+ * \brief  ImportTraits class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_ImportTraits_hh
+#define SPn_spn_ImportTraits_hh
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ArrayView.hpp"
+#include "Teuchos_OrdinalTraits.hpp"
+
+#include "Epetra_Import.h"
+#include "Tpetra_Import.hpp"
+
+#include "harness/DBC.hh"
+#include "solvers/LinAlgTypedefs.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class ImportTraits
+ * \brief Traits class for Epetra/Tpetra maps and off-processor imports.
+ *
+ * These are used by operators that store their own (column-map) copies of
+ * off-processor vector data.
+ */
+//===========================================================================//
+
+template <class T>
+class UndefinedImportTraits
+{
+    void NotDefined(){T::this_class_is_missing_a_specialization();}
+};
+
+template <class T>
+class ImportTraits
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MAP Map_t;
+    typedef typename T::MV  MV;
+    typedef void            Import_t;
+    //@}
+
+    static int local_index(const Map_t &map, int global)
+    {
+        UndefinedImportTraits<T>::NotDefined();
+        return -1;
+    }
+
+    static int global_index(const Map_t &map, int local)
+    {
+        UndefinedImportTraits<T>::NotDefined();
+        return -1;
+    }
+
+    static Teuchos::RCP<Map_t> build_map(const Map_t            &map,
+                                         const std::vector<int> &globals)
+    {
+        UndefinedImportTraits<T>::NotDefined();
+        return Teuchos::null;
+    }
+
+    static Teuchos::RCP<Import_t> build_import(
+        Teuchos::RCP<const Map_t> source, Teuchos::RCP<const Map_t> target)
+    {
+        UndefinedImportTraits<T>::NotDefined();
+        return Teuchos::null;
+    }
+
+    static void do_import(const Import_t &import, const MV &source,
+                          MV &target)
+    {
+        UndefinedImportTraits<T>::NotDefined();
+    }
+
+    static void do_export(const Import_t &import, const MV &target,
+                          MV &source)
+    {
+        UndefinedImportTraits<T>::NotDefined();
+    }
+};
+
+// Specialization on EpetraTypes
+template <>
+class ImportTraits<EpetraTypes>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename EpetraTypes::MAP Map_t;
+    typedef typename EpetraTypes::MV  MV;
+    typedef Epetra_Import             Import_t;
+    //@}
+
+    static int local_index(const Map_t &map, int global)
+    {
+        return map.LID(global);
+    }
+
+    static int global_index(const Map_t &map, int local)
+    {
+        return map.GID(local);
+    }
+
+    // Map (on the same communicator as map) holding the global indices.
+    static Teuchos::RCP<Map_t> build_map(const Map_t            &map,
+                                         const std::vector<int> &globals)
+    {
+        int num_local = globals.size();
+        return Teuchos::rcp(
+            new Map_t(-1, num_local,
+                      num_local ? &globals[0] : static_cast<int *>(0), 0,
+                      map.Comm()));
+    }
+
+    static Teuchos::RCP<Import_t> build_import(
+        Teuchos::RCP<const Map_t> source, Teuchos::RCP<const Map_t> target)
+    {
+        return Teuchos::rcp(new Import_t(*target, *source));
+    }
+
+    static void do_import(const Import_t &import, const MV &source,
+                          MV &target)
+    {
+        int err = target.Import(source, import, Insert);
+        CHECK(err == 0);
+    }
+
+    // Sum target entries into their source entries (reverse of do_import).
+    static void do_export(const Import_t &import, const MV &target,
+                          MV &source)
+    {
+        int err = source.Export(target, import, Add);
+        CHECK(err == 0);
+    }
+};
+
+// Specialization on TpetraTypes
+template <>
+class ImportTraits<TpetraTypes>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename TpetraTypes::MAP Map_t;
+    typedef typename TpetraTypes::MV  MV;
+    typedef Tpetra::Import<TpetraTypes::LO, TpetraTypes::GO,
+                           TpetraTypes::NODE> Import_t;
+    //@}
+
+    static int local_index(const Map_t &map, int global)
+    {
+        int local = map.getLocalElement(global);
+        return local == Teuchos::OrdinalTraits<int>::invalid() ? -1 : local;
+    }
+
+    static int global_index(const Map_t &map, int local)
+    {
+        return map.getGlobalElement(local);
+    }
+
+    // Map (on the same communicator as map) holding the global indices.
+    static Teuchos::RCP<Map_t> build_map(const Map_t            &map,
+                                         const std::vector<int> &globals)
+    {
+        return Teuchos::rcp(
+            new Map_t(Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid(),
+                      Teuchos::ArrayView<const int>(globals), 0,
+                      map.getComm()));
+    }
+
+    static Teuchos::RCP<Import_t> build_import(
+        Teuchos::RCP<const Map_t> source, Teuchos::RCP<const Map_t> target)
+    {
+        return Teuchos::rcp(new Import_t(source, target));
+    }
+
+    static void do_import(const Import_t &import, const MV &source,
+                          MV &target)
+    {
+        target.doImport(source, import, Tpetra::INSERT);
+    }
+
+    // Sum target entries into their source entries (reverse of do_import).
+    static void do_export(const Import_t &import, const MV &target,
+                          MV &source)
+    {
+        source.doExport(target, import, Tpetra::ADD);
+    }
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_ImportTraits_hh
+
+//---------------------------------------------------------------------------//
+//                 end of ImportTraits.hh
+//---------------------------------------------------------------------------//
@@ -129,6 +129,9 @@ class Linear_System
     //! Build the right-hand-side from an external, isotropic source.
     virtual void build_RHS(const External_Source &q) = 0;
 
+    //! Add the time-source from the previous timestep solution to the RHS.
+    virtual void add_time_source(Teuchos::RCP<const MV> u) = 0;
+
     //! Build the right-hand-side fission matrix.
     virtual void build_fission_matrix() = 0;
 
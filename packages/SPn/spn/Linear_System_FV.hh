@@ -18,6 +18,7 @@
 #include "utils/Definitions.hh"
 #include "FV_Bnd_Indexer.hh"
 #include "FV_Gather.hh"
+#include "BSR_Matrix.hh"
 #include "Linear_System.hh"
 
 // Additional Trilinos pieces
@@ -32,6 +33,29 @@ namespace profugus
  * \class Linear_System_FV
  * \brief Build a linear SPN system based on a Cartesian Finite-Volume
  * discretization.
+ *
+ * The matrices are assembled with OpenMP threads.  The (GXG) block rows of
+ * each cell are computed in parallel over chunks of cells and are then
+ * inserted, one full row at a time, into a matrix with a static (fixed)
+ * profile that is sized from the stencil.  The rows of a chunk are staged
+ * as dense (GXG) blocks, up to \f$N_e+6\f$ per cell and equation, so the
+ * number of cells in a chunk is derived from the number of groups and
+ * equations such that the staged blocks use at most "assembly_staging_mb"
+ * megabytes (optional, default 256); the optional "assembly_chunk_size"
+ * parameter (default 4096) caps the number of cells in a chunk.
+ *
+ * If the optional "matrix_free" parameter is true (default false), the LHS
+ * operator is an FV_Operator that applies the stencil without assembling
+ * it; in this case get_Matrix() returns null, so preconditioners that need
+ * the matrix cannot be used.  The fission matrix is always assembled.
+ *
+ * The optional "matrix_storage" parameter selects the storage of the LHS
+ * matrix: "crs" (default) assembles a point CRS matrix, and "bsr" assembles
+ * a BSR_Matrix whose dense blocks are the (GXG) group-coupling blocks, which
+ * stores one column index per block instead of one per entry.  With "bsr"
+ * storage get_Matrix() returns null and get_block_Matrix() returns the
+ * matrix; the block rows are inserted concurrently by the threads that build
+ * them.
  */
 /*!
  * \example spn/test/tstLinear_System_FV.cc
@@ -67,10 +91,12 @@ class Linear_System_FV : public Linear_System<T>
     using typename Base::RCP_Global_Data;
     using typename Base::Array_Int;
     using typename Base::Array_Dbl;
+    using typename Base::MV;
 
     using Base::b_db;
     using Base::b_dim;
     using Base::b_mat;
+    using Base::b_dt;
     using Base::b_mom_coeff;
     using Base::b_map;
     using Base::b_operator;
@@ -94,6 +120,9 @@ class Linear_System_FV : public Linear_System<T>
     Teuchos::RCP<Matrix_t> d_matrix;
     Teuchos::RCP<Matrix_t> d_fission;
 
+    // Element SPN matrix in block (BSR) storage.
+    Teuchos::RCP<BSR_Matrix<T> > d_block_matrix;
+
   public:
     // Constructor.
     Linear_System_FV(RCP_ParameterList db, RCP_Dimensions dim, RCP_Mat_DB mat,
@@ -109,6 +138,9 @@ class Linear_System_FV : public Linear_System<T>
     // Build the right-hand-side from an external, isotropic source.
     void build_RHS(const External_Source &q);
 
+    // Add the time-source from the previous timestep solution to the RHS.
+    void add_time_source(Teuchos::RCP<const MV> u);
+
     // Local/Global index in vector space corresponding to (group, eqn, cell).
     inline int index(int g, int eqn, int spatial_unknown) const;
 
@@ -117,6 +149,12 @@ class Linear_System_FV : public Linear_System<T>
     //! Get an RCP to the LHS matrix (may not be full matrix)
     Teuchos::RCP<Matrix_t> get_Matrix() const { return d_matrix; }
 
+    //! Get an RCP to the LHS matrix in block storage (null unless "bsr").
+    Teuchos::RCP<BSR_Matrix<T> > get_block_Matrix() const
+    {
+        return d_block_matrix;
+    }
+
     // Get the boundary indexer for a face.
     inline RCP_Bnd_Indexer bnd_indexer(int face) const;
 
@@ -144,29 +182,94 @@ class Linear_System_FV : public Linear_System<T>
     void map_bnd_l2g(RCP_Bnd_Indexer indexer, int N_abscissa, int N_ordinate,
                      Vec_Int &l2g);
 
+    // Work matrices and LAPACK workspace used to assemble a block row (each
+    // thread has its own).
+    struct Assembly_Work
+    {
+        explicit Assembly_Work(int Ng)
+            : D_c(Ng, Ng), C_c(Ng, Ng), D(Ng, Ng), C(Ng, Ng), W(Ng, Ng)
+            , work(Ng), ipiv(Ng), info(0)
+        {
+        }
+
+        Serial_Matrix D_c; // diffusion matrix in local cell for moment n
+        Serial_Matrix C_c; // local cell matrix coefficient
+        Serial_Matrix D;   // diffusion matrix in a neighbor cell for moment n
+        Serial_Matrix C;   // matrix coefficient from neighbor cell
+        Serial_Matrix W;   // work matrix
+
+        Teuchos::LAPACK<int, double> lapack;
+        def::Vec_Dbl                 work;
+        def::Vec_Int                 ipiv;
+        int                          info;
+    };
+
+    // The (GXG) blocks of a block row staged for insertion into a matrix.
+    struct Block_Rows
+    {
+        // Clear the block row (keeping its storage).
+        void reset()
+        {
+            row = -1;
+            cols.clear();
+            blocks.clear();
+        }
+
+        int     row;    // global block row
+        Vec_Int cols;   // global block column of each block
+        Vec_Dbl blocks; // blocks (column-major)
+
+        // work space for inserting the block row into a point matrix
+        Vec_Int indices;
+        Vec_Dbl values;
+    };
+
+    // Build the block row for an equation in a volume cell.
+    void build_volume_rows(int eqn, int i, int j, int k, int i_off, int j_off,
+                           const RCP_Face_Field &Dx_low,
+                           const RCP_Face_Field &Dx_high,
+                           const RCP_Face_Field &Dy_low,
+                           const RCP_Face_Field &Dy_high,
+                           Assembly_Work &w, Block_Rows &rows) const;
+
     // Insert spatially coupled elements.
     void spatial_coupled_element(int n, int i, int j, int k, int g_i, int g_j,
-                                 RCP_Face_Field Dx_low, RCP_Face_Field Dx_high,
-                                 RCP_Face_Field Dy_low, RCP_Face_Field Dy_high);
+                                 const RCP_Face_Field &Dx_low,
+                                 const RCP_Face_Field &Dx_high,
+                                 const RCP_Face_Field &Dy_low,
+                                 const RCP_Face_Field &Dy_high,
+                                 Assembly_Work &w, Block_Rows &rows) const;
 
     // Add spatial element to the matrix.
     void add_spatial_element(int eqn, int row_cell, int col_cell,
                              double delta_l, double delta_r, double delta_c,
-                             const Serial_Matrix &Dl, const Serial_Matrix &Dr);
+                             const Serial_Matrix &Dl, const Serial_Matrix &Dr,
+                             Assembly_Work &w, Block_Rows &rows) const;
 
     // Add boundary element to matrix.
     void build_bnd_element(int eqn, int global_row, int global_col,
-                           double delta_c);
+                           double delta_c, Assembly_Work &w,
+                           Block_Rows &rows) const;
 
     // Add boundary equations to the matrix.
     void add_boundary_equations(int face, int global_cell, int local_cell,
-                                double delta_c);
+                                double delta_c, Assembly_Work &w,
+                                Block_Rows &rows);
 
-    // Insert a block matrix (GXG) into the matrix.
+    // Stage a block matrix (GXG) for insertion into a block row.
     void insert_block_matrix(int row_n, int row_cell, int row_off,
                              int col_m, int col_cell, int col_off,
-                             const Serial_Matrix &M,
-                             Teuchos::RCP<Matrix_t> matrix);
+                             const Serial_Matrix &M, Block_Rows &rows) const;
+
+    // Number of cells in an assembly chunk.
+    int chunk_cells(int blocks_per_cell) const;
+
+    // Insert the staged rows into a point matrix.
+    void insert_rows(Block_Rows &rows, Teuchos::RCP<Matrix_t> matrix) const;
+
+    // Insert the staged rows into a block matrix.
+    void insert_block_rows(const Block_Rows &rows,
+                           Teuchos::RCP<BSR_Matrix<T> > matrix) const;
 
     // Gather object.
     FV_Gather d_gather;
@@ -204,33 +307,20 @@ class Linear_System_FV : public Linear_System<T>
     // global/local faces if vacuum/source
     int d_bc_global[6], d_bc_local[6];
 
-    // Serial work matrices.
-    Serial_Matrix d_D_c; // diffusion matrix in local cell for moment n
-    Serial_Matrix d_C_c; // local cell matrix coefficient
-    Serial_Matrix d_D;   // diffusion matrix in a neighbor cell for moment n
-    Serial_Matrix d_C;   // matrix coefficient from neighbor cell
-    Serial_Matrix d_W;   // work matrix
-
     // Global cell widths by dimension.
     profugus::Vector_Lite<def::Vec_Dbl, 3> d_widths;
 
-    // LAPACK object.
-    Teuchos::LAPACK<int, double> d_lapack;
+    // Maximum number of cells assembled in each threaded chunk.
+    int d_chunk;
 
-    // LAPACK work arrays.
-    def::Vec_Dbl d_work;
-    def::Vec_Int d_ipiv;
-    int          d_info;
+    // Memory (megabytes) used to stage the block rows of a chunk.
+    double d_staging_mb;
 
-    // Indices used to make matrix rows.
-    Teuchos::ArrayRCP<int> d_indices;
-                       // the max will always be (6 (coupled cells) + 4
-                       // (number of equations)) X number of groups; however
-                       // we only insert one G x G block at a time, so this is
-                       // set to G
+    // Apply the LHS operator without assembling it.
+    bool d_matrix_free;
 
-    // Values for a matrix row.
-    Teuchos::ArrayRCP<double> d_values;
+    // Store the LHS matrix in blocks.
+    bool d_bsr;
 };
 
 //---------------------------------------------------------------------------//
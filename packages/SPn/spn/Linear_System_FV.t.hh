@@ -11,11 +11,17 @@
 #ifndef SPn_spn_Linear_System_FV_t_hh
 #define SPn_spn_Linear_System_FV_t_hh
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "comm/global.hh"
 #include "comm/P_Stream.hh"
 #include "utils/Constants.hh"
+#include "utils/String_Functions.hh"
 
 #include "Linear_System_FV.hh"
+#include "FV_Operator.hh"
 
 #include "MatrixTraits.hh"
 #include "VectorTraits.hh"
@@ -61,16 +67,14 @@ Linear_System_FV<T>::Linear_System_FV(RCP_ParameterList db,
     , d_last_K(d_G[def::K] - 1)
     , d_Nb_global(0)
     , d_Nb_local(0)
-    , d_D_c(d_Ng, d_Ng)
-    , d_C_c(d_Ng, d_Ng)
-    , d_D(d_Ng, d_Ng)
-    , d_C(d_Ng, d_Ng)
-    , d_W(d_Ng, d_Ng)
     , d_widths(Vec_Dbl(data->num_cells(def::I)),
                Vec_Dbl(data->num_cells(def::J)),
                Vec_Dbl(data->num_cells(def::K)))
-    , d_work(d_Ng)
-    , d_ipiv(d_Ng)
+    , d_chunk(db->get("assembly_chunk_size", 4096))
+    , d_staging_mb(db->get("assembly_staging_mb", 256.0))
+    , d_matrix_free(db->get("matrix_free", false))
+    , d_bsr(profugus::lower(db->get("matrix_storage", std::string("crs")))
+            == "bsr")
 {
     using def::I; using def::J; using def::K;
 
@@ -84,6 +88,14 @@ Linear_System_FV<T>::Linear_System_FV(RCP_ParameterList db,
     REQUIRE(b_db->isParameter("boundary"));
     REQUIRE(d_Nc == d_mesh->num_cells());
     REQUIRE(d_Gc == data->num_cells());
+    REQUIRE(d_chunk > 0);
+    REQUIRE(d_staging_mb > 0.0);
+
+    VALIDATE(d_bsr || profugus::lower(b_db->template get<std::string>(
+                 "matrix_storage")) == "crs",
+             "Matrix storage must be 'crs' or 'bsr'.");
+    VALIDATE(!(d_bsr && d_matrix_free),
+             "The 'bsr' matrix storage cannot be used with matrix_free.");
 
     // only support single-set decompositions with SPN
     INSIST(indexer->num_sets() == 1,
@@ -177,14 +189,6 @@ Linear_System_FV<T>::Linear_System_FV(RCP_ParameterList db,
     // make the map
     b_map = MatrixTraits<T>::build_map(N_local,N_global,l2g);
 
-    // allocate space for the number of potential non-zero indices per row;
-    // the matrix bandwidth (entries per row) is the (number of equations +
-    // the number of spatially coupled cells) X the number of groups,
-    // ie. (num-equations + 6) * Ng -> HOWEVER, we only ever insert at most 1
-    // GXG block at a time, so this can be sized by G
-    d_indices.resize(d_Ng);
-    d_values.resize(d_Ng);
-
     // make the RHS vector
     b_rhs = VectorTraits<T>::build_vector(b_map);
 }
@@ -203,97 +207,163 @@ void Linear_System_FV<T>::build_Matrix()
     REQUIRE(!d_mesh.is_null());
     REQUIRE(!d_indexer.is_null());
 
-    // make the matrix
-    d_matrix   = MatrixTraits<T>::construct_matrix(b_map,d_Ng);
-    b_operator = d_matrix;
+    // build the matrix-free operator if requested
+    if (d_matrix_free)
+    {
+        Teuchos::RCP<FV_Operator<T> > op = Teuchos::rcp(
+            new FV_Operator<T>(b_map, b_mom_coeff, b_mat, d_mesh, d_indexer,
+                               d_widths, d_bnd_index, d_gather));
+        d_matrix   = Teuchos::null;
+        b_operator = op;
+
+        profugus::pout << ">>> Built matrix-free SPN FV Element LHS Operator "
+                       << "with " << op->num_blocks()
+                       << " local face-coupling blocks." << profugus::endl;
+        return;
+    }
+
+    // make the matrix; the matrix bandwidth (entries per row) is at most the
+    // (number of equations + the number of spatially coupled cells) X the
+    // number of groups, ie. (num-equations + 6) * Ng
+    if (d_bsr)
+    {
+        // size each block row from its stencil: the moment equations of
+        // the cell and each spatial neighbor (cell or boundary unknown);
+        // boundary rows couple the moment equations on the face and the
+        // volume cell
+        Vec_Int blocks((d_Nv_local + d_Nb_local) / d_Ng, d_Ne + 1);
+        for (int cell = 0; cell < d_Nc; ++cell)
+        {
+            int g_i = cell % d_N[I] + d_indexer->offset(I);
+            int g_j = (cell / d_N[I]) % d_N[J] + d_indexer->offset(J);
+            int k   = cell / (d_N[I] * d_N[J]);
+
+            int neighbors =
+                (g_i > d_first  || !d_bnd_index[0].is_null()) +
+                (g_i < d_last_I || !d_bnd_index[1].is_null()) +
+                (g_j > d_first  || !d_bnd_index[2].is_null()) +
+                (g_j < d_last_J || !d_bnd_index[3].is_null()) +
+                (k   > d_first  || !d_bnd_index[4].is_null()) +
+                (k   < d_last_K || !d_bnd_index[5].is_null());
+
+            for (int eqn = 0; eqn < d_Ne; ++eqn)
+            {
+                blocks[index(0, eqn, cell) / d_Ng] = d_Ne + neighbors;
+            }
+        }
+
+        d_block_matrix = Teuchos::rcp(
+            new BSR_Matrix<T>(b_map, d_Ng, blocks));
+        d_matrix       = Teuchos::null;
+        b_operator     = d_block_matrix;
+    }
+    else
+    {
+        d_matrix   = MatrixTraits<T>::construct_static_matrix(
+            b_map, (d_Ne + 6) * d_Ng);
+        b_operator = d_matrix;
+    }
 
     // off-processor face fields of diffusion coefficients
     RCP_Face_Field Dx_low, Dx_high, Dy_low, Dy_high;
 
-    // reference to indexer
-    const LG_Indexer &index = *d_indexer;
-
     // global offsets in the (i,j) direction for this mesh block
-    int i_off = index.offset(I);
-    int j_off = index.offset(J);
-
-    // global i,j and cell
-    int g_i = 0, g_j = 0, global = 0;
+    int i_off = d_indexer->offset(I);
+    int j_off = d_indexer->offset(J);
 
     // >>> VOLUME EQUATIONS
 
-    // outer loop over number of equations
-    for (int eqn = 0; eqn < d_Ne; ++eqn)
+    // cells on the (i,j) sides of this block couple to the diffusion
+    // coefficients of the neighboring blocks; the interior cells are
+    // assembled while those are exchanged
+    Vec_Int cells[2];
+    for (int cell = 0; cell < d_Nc; ++cell)
     {
-        // gather off-processor diffusion coefficients for this equation
-        d_gather.gather(eqn);
+        int i = cell % d_N[I];
+        int j = (cell / d_N[I]) % d_N[J];
 
-        // get the face-fields holding the off-processor diffusion
-        // coefficients (some may be null)
-        Dx_low  = d_gather.low_side_D(I);
-        Dy_low  = d_gather.low_side_D(J);
-        Dx_high = d_gather.high_side_D(I);
-        Dy_high = d_gather.high_side_D(J);
+        bool side = i == 0 || i == d_N[I] - 1 || j == 0 || j == d_N[J] - 1;
+        cells[side].push_back(cell);
+    }
 
-        for (int k = 0; k < d_N[K]; ++k)
+    // start the exchange of the off-processor diffusion coefficients of all
+    // equations
+    d_gather.start_gather(d_Ne);
+
+    // block rows (one per cell) staged for insertion; each couples to the
+    // equations in the cell and to its 6 neighbors
+    const int chunk = chunk_cells(d_Ne + 6);
+    std::vector<Block_Rows> staged(chunk);
+
+    // interior cells first, then the block-side cells once the exchange has
+    // completed
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        const Vec_Int &pass_cells = cells[pass];
+        const int      Np         = pass_cells.size();
+
+        if (pass == 1)
         {
-            for (int j = 0; j < d_N[J]; ++j)
+            d_gather.finish_gather();
+        }
+
+        // outer loop over number of equations
+        for (int eqn = 0; eqn < d_Ne; ++eqn)
+        {
+            // get the face-fields holding the off-processor diffusion
+            // coefficients (some may be null, and interior cells do not use
+            // them)
+            if (pass == 1)
             {
-                for (int i = 0; i < d_N[I]; ++i)
+                Dx_low  = d_gather.low_side_D(I, eqn);
+                Dy_low  = d_gather.low_side_D(J, eqn);
+                Dx_high = d_gather.high_side_D(I, eqn);
+                Dy_high = d_gather.high_side_D(J, eqn);
+            }
+
+            // build the block rows of each chunk of cells in parallel and
+            // then insert them into the matrix
+            for (int begin = 0; begin < Np; begin += chunk)
+            {
+                int end = std::min(begin + chunk, Np);
+
+#pragma omp parallel
                 {
-                    // get the global indices, we do not have to convert k
-                    // because all of k lives on each processor for the KBA
-                    // decomposition
-                    g_i = i + i_off;
-                    g_j = j + j_off;
-                    CHECK(index.convert_to_global(i, j) ==
-                           LG_Indexer::IJ_Set(g_i, g_j));
-                    CHECK(index.l2g(i, j, k) == index.g2g(g_i, g_j, k));
-
-                    // global cell index
-                    global = index.l2g(i, j, k);
-
-                    // build all of the G x G block matrices for this
-                    // (equation, cell) block row; we will then add them
-                    // element-by-element by inserting each row for each block
-                    // matrix; this will incur some overhead, but everything
-                    // will be summed and cleaned up at FillComplete()
-
-                    // make the diffusion coefficient for this moment equation
-                    // in this cell
-                    b_mom_coeff->make_D(eqn, index.l2l(i, j, k), d_D_c);
-
-                    // make A_nn matrix -> this adds A_nn to the
-                    // diagonal-block (its placed in C_c); we need to do this
-                    // before adding off-diagonal coupling terms
-                    b_mom_coeff->make_A(eqn, eqn, index.l2l(i, j, k), d_C_c);
-
-                    // FIRST: add spatially-coupled matrix elements
-                    spatial_coupled_element(eqn, i, j, k, g_i, g_j,
-                                            Dx_low, Dx_high, Dy_low, Dy_high);
-
-                    // SECOND: insert the diagonal block
-                    insert_block_matrix(eqn, global, 0, eqn, global, 0, d_C_c,
-                                        d_matrix);
-
-                    // LAST: insert within-cell coupling with other moment
-                    // equations
-                    for (int m = 0; m < d_Ne; ++m)
+                    Assembly_Work w(d_Ng);
+
+#pragma omp for schedule(static)
+                    for (int n = begin; n < end; ++n)
                     {
-                        if (m != eqn)
+                        int cell = pass_cells[n];
+                        int i    = cell % d_N[I];
+                        int j    = (cell / d_N[I]) % d_N[J];
+                        int k    = cell / (d_N[I] * d_N[J]);
+
+                        build_volume_rows(eqn, i, j, k, i_off, j_off,
+                                          Dx_low, Dx_high, Dy_low, Dy_high,
+                                          w, staged[n - begin]);
+
+                        // each block row has its own storage in the block
+                        // matrix, so it is inserted by the thread that built
+                        // it
+                        if (d_bsr)
                         {
-                            // make Anm
-                            b_mom_coeff->make_A(eqn, m, index.l2l(i, j, k), d_W);
-
-                            // add it to the matrix
-                            insert_block_matrix(
-                                eqn, global, 0, m, global, 0, d_W, d_matrix);
+                            insert_block_rows(staged[n - begin],
+                                              d_block_matrix);
                         }
                     }
-                } // I
-            } // J
-        } // K
-    } // eqn
+                }
+
+                if (!d_bsr)
+                {
+                    for (int n = begin; n < end; ++n)
+                    {
+                        insert_rows(staged[n - begin], d_matrix);
+                    }
+                }
+            }
+        } // eqn
+    } // pass
 
     // >>> BOUNDARY EQUATIONS
     if (d_Nb_local)
@@ -302,6 +372,11 @@ void Linear_System_FV<T>::build_Matrix()
         int lf[6] = {0, d_N[I] - 1, 0, d_N[J] - 1, 0, d_N[K] - 1};
         int gf[6] = {d_first, d_last_I, d_first, d_last_J, d_first, d_last_K};
 
+        // work matrices and staged rows (the boundary equations are built
+        // serially)
+        Assembly_Work w(d_Ng);
+        Block_Rows    rows;
+
         // low/high x face
         for (int f = 0; f < 2; ++f)
         {
@@ -317,7 +392,7 @@ void Linear_System_FV<T>::build_Matrix()
                         add_boundary_equations(d_bnd_index[f]->l2g(j, k),
                                                d_indexer->l2g(lf[f], j, k),
                                                d_indexer->l2l(lf[f], j, k),
-                                               d_widths[I][gf[f]]);
+                                               d_widths[I][gf[f]], w, rows);
                     }
                 }
             }
@@ -338,7 +413,7 @@ void Linear_System_FV<T>::build_Matrix()
                         add_boundary_equations(d_bnd_index[f]->l2g(i, k),
                                                d_indexer->l2g(i, lf[f], k),
                                                d_indexer->l2l(i, lf[f], k),
-                                               d_widths[J][gf[f]]);
+                                               d_widths[J][gf[f]], w, rows);
                     }
                 }
             }
@@ -359,7 +434,7 @@ void Linear_System_FV<T>::build_Matrix()
                         add_boundary_equations(d_bnd_index[f]->l2g(i, j),
                                                d_indexer->l2g(i, j, lf[f]),
                                                d_indexer->l2l(i, j, lf[f]),
-                                               d_widths[K][gf[f]]);
+                                               d_widths[K][gf[f]], w, rows);
                     }
                 }
             }
@@ -367,6 +442,15 @@ void Linear_System_FV<T>::build_Matrix()
     }
 
     // complete fill of matrix
+    if (d_bsr)
+    {
+        d_block_matrix->fill_complete();
+
+        profugus::pout << ">>> Built SPN FV Element LHS Block Matrix with "
+                       << d_block_matrix->global_nonzeros()
+                       << " stored entries." << profugus::endl;
+        return;
+    }
     MatrixTraits<T>::finalize_matrix(d_matrix);
 
     // Epetra returns the global number of nonzeros as a 32 bit signed int
@@ -391,44 +475,60 @@ void Linear_System_FV<T>::build_fission_matrix()
     REQUIRE(!d_mesh.is_null());
     REQUIRE(!b_mat.is_null());
 
-    // as for the A matrix, here we build the matrix/graph at the same time
-    // (since the coupling is much easier->no spatial coupling)
-    d_fission = MatrixTraits<T>::construct_matrix(b_map,d_Ng);
+    // each block row couples only the equations within a cell, so there are
+    // at most num-equations * Ng entries per row
+    d_fission = MatrixTraits<T>::construct_static_matrix(b_map, d_Ne * d_Ng);
     b_fission = d_fission;
 
-    // material id and (local/global) cell index
-    int matid  = 0;
-    int local  = 0;
-    int global = 0;
+    // block rows (one per equation in each cell) staged for insertion
+    const int chunk = chunk_cells(d_Ne * d_Ne);
+    std::vector<Block_Rows> staged(chunk * d_Ne);
 
-    // outer loop over cells -> we can loop directly over cells because there
-    // is no neighbor coupling in the fission matrix
-    for (int k = 0; k < d_N[K]; ++k)
+    // loop over chunks of cells -> we can loop directly over cells because
+    // there is no neighbor coupling in the fission matrix
+    for (int begin = 0; begin < d_Nc; begin += chunk)
     {
-        for (int j = 0; j < d_N[J]; ++j)
+        int end = std::min(begin + chunk, d_Nc);
+
+#pragma omp parallel
         {
-            for (int i = 0; i < d_N[I]; ++i)
+            Serial_Matrix F(d_Ng, d_Ng);
+
+#pragma omp for schedule(static)
+            for (int cell = begin; cell < end; ++cell)
             {
+                int i = cell % d_N[I];
+                int j = (cell / d_N[I]) % d_N[J];
+                int k = cell / (d_N[I] * d_N[J]);
+
                 // get the cell indices
-                global = d_indexer->l2g(i, j, k);
-                local  = d_indexer->l2l(i, j, k);
+                int global = d_indexer->l2g(i, j, k);
+                int local  = d_indexer->l2l(i, j, k);
 
                 // inner loop over equations (elements in the row)
                 for (int eqn = 0; eqn < d_Ne; ++eqn)
                 {
+                    Block_Rows &rows = staged[(cell - begin) * d_Ne + eqn];
+                    rows.reset();
+
                     // insert coupling with other moment equations
                     for (int m = 0; m < d_Ne; ++m)
                     {
                         // make Fnm
-                        b_mom_coeff->make_F(eqn, m, local, d_W);
+                        b_mom_coeff->make_F(eqn, m, local, F);
 
-                        // add it to the matrix
-                        insert_block_matrix(eqn, global, 0, m, global, 0,
-                                            d_W, d_fission);
+                        // add it to the block row
+                        insert_block_matrix(eqn, global, 0, m, global, 0, F,
+                                            rows);
                     }
                 }
             }
         }
+
+        for (int n = 0, N = (end - begin) * d_Ne; n < N; ++n)
+        {
+            insert_rows(staged[n], d_fission);
+        }
     }
 
     // finish matrix
@@ -514,6 +614,64 @@ void Linear_System_FV<T>::build_RHS(const External_Source &q)
     CHECK(face == d_Nc + d_Nb_local / d_unknowns_per_cell);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add the time-source from the previous timestep to the RHS.
+ *
+ * For a backward-Euler step the right-hand side gains
+ * \f$\mathbf{T}\mathbf{u}^{n-1}\f$ in each volume cell, where
+ * \f$\mathbf{T}\f$ is the (diagonal in group) time-derivative part of
+ * \f$\mathbf{A}\f$ (see Moment_Coefficients::make_T()).  This is called
+ * after build_RHS(); boundary unknowns are unchanged.
+ *
+ * \param u solution vector from the previous timestep
+ */
+template <class T>
+void Linear_System_FV<T>::add_time_source(Teuchos::RCP<const MV> u)
+{
+    REQUIRE(!b_dt.is_null());
+    REQUIRE(!u.is_null());
+    REQUIRE(VectorTraits<T>::local_length(u) ==
+            VectorTraits<T>::local_length(b_rhs));
+
+    // get the diagonals of the time blocks, t[g + Ng * (m + Ne * n)]
+    Vec_Dbl t(d_Ng * d_Ne * d_Ne, 0.0);
+    Serial_Matrix W(d_Ng, d_Ng);
+    for (int n = 0; n < d_Ne; ++n)
+    {
+        for (int m = 0; m < d_Ne; ++m)
+        {
+            b_mom_coeff->make_T(n, m, W);
+            for (int g = 0; g < d_Ng; ++g)
+            {
+                t[g + d_Ng * (m + d_Ne * n)] = W(g, g);
+            }
+        }
+    }
+
+    Teuchos::ArrayRCP<double> data =
+        VectorTraits<T>::get_data_nonconst(b_rhs);
+    Teuchos::ArrayRCP<const double> u_data = VectorTraits<T>::get_data(u);
+
+    // loop through cells
+    for (int cell = 0; cell < d_Nc; ++cell)
+    {
+        for (int n = 0; n < d_Ne; ++n)
+        {
+            for (int g = 0; g < d_Ng; ++g)
+            {
+                double sum = 0.0;
+                for (int m = 0; m < d_Ne; ++m)
+                {
+                    sum += t[g + d_Ng * (m + d_Ne * n)] *
+                           u_data[index(g, m, cell)];
+                }
+                data[index(g, n, cell)] += sum;
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // PRIVATE FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -773,21 +931,90 @@ void Linear_System_FV<T>::map_bnd_l2g(RCP_Bnd_Indexer  indexer,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the block row for an equation in a volume cell.
+ *
+ * This is called concurrently on different cells; all work data is in \a w
+ * and the rows are staged in \a rows.
+ */
+template <class T>
+void Linear_System_FV<T>::build_volume_rows(int                   eqn,
+                                            int                   i,
+                                            int                   j,
+                                            int                   k,
+                                            int                   i_off,
+                                            int                   j_off,
+                                            const RCP_Face_Field &Dx_low,
+                                            const RCP_Face_Field &Dx_high,
+                                            const RCP_Face_Field &Dy_low,
+                                            const RCP_Face_Field &Dy_high,
+                                            Assembly_Work        &w,
+                                            Block_Rows           &rows) const
+{
+    // reference to indexer
+    const LG_Indexer &index = *d_indexer;
+
+    // get the global indices, we do not have to convert k because all of k
+    // lives on each processor for the KBA decomposition
+    int g_i = i + i_off;
+    int g_j = j + j_off;
+    CHECK(index.convert_to_global(i, j) == LG_Indexer::IJ_Set(g_i, g_j));
+    CHECK(index.l2g(i, j, k) == index.g2g(g_i, g_j, k));
+
+    // global and local cell index
+    int global = index.l2g(i, j, k);
+    int local  = index.l2l(i, j, k);
+
+    // build all of the G x G block matrices for this (equation, cell) block
+    // row; they are staged row-by-row and inserted into the matrix later
+    rows.reset();
+
+    // make the diffusion coefficient for this moment equation in this cell
+    b_mom_coeff->make_D(eqn, local, w.D_c);
+
+    // make A_nn matrix -> this adds A_nn to the diagonal-block (its placed in
+    // C_c); we need to do this before adding off-diagonal coupling terms
+    b_mom_coeff->make_A(eqn, eqn, local, w.C_c);
+
+    // FIRST: add spatially-coupled matrix elements
+    spatial_coupled_element(eqn, i, j, k, g_i, g_j, Dx_low, Dx_high, Dy_low,
+                            Dy_high, w, rows);
+
+    // SECOND: insert the diagonal block
+    insert_block_matrix(eqn, global, 0, eqn, global, 0, w.C_c, rows);
+
+    // LAST: insert within-cell coupling with other moment equations
+    int matid = b_mat->matid(local);
+    for (int m = 0; m < d_Ne; ++m)
+    {
+        if (m != eqn)
+        {
+            // add the (cached) Anm block
+            insert_block_matrix(eqn, global, 0, m, global, 0,
+                                b_mom_coeff->A_block(eqn, m, matid), rows);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Insert spatially coupled elements.
  */
 template <class T>
-void Linear_System_FV<T>::spatial_coupled_element(int            n,
-                                                  int            i,
-                                                  int            j,
-                                                  int            k,
-                                                  int            g_i,
-                                                  int            g_j,
-                                                  RCP_Face_Field Dx_low,
-                                                  RCP_Face_Field Dx_high,
-                                                  RCP_Face_Field Dy_low,
-                                                  RCP_Face_Field Dy_high)
+void Linear_System_FV<T>::spatial_coupled_element(
+    int                   n,
+    int                   i,
+    int                   j,
+    int                   k,
+    int                   g_i,
+    int                   g_j,
+    const RCP_Face_Field &Dx_low,
+    const RCP_Face_Field &Dx_high,
+    const RCP_Face_Field &Dy_low,
+    const RCP_Face_Field &Dy_high,
+    Assembly_Work        &w,
+    Block_Rows           &rows) const
 {
     using def::I; using def::J; using def::K;
 
@@ -808,11 +1035,12 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         if (i > 0)
         {
             // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i - 1, j, k), d_D);
+            b_mom_coeff->make_D(n, d_indexer->l2l(i - 1, j, k), w.D);
 
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[I][g_i - 1],
-                                d_widths[I][g_i], d_widths[I][g_i], d_D_c, d_D);
+                                d_widths[I][g_i], d_widths[I][g_i], w.D_c, w.D,
+                                w, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the low-internal-boundary side; we can only get here in a
@@ -828,7 +1056,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
 
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[I][g_i - 1],
-                                d_widths[I][g_i], d_widths[I][g_i], d_D_c, D);
+                                d_widths[I][g_i], d_widths[I][g_i], w.D_c, D,
+                                w, rows);
         }
     }
     else if (!d_bnd_index[0].is_null())
@@ -837,7 +1066,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[0]->l2g(j, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[I][d_first]);
+        build_bnd_element(n, global, neighbor, d_widths[I][d_first],
+                          w, rows);
     }
 
     if (g_i < d_last_I)
@@ -850,12 +1080,12 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         if (i < d_N[I] - 1)
         {
             // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i + 1, j, k), d_D);
+            b_mom_coeff->make_D(n, d_indexer->l2l(i + 1, j, k), w.D);
 
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[I][g_i],
                                 d_widths[I][g_i + 1], d_widths[I][g_i],
-                                d_D, d_D_c);
+                                w.D, w.D_c, w, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the high-internal-boundary side; we can only get here in a
@@ -872,7 +1102,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[I][g_i],
                                 d_widths[I][g_i + 1], d_widths[I][g_i],
-                                D, d_D_c);
+                                D, w.D_c, w, rows);
         }
     }
     else if (!d_bnd_index[1].is_null())
@@ -881,7 +1111,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[1]->l2g(j, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[I][d_last_I]);
+        build_bnd_element(n, global, neighbor, d_widths[I][d_last_I],
+                          w, rows);
     }
 
     if (g_j > d_first)
@@ -894,11 +1125,12 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         if (j > 0)
         {
             // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i, j - 1, k), d_D);
+            b_mom_coeff->make_D(n, d_indexer->l2l(i, j - 1, k), w.D);
 
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[J][g_j - 1],
-                                d_widths[J][g_j], d_widths[J][g_j], d_D_c, d_D);
+                                d_widths[J][g_j], d_widths[J][g_j], w.D_c, w.D,
+                                w, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the low-internal-boundary side; we can only get here in a
@@ -914,7 +1146,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
 
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[J][g_j - 1],
-                                d_widths[J][g_j], d_widths[J][g_j], d_D_c, D);
+                                d_widths[J][g_j], d_widths[J][g_j], w.D_c, D,
+                                w, rows);
         }
     }
     else if (!d_bnd_index[2].is_null())
@@ -923,7 +1156,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[2]->l2g(i, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[J][d_first]);
+        build_bnd_element(n, global, neighbor, d_widths[J][d_first],
+                          w, rows);
     }
 
     if (g_j < d_last_J)
@@ -936,12 +1170,12 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         if (j < d_N[J] - 1)
         {
             // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i, j + 1, k), d_D);
+            b_mom_coeff->make_D(n, d_indexer->l2l(i, j + 1, k), w.D);
 
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[J][g_j],
                                 d_widths[J][g_j + 1], d_widths[J][g_j],
-                                d_D, d_D_c);
+                                w.D, w.D_c, w, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the high-internal-boundary side; we can only get here in a
@@ -958,7 +1192,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
             // add the spatial element to the matrix
             add_spatial_element(n, global, neighbor, d_widths[J][g_j],
                                 d_widths[J][g_j + 1], d_widths[J][g_j],
-                                D, d_D_c);
+                                D, w.D_c, w, rows);
         }
     }
     else if (!d_bnd_index[3].is_null())
@@ -967,7 +1201,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[3]->l2g(i, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[J][d_last_J]);
+        build_bnd_element(n, global, neighbor, d_widths[J][d_last_J],
+                          w, rows);
     }
 
     if (k > d_first)
@@ -977,9 +1212,10 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
 
         // make the neighbor diffusion coefficient on this processor (K is
         // always local)
-        b_mom_coeff->make_D(n, d_indexer->l2l(i, j, k - 1), d_D);
+        b_mom_coeff->make_D(n, d_indexer->l2l(i, j, k - 1), w.D);
         add_spatial_element(n, global, neighbor, d_widths[K][k - 1],
-                            d_widths[K][k], d_widths[K][k], d_D_c, d_D);
+                            d_widths[K][k], d_widths[K][k], w.D_c, w.D,
+                            w, rows);
     }
     else if (!d_bnd_index[4].is_null())
     {
@@ -987,7 +1223,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[4]->l2g(i, j);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[K][d_first]);
+        build_bnd_element(n, global, neighbor, d_widths[K][d_first],
+                          w, rows);
     }
 
     if (k < d_last_K)
@@ -997,9 +1234,10 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
 
         // make the neighbor diffusion coefficient on this processor (K is
         // always local)
-        b_mom_coeff->make_D(n, d_indexer->l2l(i, j, k + 1), d_D);
+        b_mom_coeff->make_D(n, d_indexer->l2l(i, j, k + 1), w.D);
         add_spatial_element(n, global, neighbor, d_widths[K][k],
-                            d_widths[K][k + 1], d_widths[K][k], d_D, d_D_c);
+                            d_widths[K][k + 1], d_widths[K][k], w.D, w.D_c,
+                            w, rows);
     }
     else if (!d_bnd_index[5].is_null())
     {
@@ -1007,7 +1245,8 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[5]->l2g(i, j);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[K][d_last_K]);
+        build_bnd_element(n, global, neighbor, d_widths[K][d_last_K],
+                          w, rows);
     }
 }
 
@@ -1032,55 +1271,58 @@ void Linear_System_FV<T>::add_spatial_element(int                  eqn,
                                               double               delta_r,
                                               double               delta_c,
                                               const Serial_Matrix &Dl,
-                                              const Serial_Matrix &Dr)
+                                              const Serial_Matrix &Dr,
+                                              Assembly_Work       &w,
+                                              Block_Rows          &rows) const
 {
     REQUIRE(Dl.numRows()    == d_Ng);
     REQUIRE(Dl.numCols()    == d_Ng);
     REQUIRE(Dr.numRows()    == d_Ng);
     REQUIRE(Dr.numCols()    == d_Ng);
-    REQUIRE(d_C.numCols()   == d_Ng);
-    REQUIRE(d_C.numRows()   == d_Ng);
-    REQUIRE(d_C_c.numCols() == d_Ng);
-    REQUIRE(d_C_c.numRows() == d_Ng);
+    REQUIRE(w.C.numCols()   == d_Ng);
+    REQUIRE(w.C.numRows()   == d_Ng);
+    REQUIRE(w.C_c.numCols() == d_Ng);
+    REQUIRE(w.C_c.numRows() == d_Ng);
     REQUIRE(delta_c > 0.0);
 
     // make C for this neighbor coupling -> note that Dl and Dr are references
-    // to d_D and d_D_c depending on the spatial coupling direction
+    // to w.D and w.D_c depending on the spatial coupling direction
 
     // make the sum term (delta_l * Dl + delta_r * Dr)
-    d_C.assign(Dl);
-    d_C *= delta_l;
+    w.C.assign(Dl);
+    w.C *= delta_l;
 
-    d_W.assign(Dr);
-    d_W *= delta_r;
+    w.W.assign(Dr);
+    w.W *= delta_r;
 
-    d_C += d_W;
+    w.C += w.W;
 
     // invert
 
     // LU decomposition
-    d_lapack.GETRF(d_Ng, d_Ng, d_C.values(), d_C.stride(), &d_ipiv[0], &d_info);
-    CHECK(d_info == 0);
+    w.lapack.GETRF(d_Ng, d_Ng, w.C.values(), w.C.stride(), &w.ipiv[0],
+                   &w.info);
+    CHECK(w.info == 0);
 
     // inverse
-    d_lapack.GETRI(d_Ng, d_C.values(), d_C.stride(), &d_ipiv[0], &d_work[0],
-                   d_Ng, &d_info);
-    CHECK(d_info == 0);
+    w.lapack.GETRI(d_Ng, w.C.values(), w.C.stride(), &w.ipiv[0], &w.work[0],
+                   d_Ng, &w.info);
+    CHECK(w.info == 0);
 
     // multiply W = C*Dr
-    d_W.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, d_C, Dr, 0.0);
+    w.W.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, w.C, Dr, 0.0);
 
     // multiply Dl * W = Dl * (C*Dr)
-    d_C.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, Dl, d_W, 0.0);
+    w.C.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, Dl, w.W, 0.0);
 
     // multiply by -2.0 / delta_c
-    d_C *= -2.0 / delta_c;
+    w.C *= -2.0 / delta_c;
 
     // add C to the spatially-coupled column
-    insert_block_matrix(eqn, row_cell, 0,  eqn, col_cell, 0, d_C, d_matrix);
+    insert_block_matrix(eqn, row_cell, 0,  eqn, col_cell, 0, w.C, rows);
 
     // add (C is negative) to the local (n,i,j,k) contribution to the matrix
-    d_C_c -= d_C;
+    w.C_c -= w.C;
 }
 
 //---------------------------------------------------------------------------//
@@ -1093,29 +1335,31 @@ void Linear_System_FV<T>::add_spatial_element(int                  eqn,
  * \param delta_c
  */
 template <class T>
-void Linear_System_FV<T>::build_bnd_element(int    eqn,
-                                            int    global_row,
-                                            int    global_col,
-                                            double delta_c)
+void Linear_System_FV<T>::build_bnd_element(int            eqn,
+                                            int            global_row,
+                                            int            global_col,
+                                            double         delta_c,
+                                            Assembly_Work &w,
+                                            Block_Rows    &rows) const
 {
-    REQUIRE(d_C.numCols()   == d_Ng);
-    REQUIRE(d_C.numRows()   == d_Ng);
-    REQUIRE(d_C_c.numCols() == d_Ng);
-    REQUIRE(d_C_c.numRows() == d_Ng);
+    REQUIRE(w.C.numCols()   == d_Ng);
+    REQUIRE(w.C.numRows()   == d_Ng);
+    REQUIRE(w.C_c.numCols() == d_Ng);
+    REQUIRE(w.C_c.numRows() == d_Ng);
     REQUIRE(delta_c > 0.0);
 
     // make C for this boundary coupling
 
     // make the sum term
-    d_C.assign(d_D_c);
-    d_C *= -2.0 / (delta_c * delta_c);
+    w.C.assign(w.D_c);
+    w.C *= -2.0 / (delta_c * delta_c);
 
     // add C to the boundary-coupled column
-    insert_block_matrix(eqn, global_row, 0, eqn, global_col, d_Nv_global, d_C,
-                        d_matrix);
+    insert_block_matrix(eqn, global_row, 0, eqn, global_col, d_Nv_global, w.C,
+                        rows);
 
     // add (C is negative) to the local (n,i,j,k) contribution to the matrix
-    d_C_c -= d_C;
+    w.C_c -= w.C;
 }
 
 //---------------------------------------------------------------------------//
@@ -1123,33 +1367,34 @@ void Linear_System_FV<T>::build_bnd_element(int    eqn,
  * \brief Add boundary equations to the matrix.
  */
 template <class T>
-void Linear_System_FV<T>::add_boundary_equations(int    face,
-                                                 int    global_cell,
-                                                 int    local_cell,
-                                                 double delta_c)
+void Linear_System_FV<T>::add_boundary_equations(int            face,
+                                                 int            global_cell,
+                                                 int            local_cell,
+                                                 double         delta_c,
+                                                 Assembly_Work &w,
+                                                 Block_Rows    &rows)
 {
-    // global row index for the current boundary equations
-    int row = 0;
-
     // loop over equations
     for (int n = 0; n < d_Ne; ++n)
     {
+        rows.reset();
+
         // make the diffusion coefficient for this moment equation in this
         // cell
-        b_mom_coeff->make_D(n, local_cell, d_C);
+        b_mom_coeff->make_D(n, local_cell, w.C);
 
         // calculate C
-        d_C *= (-2.0 / delta_c);
+        w.C *= (-2.0 / delta_c);
 
         // make D_nn matrix and set it as the boundary term
-        b_mom_coeff->make_B(n, n, d_C_c);
+        b_mom_coeff->make_B(n, n, w.C_c);
 
         // add C (C is negative) to the nn boundary term
-        d_C_c -= d_C;
+        w.C_c -= w.C;
 
         // FIRST: add the volume cell term
-        insert_block_matrix(n, face, d_Nv_global, n, global_cell, 0, d_C,
-                            d_matrix);
+        insert_block_matrix(n, face, d_Nv_global, n, global_cell, 0, w.C,
+                            rows);
 
         // SECOND: add all the moment-coupling terms to the
         // boundary
@@ -1158,23 +1403,32 @@ void Linear_System_FV<T>::add_boundary_equations(int    face,
             if (m != n)
             {
                 // make Bnm
-                b_mom_coeff->make_B(n, m, d_W);
+                b_mom_coeff->make_B(n, m, w.W);
 
                 // add it to the matrix
                 insert_block_matrix(
-                    n, face, d_Nv_global, m, face, d_Nv_global, d_W, d_matrix);
+                    n, face, d_Nv_global, m, face, d_Nv_global, w.W, rows);
             }
         }
 
         // LAST: add the within-moment matrix element
-        insert_block_matrix(n, face, d_Nv_global, n, face, d_Nv_global, d_C_c,
-                            d_matrix);
+        insert_block_matrix(n, face, d_Nv_global, n, face, d_Nv_global, w.C_c,
+                            rows);
+
+        // insert the block row
+        if (d_bsr)
+            insert_block_rows(rows, d_block_matrix);
+        else
+            insert_rows(rows, d_matrix);
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Insert a block matrix (GXG) into the matrix.
+ * \brief Stage a block matrix (GXG) for insertion into a block row.
+ *
+ * The whole (dense) block is staged.  All blocks staged into \a rows must
+ * belong to the same block row.
  *
  * \param row_n equation for this (GXG) block row
  * \param row_cell global cell for this (GXG) block row
@@ -1193,49 +1447,134 @@ void Linear_System_FV<T>::insert_block_matrix(int                  row_n,
                                               int                  col_cell,
                                               int                  col_off,
                                               const Serial_Matrix &M,
-                                              Teuchos::RCP<Matrix_t> matrix)
+                                              Block_Rows          &rows) const
 {
     REQUIRE(row_n < d_Ne);
     REQUIRE(col_m < d_Ne);
     REQUIRE(M.numCols() == d_Ng);
     REQUIRE(M.numRows() == d_Ng);
 
-    // global row and column indices
-    int row = 0, col = 0;
+    // global index of the first row and column of the block; the groups of
+    // each (equation, cell) are contiguous, so these are Ng times the block
+    // row and column indices
+    int row = row_off + index(0, row_n, row_cell);
+    int col = col_off + index(0, col_m, col_cell);
+    CHECK(row >= 0 && row < d_Nv_global + d_Nb_global);
+    CHECK(col >= 0 && col < d_Nv_global + d_Nb_global);
+    CHECK(row % d_Ng == 0 && col % d_Ng == 0);
+
+    CHECK(rows.row < 0 || rows.row == row / d_Ng);
+    rows.row = row / d_Ng;
+    rows.cols.push_back(col / d_Ng);
+
+    // store the block column-major
+    for (int gp = 0; gp < d_Ng; ++gp)
+    {
+        for (int g = 0; g < d_Ng; ++g)
+        {
+            rows.blocks.push_back(M(g, gp));
+        }
+    }
+}
 
-    // counter
-    int ctr = 0;
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Number of cells in an assembly chunk.
+ *
+ * Each staged block takes \f$G^2\f$ doubles plus its block column and the
+ * point-row work space used to insert it.  The chunk holds as many cells as
+ * fit in the staging memory (at least one), capped by the
+ * "assembly_chunk_size" and the number of cells.
+ *
+ * \param blocks_per_cell maximum number of staged blocks for a cell
+ */
+template <class T>
+int Linear_System_FV<T>::chunk_cells(int blocks_per_cell) const
+{
+    REQUIRE(blocks_per_cell > 0);
 
-    // loop over rows (in g)
-    for(int g = 0; g < d_Ng; ++g)
-    {
-        // determine the row in global index space
-        row = row_off + index(g, row_n, row_cell);
-        CHECK(row >= 0 && row < d_Nv_global + d_Nb_global);
+    // bytes staged for a cell
+    double block_bytes = d_Ng * d_Ng * sizeof(double) + sizeof(int) +
+                         d_Ng * (sizeof(int) + sizeof(double));
+    double cell_bytes  = blocks_per_cell * block_bytes;
 
-        // initialize the row counter
-        ctr = 0;
+    double cells = d_staging_mb * 1048576.0 / cell_bytes;
+    int    limit = std::max(std::min(d_chunk, d_Nc), 1);
 
-        // loop over columns (in gp)
-        for (int gp = 0; gp < d_Ng; ++gp)
-        {
-            CHECK(ctr < d_Ng);
+    int chunk = cells < limit ? std::max(static_cast<int>(cells), 1) : limit;
+
+    ENSURE(chunk > 0 && chunk <= limit);
+    return chunk;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Insert the staged rows into a point matrix.
+ *
+ * Only non-zero entries are inserted.  Matrix insertion is not thread-safe,
+ * so this is always called outside of threaded regions.
+ */
+template <class T>
+void Linear_System_FV<T>::insert_rows(Block_Rows             &rows,
+                                      Teuchos::RCP<Matrix_t>  matrix) const
+{
+    REQUIRE(rows.blocks.size() == rows.cols.size() * d_Ng * d_Ng);
+
+    // skip empty block rows
+    if (rows.cols.empty())
+        return;
+    CHECK(rows.row >= 0);
 
-            // determine the column in global index space
-            col = col_off + index(gp, col_m, col_cell);
-            CHECK(col >= 0 && col < d_Nv_global + d_Nb_global);
+    // loop over rows (in g)
+    for (int g = 0; g < d_Ng; ++g)
+    {
+        rows.indices.clear();
+        rows.values.clear();
 
-            // only add non-zero entries
-            if (std::fabs(M(g, gp)) > 0.0)
+        // loop over the blocks and columns (in gp)
+        for (int b = 0, Nb = rows.cols.size(); b < Nb; ++b)
+        {
+            const double *block = &rows.blocks[b * d_Ng * d_Ng];
+            for (int gp = 0; gp < d_Ng; ++gp)
             {
-                d_indices[ctr] = col;
-                d_values[ctr]  = M(g, gp);
-                ++ctr;
+                if (std::fabs(block[g + gp * d_Ng]) > 0.0)
+                {
+                    rows.indices.push_back(rows.cols[b] * d_Ng + gp);
+                    rows.values.push_back(block[g + gp * d_Ng]);
+                }
             }
         }
 
-        // insert the row into the matrix
-        MatrixTraits<T>::add_to_matrix(matrix,row,ctr,d_indices,d_values);
+        int count = rows.indices.size();
+        if (count == 0)
+            continue;
+
+        MatrixTraits<T>::add_to_matrix(
+            matrix, rows.row * d_Ng + g, count,
+            Teuchos::arcp<const int>(rows.indices.data(), 0, count, false),
+            Teuchos::arcp<const double>(rows.values.data(), 0, count,
+                                        false));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Insert the staged rows into a block matrix.
+ *
+ * Block rows have their own storage in the block matrix, so different block
+ * rows can be inserted concurrently.
+ */
+template <class T>
+void Linear_System_FV<T>::insert_block_rows(
+    const Block_Rows             &rows,
+    Teuchos::RCP<BSR_Matrix<T> >  matrix) const
+{
+    REQUIRE(rows.blocks.size() == rows.cols.size() * d_Ng * d_Ng);
+
+    for (int b = 0, Nb = rows.cols.size(); b < Nb; ++b)
+    {
+        matrix->insert_block(rows.row, rows.cols[b],
+                             &rows.blocks[b * d_Ng * d_Ng]);
     }
 }
 
@@ -22,6 +22,7 @@
 #include "Teuchos_DefaultSerialComm.hpp"
 #endif
 
+#include "Epetra_FECrsMatrix.h"
 #include "EpetraExt_RowMatrixOut.h"
 #include "MatrixMarket_Tpetra.hpp"
 
@@ -75,6 +76,25 @@ class MatrixTraits
         return Teuchos::null;
     }
 
+    static Teuchos::RCP<Matrix_t> construct_static_matrix(
+        Teuchos::RCP<const Map_t> map, int max_per_row )
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+        return Teuchos::null;
+    }
+
+    static Teuchos::RCP<Matrix_t> construct_fe_matrix(
+        Teuchos::RCP<const Map_t> map, int num_per_row )
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+        return Teuchos::null;
+    }
+
+    static void assemble_fe_matrix(Teuchos::RCP<Matrix_t> matrix)
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+    }
+
     static int local_rows( Teuchos::RCP<const Matrix_t> matrix )
     {
         UndefinedMatrixTraits<T>::NotDefined();
@@ -180,6 +200,37 @@ class MatrixTraits<EpetraTypes>
         return matrix;
     }
 
+    // Matrix whose rows are preallocated (and may not grow past) max_per_row
+    // entries.
+    static Teuchos::RCP<Matrix_t> construct_static_matrix(
+        Teuchos::RCP<const Map_t> map, int max_per_row )
+    {
+        Teuchos::RCP<Matrix_t> matrix(
+            new Matrix_t(Copy, *map, max_per_row, true));
+        CHECK(!matrix->StorageOptimized());
+        return matrix;
+    }
+
+    // Matrix that accepts entries in rows owned by other domains; the
+    // entries are summed into the owning rows by assemble_fe_matrix().
+    static Teuchos::RCP<Matrix_t> construct_fe_matrix(
+        Teuchos::RCP<const Map_t> map, int num_per_row )
+    {
+        Teuchos::RCP<Matrix_t> matrix(
+            new Epetra_FECrsMatrix(Copy, *map, num_per_row));
+        return matrix;
+    }
+
+    static void assemble_fe_matrix(Teuchos::RCP<Matrix_t> matrix)
+    {
+        Teuchos::RCP<Epetra_FECrsMatrix> fe =
+            Teuchos::rcp_dynamic_cast<Epetra_FECrsMatrix>(matrix);
+        REQUIRE(!fe.is_null());
+        int err = fe->GlobalAssemble();
+        CHECK(err == 0);
+        ENSURE(matrix->Filled());
+    }
+
     static int local_rows( Teuchos::RCP<const Matrix_t> matrix )
     {
         return matrix->NumMyRows();
@@ -298,6 +349,32 @@ class MatrixTraits<TpetraTypes>
         return matrix;
     }
 
+    // Matrix whose rows are preallocated (and may not grow past) max_per_row
+    // entries.
+    static Teuchos::RCP<Matrix_t> construct_static_matrix(
+        Teuchos::RCP<const Map_t> map, int max_per_row )
+    {
+        Teuchos::RCP<Matrix_t> matrix(
+            new Matrix_t(map, max_per_row, Tpetra::StaticProfile));
+        CHECK(!matrix->isStorageOptimized());
+        return matrix;
+    }
+
+    // Matrix that accepts entries in rows owned by other domains; the
+    // entries are summed into the owning rows by assemble_fe_matrix().
+    static Teuchos::RCP<Matrix_t> construct_fe_matrix(
+        Teuchos::RCP<const Map_t> map, int num_per_row )
+    {
+        return Teuchos::rcp(new Matrix_t(map, num_per_row));
+    }
+
+    static void assemble_fe_matrix(Teuchos::RCP<Matrix_t> matrix)
+    {
+        // fillComplete() sums the off-domain entries into their owners
+        matrix->fillComplete();
+        ENSURE(matrix->isFillComplete());
+    }
+
     static int local_rows( Teuchos::RCP<const Matrix_t> matrix )
     {
         return matrix->getNodeNumRows();
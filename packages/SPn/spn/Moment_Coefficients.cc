@@ -49,6 +49,8 @@ Moment_Coefficients::Moment_Coefficients(RCP_ParameterList db,
     , d_W(d_Ng, d_Ng)
     , d_c(4, std::vector<Coefficients>(4))
     , d_outscatter_correction(false)
+    , d_Ne(dim->num_equations())
+    , d_Na(d_Ne * (d_Ne + 1) / 2)
     , d_work(d_Ng)
     , d_ipiv(d_Ng)
 {
@@ -192,6 +194,9 @@ Moment_Coefficients::Moment_Coefficients(RCP_ParameterList db,
     // complete the hash-table
     d_Sigma->complete();
     CHECK(d_Sigma->size() == num_mom * mats.size());
+
+    // build the D and A blocks for each material
+    build_cache();
 }
 
 //---------------------------------------------------------------------------//
@@ -310,58 +315,15 @@ void Moment_Coefficients::make_Sigma(int            n,
  */
 void Moment_Coefficients::make_D(int            n,
                                  int            cell,
-                                 Serial_Matrix &D)
+                                 Serial_Matrix &D) const
 {
     REQUIRE(!d_mat.is_null());
     REQUIRE(n >= 0 && n < d_dim->num_equations());
     REQUIRE(cell < d_mat->num_cells());
     REQUIRE(D.numRows() == D.numCols());
     REQUIRE(D.numRows() == d_Ng);
-    REQUIRE(d_mat->xs().num_groups() == d_Ng);
-
-    // first get sigma for this diffusion coefficient
-    int matid = d_mat->matid(cell);
-    CHECK( d_Sigma->exists(to_size_type(d_d[n],matid)) );
-    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(to_size_type(d_d[n],matid));
-    CHECK( !S.is_null() );
-    D.assign(*S);
-
-    if( !d_outscatter_correction )
-    {
-        // LU decomposition
-        d_lapack.GETRF(d_Ng, d_Ng, D.values(), D.stride(), &d_ipiv[0],
-                       &d_info);
-        CHECK(d_info == 0);
-
-        // inverse
-        d_lapack.GETRI(d_Ng, D.values(), D.stride(), &d_ipiv[0], &d_work[0],
-                       d_Ng, &d_info);
-        CHECK(d_info == 0);
-    }
-    else
-    {
-        Serial_Matrix sig(D);
-        D.putScalar(0.0);
-
-        // Apply outscatter correction
-        for( int ig=0; ig<d_Ng; ++ig )
-        {
-            for( int jg=0; jg<d_Ng; ++jg )
-            {
-                D(ig,ig) += sig(jg,ig);
-            }
-        }
 
-        // Invert diagonal entries
-        for( int ig=0; ig<d_Ng; ++ig )
-        {
-            D(ig,ig) = 1.0/D(ig,ig);
-        }
-    }
-
-    // multiply by the scalar coefficient to complete the diffusion matrix
-    // definition
-    D *= d_alpha[n];
+    D.assign(D_block(n, d_mat->matid(cell)));
 }
 
 //---------------------------------------------------------------------------//
@@ -419,7 +381,7 @@ void Moment_Coefficients::make_D(int            n,
 void Moment_Coefficients::make_A(int            n,
                                  int            m,
                                  int            cell,
-                                 Serial_Matrix &A)
+                                 Serial_Matrix &A) const
 {
     REQUIRE(!d_mat.is_null());
     REQUIRE(n >= 0 && n < d_dim->num_equations());
@@ -427,38 +389,8 @@ void Moment_Coefficients::make_A(int            n,
     REQUIRE(cell < d_mat->num_cells());
     REQUIRE(A.numRows() == A.numCols());
     REQUIRE(A.numRows() == d_Ng);
-    REQUIRE(d_mat->xs().num_groups() == d_Ng);
-
-    // initialize A to the first term in each series entry (Sigma_0)
-    int matid = d_mat->matid(cell);
-
-    CHECK( d_Sigma->exists(to_size_type(0,matid)) );
-    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(to_size_type(0,matid));
-    CHECK( !S.is_null() );
-    A.assign(*S);
 
-    A *= d_c[n][m][0];
-
-    // loop over all possible linear combinations for each element in the
-    // matrix
-    for (int k = 1; k < 4; ++k)
-    {
-        // only go to the effort for non-zero entries
-        if (std::fabs(d_c[n][m][k]) > 0.0)
-        {
-            // make sigma for this iterate in a work matrix
-            CHECK( d_Sigma->exists(to_size_type(d_a[k],matid)) );
-            S = d_Sigma->at(to_size_type(d_a[k],matid));
-            CHECK( !S.is_null() );
-            d_W = *S;
-
-            // multiply by the scalar coefficient
-            d_W *= d_c[n][m][k];
-
-            // add it to the running total
-            A += d_W;
-        }
-    }
+    A.assign(A_block(n, m, d_mat->matid(cell)));
 }
 
 //---------------------------------------------------------------------------//
@@ -509,7 +441,7 @@ void Moment_Coefficients::make_A(int            n,
  */
 void Moment_Coefficients::make_B(int            n,
                                  int            m,
-                                 Serial_Matrix &B)
+                                 Serial_Matrix &B) const
 {
     REQUIRE(n >= 0 && n < d_dim->num_equations());
     REQUIRE(m >= 0 && m < d_dim->num_equations());
@@ -524,6 +456,57 @@ void Moment_Coefficients::make_B(int            n,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get time-derivative diagonal block entries.
+ *
+ * For a backward-Euler step the \f$1/(v\Delta t)\f$ term is added to every
+ * \f$\boldsymbol{\Sigma}_n\f$ (see make_Sigma()), so the contribution of
+ * the time term to \f$\mathbf{A}_{nm}\f$ is the diagonal block
+ * \f[
+   \mathbf{T}_{nm} = \Bigl(\sum_k c_{nm}^k\Bigr)
+   \mathrm{diag}\Bigl(\frac{1}{v_g\Delta t}\Bigr)\:.
+ * \f]
+ * Applying \f$\mathbf{T}\f$ to the solution from the previous timestep
+ * gives the time-source on the right-hand side.
+ *
+ * \param n equation index
+ * \param m equation index
+ * \param T pre-allocated \f$N_g\times N_g\f$ matrix
+ *
+ * \pre the coefficients were built with a timestep
+ */
+void Moment_Coefficients::make_T(int            n,
+                                 int            m,
+                                 Serial_Matrix &T) const
+{
+    REQUIRE(!d_dt.is_null());
+    REQUIRE(n >= 0 && n < d_dim->num_equations());
+    REQUIRE(m >= 0 && m < d_dim->num_equations());
+    REQUIRE(T.numRows() == T.numCols());
+    REQUIRE(T.numRows() == d_Ng);
+
+    // get group velocities
+    const Serial_Vector &v = d_mat->xs().velocities();
+    CHECK(v.length() == d_Ng);
+
+    // sum of the moment coefficients for this block
+    double c = 0.0;
+    for (int k = 0; k < 4; ++k)
+    {
+        c += d_c[n][m][k];
+    }
+
+    double inv_dt = 1.0 / d_dt->dt();
+
+    T.putScalar(0.0);
+    for (int g = 0; g < d_Ng; ++g)
+    {
+        CHECK(v(g) > 0.0);
+        T(g, g) = c / v(g) * inv_dt;
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Get F fission matrix block entries.
@@ -575,7 +558,7 @@ void Moment_Coefficients::make_B(int            n,
 void Moment_Coefficients::make_F(int            n,
                                  int            m,
                                  int            cell,
-                                 Serial_Matrix &F)
+                                 Serial_Matrix &F) const
 {
     REQUIRE(!d_mat.is_null());
     REQUIRE(n >= 0 && n < d_dim->num_equations());
@@ -619,6 +602,170 @@ void Moment_Coefficients::make_F(int            n,
     }
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the diffusion matrix for a material.
+ *
+ * See make_D() for the definition.
+ */
+void Moment_Coefficients::compute_D(int            n,
+                                    int            matid,
+                                    Serial_Matrix &D)
+{
+    REQUIRE(n >= 0 && n < d_Ne);
+    REQUIRE(d_mat->xs().has(matid));
+    REQUIRE(D.numRows() == D.numCols());
+    REQUIRE(D.numRows() == d_Ng);
+
+    // first get sigma for this diffusion coefficient
+    CHECK( d_Sigma->exists(to_size_type(d_d[n],matid)) );
+    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(to_size_type(d_d[n],matid));
+    CHECK( !S.is_null() );
+    D.assign(*S);
+
+    if( !d_outscatter_correction )
+    {
+        // LU decomposition
+        d_lapack.GETRF(d_Ng, d_Ng, D.values(), D.stride(), &d_ipiv[0],
+                       &d_info);
+        CHECK(d_info == 0);
+
+        // inverse
+        d_lapack.GETRI(d_Ng, D.values(), D.stride(), &d_ipiv[0], &d_work[0],
+                       d_Ng, &d_info);
+        CHECK(d_info == 0);
+    }
+    else
+    {
+        Serial_Matrix sig(D);
+        D.putScalar(0.0);
+
+        // Apply outscatter correction
+        for( int ig=0; ig<d_Ng; ++ig )
+        {
+            for( int jg=0; jg<d_Ng; ++jg )
+            {
+                D(ig,ig) += sig(jg,ig);
+            }
+        }
+
+        // Invert diagonal entries
+        for( int ig=0; ig<d_Ng; ++ig )
+        {
+            D(ig,ig) = 1.0/D(ig,ig);
+        }
+    }
+
+    // multiply by the scalar coefficient to complete the diffusion matrix
+    // definition
+    D *= d_alpha[n];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute A-matrix block entries for a material.
+ *
+ * See make_A() for the definition.
+ */
+void Moment_Coefficients::compute_A(int            n,
+                                    int            m,
+                                    int            matid,
+                                    Serial_Matrix &A)
+{
+    REQUIRE(n >= 0 && n < d_Ne);
+    REQUIRE(m >= 0 && m < d_Ne);
+    REQUIRE(d_mat->xs().has(matid));
+    REQUIRE(A.numRows() == A.numCols());
+    REQUIRE(A.numRows() == d_Ng);
+
+    // initialize A to the first term in each series entry (Sigma_0)
+    CHECK( d_Sigma->exists(to_size_type(0,matid)) );
+    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(to_size_type(0,matid));
+    CHECK( !S.is_null() );
+    A.assign(*S);
+
+    A *= d_c[n][m][0];
+
+    // loop over all possible linear combinations for each element in the
+    // matrix
+    for (int k = 1; k < 4; ++k)
+    {
+        // only go to the effort for non-zero entries
+        if (std::fabs(d_c[n][m][k]) > 0.0)
+        {
+            // make sigma for this iterate in a work matrix
+            CHECK( d_Sigma->exists(to_size_type(d_a[k],matid)) );
+            S = d_Sigma->at(to_size_type(d_a[k],matid));
+            CHECK( !S.is_null() );
+            d_W = *S;
+
+            // multiply by the scalar coefficient
+            d_W *= d_c[n][m][k];
+
+            // add it to the running total
+            A += d_W;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the cached D and A blocks for every material.
+ */
+void Moment_Coefficients::build_cache()
+{
+    REQUIRE(d_Ne > 0 && d_Ne <= 4);
+
+    // index the materials
+    Vec_Int mats;
+    d_mat->xs().get_matids(mats);
+    int Nm = mats.size();
+    for (int l = 0; l < Nm; ++l)
+    {
+        d_mat_index.insert(Mat_Index::value_type(mats[l], l));
+    }
+    d_mat_index.complete();
+    CHECK(d_mat_index.size() == Nm);
+
+    // allocate the blocks
+    int N2 = d_Ng * d_Ng;
+    d_D_cache.resize(Nm * d_Ne * N2);
+    d_A_cache.resize(Nm * d_Na * N2);
+
+    // make the views
+    d_D_views.clear();
+    d_D_views.reserve(Nm * d_Ne);
+    for (int b = 0; b < Nm * d_Ne; ++b)
+    {
+        d_D_views.emplace_back(
+            Teuchos::View, &d_D_cache[b * N2], d_Ng, d_Ng, d_Ng);
+    }
+
+    d_A_views.clear();
+    d_A_views.reserve(Nm * d_Na);
+    for (int b = 0; b < Nm * d_Na; ++b)
+    {
+        d_A_views.emplace_back(
+            Teuchos::View, &d_A_cache[b * N2], d_Ng, d_Ng, d_Ng);
+    }
+
+    // compute the blocks for each material
+    for (int l = 0; l < Nm; ++l)
+    {
+        for (int n = 0; n < d_Ne; ++n)
+        {
+            compute_D(n, mats[l], d_D_views[l * d_Ne + n]);
+
+            for (int m = n; m < d_Ne; ++m)
+            {
+                compute_A(n, m, mats[l], d_A_views[l * d_Na + a_index(n, m)]);
+            }
+        }
+    }
+}
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
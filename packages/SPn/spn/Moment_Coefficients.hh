@@ -11,6 +11,7 @@
 #ifndef SPn_spn_Moment_Coefficients_hh
 #define SPn_spn_Moment_Coefficients_hh
 
+#include <algorithm>
 #include <vector>
 
 #include <SPn/config.h>
@@ -19,6 +20,7 @@
 #include "Teuchos_LAPACK.hpp"
 #include "Teuchos_ParameterList.hpp"
 
+#include "harness/DBC.hh"
 #include "utils/Definitions.hh"
 #include "utils/Vector_Lite.hh"
 #include "utils/Static_Map.hh"
@@ -34,6 +36,16 @@ namespace profugus
 /*!
  * \class Moment_Coefficients
  * \brief Coefficients used to couple moments in the SPN equations.
+ *
+ * The diffusion (\f$\mathbf{D}_n\f$) and A-matrix (\f$\mathbf{A}_{nm}\f$)
+ * blocks depend only on the material, so they are computed once for each
+ * material in the database at construction and stored contiguously.
+ * D_block() and A_block() return views of the cached blocks; make_D() and
+ * make_A() copy them for a given cell.  Because \f$\mathbf{A}\f$ is
+ * symmetric in \f$(n,m)\f$ only the upper triangle of blocks is stored.
+ *
+ * The cache is built with the timestep (if any) given at construction, so a
+ * new Moment_Coefficients must be built if the timestep size changes.
  */
 /*!
  * \example spn/test/tstMoment_Coefficients.cc
@@ -82,16 +94,19 @@ class Moment_Coefficients
     void make_Sigma(int n, int matid, Serial_Matrix &S);
 
     // Make diffusion matrices.
-    void make_D(int n, int cell, Serial_Matrix &D);
+    void make_D(int n, int cell, Serial_Matrix &D) const;
 
     // Make A-matrix block entries.
-    void make_A(int n, int m, int cell, Serial_Matrix &A);
+    void make_A(int n, int m, int cell, Serial_Matrix &A) const;
 
     // Get B-matrix diagonal block entries.
-    void make_B(int n, int m, Serial_Matrix &B);
+    void make_B(int n, int m, Serial_Matrix &B) const;
+
+    // Get time-derivative (1/v dt) diagonal block entries.
+    void make_T(int n, int m, Serial_Matrix &T) const;
 
     // Get F fission matrix block entries.
-    void make_F(int n, int m, int cell, Serial_Matrix &F);
+    void make_F(int n, int m, int cell, Serial_Matrix &F) const;
 
     // >>> ACCESSORS
 
@@ -104,6 +119,12 @@ class Moment_Coefficients
     //! Minimum number of moments in cross section data across all materials.
     int min_scattering_moments() const { return d_min_moments; }
 
+    // Cached diffusion matrix for a material.
+    inline const Serial_Matrix& D_block(int n, int matid) const;
+
+    // Cached A-matrix block for a material.
+    inline const Serial_Matrix& A_block(int n, int m, int matid) const;
+
     // >>> STATIC METHODS
 
     // Convert u->phi.
@@ -121,6 +142,26 @@ class Moment_Coefficients
     typedef Vector_Lite<double, 4> Coefficients;
     typedef XS_t::Vector           Vector;
     typedef XS_t::Matrix           Matrix;
+    typedef Static_Map<int, int>   Mat_Index;
+
+    // >>> IMPLEMENTATION
+
+    // Compute diffusion matrices.
+    void compute_D(int n, int matid, Serial_Matrix &D);
+
+    // Compute A-matrix block entries.
+    void compute_A(int n, int m, int matid, Serial_Matrix &A);
+
+    // Build the cached D and A blocks for every material.
+    void build_cache();
+
+    // Index of the (n,m) block in the upper triangle of A.
+    int a_index(int n, int m) const
+    {
+        if (n > m)
+            std::swap(n, m);
+        return n * d_Ne - n * (n - 1) / 2 + (m - n);
+    }
 
     // >>> DATA
 
@@ -157,6 +198,19 @@ class Moment_Coefficients
     // Flag to turn on Pn outscatter correction
     bool d_outscatter_correction;
 
+    // Number of equations and of stored A blocks per material.
+    int d_Ne, d_Na;
+
+    // Index of each material in the cache.
+    Mat_Index d_mat_index;
+
+    // Cached D blocks [mat][n] and A blocks [mat][a_index(n,m)], and views
+    // into them.
+    Vec_Dbl                    d_D_cache;
+    Vec_Dbl                    d_A_cache;
+    std::vector<Serial_Matrix> d_D_views;
+    std::vector<Serial_Matrix> d_A_views;
+
     // LAPACK object.
     Teuchos::LAPACK<int, double> d_lapack;
 
@@ -168,6 +222,12 @@ class Moment_Coefficients
 
 } // end namespace profugus
 
+//---------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+#include "Moment_Coefficients.i.hh"
+
 #endif // SPn_spn_Moment_Coefficients_hh
 
 //---------------------------------------------------------------------------//
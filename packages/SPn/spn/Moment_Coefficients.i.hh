@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Moment_Coefficients.i.hh
+ * \author agent
+ * \date   Mon Oct 19 03:04:35 2026
+ * \brief  Member definitions of class Moment_Coefficients.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Moment_Coefficients_i_hh
+#define SPn_spn_Moment_Coefficients_i_hh
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Cached diffusion matrix \f$\mathbf{D}_n\f$ for a material.
+ *
+ * \param n equation-order in range [0,4)
+ * \param matid material id
+ */
+const Moment_Coefficients::Serial_Matrix&
+Moment_Coefficients::D_block(int n,
+                             int matid) const
+{
+    REQUIRE(n >= 0 && n < d_Ne);
+    REQUIRE(d_mat_index.exists(matid));
+    return d_D_views[d_mat_index[matid] * d_Ne + n];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Cached A-matrix block \f$\mathbf{A}_{nm}\f$ for a material.
+ *
+ * \param n row of A-matrix in range [0,4)
+ * \param m column of A-matrix in range [0,4)
+ * \param matid material id
+ */
+const Moment_Coefficients::Serial_Matrix&
+Moment_Coefficients::A_block(int n,
+                             int m,
+                             int matid) const
+{
+    REQUIRE(n >= 0 && n < d_Ne);
+    REQUIRE(m >= 0 && m < d_Ne);
+    REQUIRE(d_mat_index.exists(matid));
+    return d_A_views[d_mat_index[matid] * d_Na + a_index(n, m)];
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_Moment_Coefficients_i_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Moment_Coefficients.i.hh
+//---------------------------------------------------------------------------//
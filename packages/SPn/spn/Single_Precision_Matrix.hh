@@ -0,0 +1,156 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Single_Precision_Matrix.hh
+ * \author agent
+ * \date   Mon Oct 19 03:28:18 2026
+ * \brief  Single_Precision_Matrix class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Single_Precision_Matrix_hh
+#define SPn_spn_Single_Precision_Matrix_hh
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "AnasaziMultiVecTraits.hpp"
+
+#include "harness/DBC.hh"
+#include "utils/Definitions.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "ImportTraits.hh"
+#include "OperatorAdapter.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Single_Precision_Matrix
+ * \brief Single-precision copy of an assembled (point) matrix.
+ *
+ * The values of a filled Epetra/Tpetra CRS matrix are copied into
+ * single-precision (\c float) compressed-row storage.  The operator is
+ * applied to double-precision vectors and accumulates in double precision;
+ * only the stored matrix is rounded.  With 32-bit column indices an apply
+ * streams 8 bytes per stored entry instead of the 12 of the
+ * double-precision matrix, so a bandwidth-bound apply is about a third
+ * cheaper.  The source matrix is not referenced after construction.
+ *
+ * This is intended for operators inside approximate solves (smoothers and
+ * preconditioners) whose error is corrected by an outer double-precision
+ * iteration.
+ */
+/*!
+ * \example spn/test/tstSingle_Precision_Matrix.cc
+ *
+ * Test of Single_Precision_Matrix.
+ */
+//===========================================================================//
+
+template <class T>
+class Single_Precision_Matrix : public OperatorAdapter<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                     MV;
+    typedef typename T::MAP                    MAP;
+    typedef typename T::MATRIX                 Matrix_t;
+    typedef Anasazi::MultiVecTraits<double,MV> MVT;
+    typedef ImportTraits<T>                    Import_Traits;
+    typedef typename Import_Traits::Import_t   Import_t;
+    typedef def::Vec_Int                       Vec_Int;
+    typedef std::vector<float>                 Vec_Flt;
+    //@}
+
+  public:
+    // Constructor.
+    Single_Precision_Matrix(Teuchos::RCP<const MAP>      map,
+                            Teuchos::RCP<const Matrix_t> A);
+
+    //! Map of the matrix rows (and of the domain and range).
+    Teuchos::RCP<const MAP> get_Map() const { return this->d_domain_map; }
+
+    //! Local number of stored entries.
+    int num_entries() const { return d_values.size(); }
+
+    // Extract the (column-major) diagonal blocks of a block size.
+    void diagonal_blocks(int block_size, Vec_Flt &blocks) const;
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Apply the matrix.
+    void ApplyImpl(const MV &x, MV &y) const;
+
+    // >>> DATA
+
+    // Local number of rows.
+    int d_N;
+
+    // Compressed-row storage.
+    Vec_Int d_row_ptr;
+    Vec_Int d_cols;
+    Vec_Flt d_values;
+
+    // Column map and import of off-processor values.
+    Teuchos::RCP<const MAP> d_col_map;
+    Teuchos::RCP<Import_t>  d_import;
+
+    // Column-map copy of x.
+    mutable Teuchos::RCP<MV> d_x_col;
+};
+
+//===========================================================================//
+/*!
+ * \class Single_Precision_Block_Jacobi
+ * \brief Single-precision block-Jacobi preconditioner built from the
+ * diagonal blocks of a Single_Precision_Matrix.
+ *
+ * The diagonal blocks are LU-factored in single precision at construction;
+ * each application solves the block-diagonal system in single precision and
+ * returns the result in the double-precision vector.  Together with a
+ * Single_Precision_Matrix this gives a smoother that references no
+ * double-precision matrix.
+ */
+//===========================================================================//
+
+template <class T>
+class Single_Precision_Block_Jacobi : public OperatorAdapter<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                     MV;
+    typedef Anasazi::MultiVecTraits<double,MV> MVT;
+    typedef Single_Precision_Matrix<T>         Matrix_t;
+    typedef def::Vec_Int                       Vec_Int;
+    typedef std::vector<float>                 Vec_Flt;
+    //@}
+
+  public:
+    // Constructor.
+    Single_Precision_Block_Jacobi(Teuchos::RCP<const Matrix_t> A,
+                                  int                          block_size);
+
+  private:
+    // Apply the inverse of the block diagonal.
+    void ApplyImpl(const MV &x, MV &y) const;
+
+    // Block size and local number of block rows.
+    int d_bs, d_Nr;
+
+    // LU factors and pivots of the diagonal blocks.
+    Vec_Flt d_lu;
+    Vec_Int d_ipiv;
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_Single_Precision_Matrix_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Single_Precision_Matrix.hh
+//---------------------------------------------------------------------------//
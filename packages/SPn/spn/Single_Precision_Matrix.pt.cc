@@ -0,0 +1,31 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Single_Precision_Matrix.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:28:18 2026
+ * \brief  Single_Precision_Matrix and Single_Precision_Block_Jacobi explicit
+ *         instantiation.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Single_Precision_Matrix.t.hh"
+#include "solvers/LinAlgTypedefs.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+namespace profugus
+{
+
+template class Single_Precision_Matrix<EpetraTypes>;
+template class Single_Precision_Matrix<TpetraTypes>;
+template class Single_Precision_Block_Jacobi<EpetraTypes>;
+template class Single_Precision_Block_Jacobi<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Single_Precision_Matrix.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,287 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Single_Precision_Matrix.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:28:18 2026
+ * \brief  Single_Precision_Matrix and Single_Precision_Block_Jacobi template
+ *         member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Single_Precision_Matrix_t_hh
+#define SPn_spn_Single_Precision_Matrix_t_hh
+
+#include <algorithm>
+#include <map>
+
+#include "Teuchos_ArrayView.hpp"
+#include "Teuchos_LAPACK.hpp"
+
+#include "Single_Precision_Matrix.hh"
+#include "MatrixTraits.hh"
+#include "VectorTraits.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param map map of the matrix rows (and of the domain and range)
+ * \param A filled (locally-indexed) matrix
+ */
+template <class T>
+Single_Precision_Matrix<T>::Single_Precision_Matrix(
+    Teuchos::RCP<const MAP>      map,
+    Teuchos::RCP<const Matrix_t> A)
+    : OperatorAdapter<T>(map)
+    , d_N(VectorTraits<T>::local_size(map))
+    , d_row_ptr(d_N + 1, 0)
+{
+    REQUIRE(!A.is_null());
+    REQUIRE(MatrixTraits<T>::local_rows(A) == d_N);
+
+    typedef MatrixTraits<T> MT;
+
+    Teuchos::ArrayView<const int>    inds;
+    Teuchos::ArrayView<const double> vals;
+
+    // count the entries and find the off-processor columns
+    std::map<int, int> ghosts;
+    for (int row = 0; row < d_N; ++row)
+    {
+        MT::get_local_row_view(A, row, inds, vals);
+        d_row_ptr[row + 1] = d_row_ptr[row] + inds.size();
+
+        for (int n = 0; n < inds.size(); ++n)
+        {
+            int col = MT::global_col_id(A, inds[n]);
+            if (Import_Traits::local_index(*map, col) < 0)
+                ghosts.insert(std::make_pair(col, 0));
+        }
+    }
+
+    // build the column map; the local rows come first followed by the
+    // off-processor columns in ascending global order
+    Vec_Int globals(d_N + ghosts.size());
+    for (int i = 0; i < d_N; ++i)
+    {
+        globals[i] = Import_Traits::global_index(*map, i);
+    }
+    int local = d_N;
+    for (auto &ghost : ghosts)
+    {
+        ghost.second   = local;
+        globals[local] = ghost.first;
+        ++local;
+    }
+    d_col_map = Import_Traits::build_map(*map, globals);
+    d_import  = Import_Traits::build_import(map, d_col_map);
+
+    // copy the matrix in single precision
+    d_cols.resize(d_row_ptr.back());
+    d_values.resize(d_row_ptr.back());
+    for (int row = 0; row < d_N; ++row)
+    {
+        MT::get_local_row_view(A, row, inds, vals);
+
+        for (int n = 0, k = d_row_ptr[row]; n < inds.size(); ++n, ++k)
+        {
+            int col = MT::global_col_id(A, inds[n]);
+            int lid = Import_Traits::local_index(*map, col);
+
+            d_cols[k]   = lid >= 0 ? lid : ghosts[col];
+            d_values[k] = static_cast<float>(vals[n]);
+        }
+    }
+
+    ENSURE(d_cols.size() == d_values.size());
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Extract the diagonal blocks of a block size.
+ *
+ * The local rows are split into consecutive blocks of \a block_size rows;
+ * block \e r is stored column-major at
+ * <tt>blocks[r * block_size * block_size]</tt>.  Entries of the block that
+ * are not stored are zero.
+ */
+template <class T>
+void Single_Precision_Matrix<T>::diagonal_blocks(int      block_size,
+                                                 Vec_Flt &blocks) const
+{
+    REQUIRE(block_size > 0);
+    REQUIRE(d_N % block_size == 0);
+
+    const int bs2 = block_size * block_size;
+    blocks.assign(static_cast<std::size_t>(d_N) * block_size, 0.0f);
+
+#pragma omp parallel for schedule(static)
+    for (int row = 0; row < d_N; ++row)
+    {
+        int r = row / block_size;
+        int i = row % block_size;
+
+        float *block = &blocks[static_cast<std::size_t>(r) * bs2];
+        for (int k = d_row_ptr[row]; k < d_row_ptr[row + 1]; ++k)
+        {
+            // the first d_N local columns are the local rows
+            int col = d_cols[k];
+            if (col < d_N && col / block_size == r)
+                block[i + block_size * (col % block_size)] = d_values[k];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the matrix, \f$\mathbf{y} = \mathbf{A}\mathbf{x}\f$.
+ */
+template <class T>
+void Single_Precision_Matrix<T>::ApplyImpl(const MV &x,
+                                                 MV &y) const
+{
+    int num_vectors = MVT::GetNumberVecs(x);
+    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+
+    // import the off-processor values of x
+    if (d_x_col.is_null() || MVT::GetNumberVecs(*d_x_col) != num_vectors)
+    {
+        d_x_col = VectorTraits<T>::build_vector(d_col_map, num_vectors);
+    }
+    Import_Traits::do_import(*d_import, x, *d_x_col);
+
+    for (int ivec = 0; ivec < num_vectors; ++ivec)
+    {
+        Teuchos::ArrayRCP<const double> x_data =
+            VectorTraits<T>::get_data(d_x_col, ivec);
+        Teuchos::ArrayRCP<double> y_data =
+            VectorTraits<T>::get_data_nonconst(Teuchos::rcpFromRef(y), ivec);
+        CHECK(y_data.size() == d_N);
+
+        const double *xp = x_data.getRawPtr();
+        double       *yp = y_data.getRawPtr();
+
+#pragma omp parallel for schedule(static)
+        for (int row = 0; row < d_N; ++row)
+        {
+            double sum = 0.0;
+            for (int k = d_row_ptr[row]; k < d_row_ptr[row + 1]; ++k)
+            {
+                sum += static_cast<double>(d_values[k]) * xp[d_cols[k]];
+            }
+            yp[row] = sum;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// SINGLE_PRECISION_BLOCK_JACOBI
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param A single-precision matrix
+ * \param block_size number of consecutive local rows in a diagonal block
+ */
+template <class T>
+Single_Precision_Block_Jacobi<T>::Single_Precision_Block_Jacobi(
+    Teuchos::RCP<const Matrix_t> A,
+    int                          block_size)
+    : OperatorAdapter<T>(A->get_Map())
+    , d_bs(block_size)
+    , d_Nr(VectorTraits<T>::local_size(A->get_Map()) / block_size)
+    , d_ipiv(d_Nr * d_bs, 0)
+{
+    REQUIRE(d_bs > 0);
+
+    A->diagonal_blocks(d_bs, d_lu);
+    CHECK(d_lu.size() == static_cast<std::size_t>(d_Nr) * d_bs * d_bs);
+
+    const int bs2 = d_bs * d_bs;
+
+    // number of singular diagonal blocks
+    int failed = 0;
+
+    // factor the diagonal blocks
+#pragma omp parallel reduction(+:failed)
+    {
+        Teuchos::LAPACK<int, float> lapack;
+        int info = 0;
+
+#pragma omp for schedule(static)
+        for (int r = 0; r < d_Nr; ++r)
+        {
+            lapack.GETRF(d_bs, d_bs, &d_lu[static_cast<std::size_t>(r) * bs2],
+                         d_bs, &d_ipiv[r * d_bs], &info);
+            if (info != 0)
+                ++failed;
+        }
+    }
+
+    INSIST(failed == 0, failed << " diagonal blocks are singular.");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the inverse of the block diagonal.
+ */
+template <class T>
+void Single_Precision_Block_Jacobi<T>::ApplyImpl(const MV &x,
+                                                       MV &y) const
+{
+    int num_vectors = MVT::GetNumberVecs(x);
+    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+
+    const int bs2 = d_bs * d_bs;
+
+    for (int ivec = 0; ivec < num_vectors; ++ivec)
+    {
+        Teuchos::ArrayRCP<const double> x_data =
+            VectorTraits<T>::get_data(Teuchos::rcpFromRef(x), ivec);
+        Teuchos::ArrayRCP<double> y_data =
+            VectorTraits<T>::get_data_nonconst(Teuchos::rcpFromRef(y), ivec);
+        CHECK(x_data.size() == d_Nr * d_bs);
+        CHECK(y_data.size() == d_Nr * d_bs);
+
+        const double *xp = x_data.getRawPtr();
+        double       *yp = y_data.getRawPtr();
+
+#pragma omp parallel
+        {
+            Teuchos::LAPACK<int, float> lapack;
+            int info = 0;
+
+            // single-precision right-hand side of a block
+            Vec_Flt b(d_bs);
+
+#pragma omp for schedule(static)
+            for (int r = 0; r < d_Nr; ++r)
+            {
+                std::copy(xp + r * d_bs, xp + (r + 1) * d_bs, b.begin());
+                lapack.GETRS('N', d_bs, 1,
+                             &d_lu[static_cast<std::size_t>(r) * bs2], d_bs,
+                             &d_ipiv[r * d_bs], &b[0], d_bs, &info);
+                CHECK(info == 0);
+                std::copy(b.begin(), b.end(), yp + r * d_bs);
+            }
+        }
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_Single_Precision_Matrix_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Single_Precision_Matrix.t.hh
+//---------------------------------------------------------------------------//
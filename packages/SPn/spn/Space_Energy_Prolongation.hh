@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Space_Energy_Prolongation.hh
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Space_Energy_Prolongation class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Space_Energy_Prolongation_hh
+#define SPn_spn_Space_Energy_Prolongation_hh
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "solvers/LinAlgTypedefs.hh"
+#include "OperatorAdapter.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Space_Energy_Prolongation
+ * \brief Prolong SPN vectors in space and energy.
+ *
+ * This is the piecewise-constant interpolation matching
+ * Space_Energy_Restriction: every fine unknown takes the value of the coarse
+ * group and coarse spatial unknown that contain it.
+ */
+/*!
+ * \example spn/test/tstSpace_Energy_Prolongation.cc
+ *
+ * Test of Space_Energy_Prolongation.
+ */
+//===========================================================================//
+
+template <class T>
+class Space_Energy_Prolongation : public OperatorAdapter<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::OP                     OP;
+    typedef typename T::MV                     MV;
+    typedef typename T::MAP                    MAP;
+    typedef Anasazi::MultiVecTraits<double,MV> MVT;
+    //@}
+
+    Space_Energy_Prolongation( Teuchos::RCP<const MAP>  coarse_map,
+                               Teuchos::RCP<const MAP>  fine_map,
+                               const std::vector<int>  &spatial_map,
+                               const std::vector<int>  &steer_vec );
+
+  private:
+
+    void ApplyImpl( const MV &x, MV &y) const;
+
+    std::vector<int> d_spatial_map;
+    std::vector<int> d_steer_vec;
+
+    int d_num_eqns;
+    int d_fine_groups;
+    int d_coarse_groups;
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_Space_Energy_Prolongation_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Space_Energy_Prolongation.hh
+//---------------------------------------------------------------------------//
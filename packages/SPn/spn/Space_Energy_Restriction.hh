@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Space_Energy_Restriction.hh
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Space_Energy_Restriction class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Space_Energy_Restriction_hh
+#define SPn_spn_Space_Energy_Restriction_hh
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "solvers/LinAlgTypedefs.hh"
+#include "OperatorAdapter.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Space_Energy_Restriction
+ * \brief Restrict SPN vectors in space and energy.
+ *
+ * Each fine spatial unknown (cell or boundary face) maps to a coarse spatial
+ * unknown, and fine groups are collapsed as in Energy_Restriction.  The
+ * coarse value is the weighted sum over the fine spatial unknowns of the
+ * group-averaged fine values.  The weights of the fine unknowns in a coarse
+ * unknown should sum to one (volume fractions for cells, area fractions for
+ * faces), so that the restriction averages in space.  It is assumed that
+ * energy is the innermost variable and then the moment equations.
+ */
+/*!
+ * \example spn/test/tstSpace_Energy_Restriction.cc
+ *
+ * Test of Space_Energy_Restriction.
+ */
+//===========================================================================//
+
+template <class T>
+class Space_Energy_Restriction : public OperatorAdapter<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::OP                     OP;
+    typedef typename T::MV                     MV;
+    typedef typename T::MAP                    MAP;
+    typedef Anasazi::MultiVecTraits<double,MV> MVT;
+    //@}
+
+    Space_Energy_Restriction( Teuchos::RCP<const MAP>     fine_map,
+                              Teuchos::RCP<const MAP>     coarse_map,
+                              const std::vector<int>     &spatial_map,
+                              const std::vector<double>  &weights,
+                              const std::vector<int>     &steer_vec );
+
+  private:
+
+    void ApplyImpl( const MV &x, MV &y) const;
+
+    std::vector<int>    d_spatial_map;
+    std::vector<double> d_weights;
+    std::vector<int>    d_steer_vec;
+
+    int d_num_eqns;
+    int d_fine_groups;
+    int d_coarse_groups;
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_Space_Energy_Restriction_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Space_Energy_Restriction.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,28 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Space_Energy_Restriction.pt.cc
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Space_Energy_Restriction explicit instantiation.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Space_Energy_Restriction.t.hh"
+#include "solvers/LinAlgTypedefs.hh"
+
+#include "AnasaziMultiVecTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+namespace profugus
+{
+
+template class Space_Energy_Restriction<EpetraTypes>;
+template class Space_Energy_Restriction<TpetraTypes>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Space_Energy_Restriction.pt.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/Space_Energy_Restriction.t.hh
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Space_Energy_Restriction template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_Space_Energy_Restriction_t_hh
+#define SPn_spn_Space_Energy_Restriction_t_hh
+
+#include <algorithm>
+#include <numeric>
+
+#include "harness/DBC.hh"
+#include "Space_Energy_Restriction.hh"
+#include "VectorTraits.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param fine_map map of the fine vectors
+ * \param coarse_map map of the coarse vectors
+ * \param spatial_map coarse spatial unknown of each fine spatial unknown
+ * \param weights weight of each fine spatial unknown
+ * \param steer_vec number of fine groups in each coarse group
+ */
+template <class T>
+Space_Energy_Restriction<T>::Space_Energy_Restriction(
+        Teuchos::RCP<const MAP>     fine_map,
+        Teuchos::RCP<const MAP>     coarse_map,
+        const std::vector<int>     &spatial_map,
+        const std::vector<double>  &weights,
+        const std::vector<int>     &steer_vec )
+    : OperatorAdapter<T>(fine_map,coarse_map)
+    , d_spatial_map(spatial_map)
+    , d_weights(weights)
+    , d_steer_vec(steer_vec)
+{
+    REQUIRE( spatial_map.size() == weights.size() );
+    REQUIRE( !spatial_map.empty() );
+
+    d_fine_groups = std::accumulate(steer_vec.begin(),steer_vec.end(),0);
+    d_coarse_groups = steer_vec.size();
+    CHECK( d_fine_groups >= d_coarse_groups );
+
+    // Determine number of equations
+    int Ns = d_spatial_map.size();
+    CHECK( VectorTraits<T>::local_size(fine_map)%(Ns*d_fine_groups)==0 );
+    d_num_eqns = VectorTraits<T>::local_size(fine_map) / (Ns*d_fine_groups);
+    CHECK( VectorTraits<T>::local_size(coarse_map) ==
+           d_num_eqns*d_coarse_groups*
+           (1 + *std::max_element(spatial_map.begin(),spatial_map.end())) );
+}
+
+//---------------------------------------------------------------------------//
+// RESTRICTION OPERATOR
+//---------------------------------------------------------------------------//
+
+template <class T>
+void Space_Energy_Restriction<T>::ApplyImpl( const MV &fine_vectors,
+                                                   MV &coarse_vectors ) const
+{
+    REQUIRE( VectorTraits<T>::local_length(Teuchos::rcpFromRef(fine_vectors))
+             == d_spatial_map.size()*d_num_eqns*d_fine_groups );
+
+    int num_vectors = MVT::GetNumberVecs(fine_vectors);
+    CHECK( MVT::GetNumberVecs(coarse_vectors) ==num_vectors );
+
+    MVT::MvInit(coarse_vectors,0.0);
+
+    // Process each vector in multivector
+    int coarse_offset, fine_offset;
+    for( int ivec=0; ivec<num_vectors; ++ivec )
+    {
+        Teuchos::ArrayRCP<const double> fine_data =
+            VectorTraits<T>::get_data(Teuchos::rcpFromRef(fine_vectors),ivec);
+        Teuchos::ArrayRCP<double> coarse_data =
+            VectorTraits<T>::get_data_nonconst(
+                Teuchos::rcpFromRef(coarse_vectors),ivec);
+
+        // Apply restriction to each spatial unknown and equation
+        for( int s=0; s<d_spatial_map.size(); ++s )
+        {
+            double w = d_weights[s];
+
+            for( int n=0; n<d_num_eqns; ++n )
+            {
+                coarse_offset =
+                    (n + d_num_eqns*d_spatial_map[s])*d_coarse_groups;
+                fine_offset   = (n + d_num_eqns*s)*d_fine_groups;
+                int grp_ctr = 0;
+
+                for( int icg=0; icg<d_coarse_groups; ++icg )
+                {
+                    int fine_grps = d_steer_vec[icg];
+                    double sum = 0.0;
+                    for( int ifg=grp_ctr; ifg<grp_ctr+fine_grps; ++ifg )
+                    {
+                        sum += fine_data[fine_offset+ifg];
+                    }
+                    grp_ctr += fine_grps;
+                    coarse_data[coarse_offset+icg] +=
+                        w * sum / static_cast<double>(fine_grps);
+                }
+            }
+        }
+    }
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_Space_Energy_Restriction_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Space_Energy_Restriction.t.hh
+//---------------------------------------------------------------------------//
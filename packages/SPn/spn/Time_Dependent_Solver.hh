@@ -11,6 +11,8 @@
 #ifndef SPn_spn_Time_Dependent_Solver_hh
 #define SPn_spn_Time_Dependent_Solver_hh
 
+#include <functional>
+
 #include "comm/Timer.hh"
 #include "solvers/StratimikosSolver.hh"
 #include "solvers/LinAlgTypedefs.hh"
@@ -25,7 +27,50 @@ namespace profugus
  * \class Time_Dependent_Solver
  * \brief Solve a time-dependent SPN problem.
  *
- * This is just a stub for future time-dependent development.
+ * The SPN equations are advanced in time with backward-Euler.  Each step
+ * solves
+ * \f[
+   \mathbf{A}(\Delta t)\mathbf{u}^{n} = \mathbf{Q} +
+   \mathbf{T}(\Delta t)\mathbf{u}^{n-1}\:,
+ * \f]
+ * where \f$\mathbf{T}\f$ is the \f$1/(v\Delta t)\f$ part of
+ * \f$\mathbf{A}\f$.  Only the right-hand side is rebuilt when the timestep
+ * is unchanged; the operator and the solver's preconditioner are kept.  They
+ * are rebuilt only when \f$\Delta t\f$ changes.  The solution from the
+ * previous step is the initial guess for the next one.
+ *
+ * The following entries in the "timestep control" sublist are significant:
+ *  - "dt"         initial timestep (required)
+ *  - "num_steps"  number of steps taken by solve() (1)
+ *  - "final_time" if given, solve() advances to this time and "num_steps" is
+ *                 ignored; the last step is shortened to land on it
+ *  - "dt_control" "growth" or "error" ("growth")
+ *  - "dt_growth"  factor applied to \f$\Delta t\f$ after each step with
+ *                 "growth" control (1.0)
+ *  - "dt_max"     maximum timestep (huge)
+ *
+ * With "error" control the timestep is chosen from an estimate of the local
+ * truncation error.  The backward-Euler solution is compared against a
+ * linear extrapolation of the two previous solutions,
+ * \f[
+   \epsilon = \frac{\Delta t_n}{\Delta t_n + \Delta t_{n-1}}
+   \frac{\|\mathbf{u}^n - \mathbf{u}^n_p\|}{\|\mathbf{u}^n\|}\:,
+ * \f]
+ * and the next timestep is \f$0.9\Delta t_n\sqrt{\tau/\epsilon}\f$ (limited
+ * to [0.2, "dt_max_growth"] times \f$\Delta t_n\f$).  A step with
+ * \f$\epsilon > \tau\f$ is rejected and repeated with the smaller timestep.
+ * The first step has no history and is always accepted.  The error control
+ * entries are:
+ *  - "dt_tolerance"  relative error tolerance \f$\tau\f$ (1.0e-3)
+ *  - "dt_min"        minimum timestep; steps at this size are always
+ *                    accepted (1.0e-6 dt)
+ *  - "dt_max_growth" maximum growth factor between steps (2.0)
+ *
+ * A callback registered with set_step_callback() is called after every
+ * accepted step, so clients can write per-step output.
+ *
+ * The initial condition is \f$\mathbf{u}^0 = 0\f$.  Repeated calls to
+ * solve() (or step()) continue from the last solution.
  */
 /*!
  * \example spn/test/tstTime_Dependent_Solver.cc
@@ -54,6 +99,8 @@ class Time_Dependent_Solver : public Solver_Base_Tmpl<T>
     typedef typename Linear_System_t::RCP_Mesh          RCP_Mesh;
     typedef typename Linear_System_t::RCP_Indexer       RCP_Indexer;
     typedef typename Linear_System_t::RCP_Global_Data   RCP_Global_Data;
+    typedef std::function<void(const Time_Dependent_Solver<T> &)>
+                                                        Step_Callback;
     //@}
 
     using Base::b_db;
@@ -71,6 +118,45 @@ class Time_Dependent_Solver : public Solver_Base_Tmpl<T>
     // Timestep controller.
     RCP_Timestep d_dt;
 
+    // Timestep control parameters.
+    int    d_num_steps;
+    double d_final_time;
+    double d_growth;
+    double d_dt_max;
+
+    // Error-based timestep control parameters.
+    bool   d_error_control;
+    double d_tolerance;
+    double d_dt_min;
+    double d_max_growth;
+
+    // Solutions and timestep from the two previous steps (error control).
+    RCP_MV d_prev;
+    RCP_MV d_prev2;
+    double d_dt_prev;
+
+    // Next timestep, last error estimate, and number of rejected steps.
+    double d_dt_next;
+    double d_error;
+    int    d_rejected;
+
+    // Per-step callback.
+    Step_Callback d_callback;
+
+    // Current time and number of steps taken.
+    double d_time;
+    int    d_steps;
+
+    // Timestep that the current linear system was built with.
+    double d_system_dt;
+
+    // Problem objects used to (re)build the linear system.
+    RCP_Dimensions  d_dim;
+    RCP_Mat_DB      d_mat;
+    RCP_Mesh        d_mesh;
+    RCP_Indexer     d_indexer;
+    RCP_Global_Data d_data;
+
   public:
     // Constructor.
     explicit Time_Dependent_Solver(RCP_ParameterList db);
@@ -79,23 +165,56 @@ class Time_Dependent_Solver : public Solver_Base_Tmpl<T>
     void setup(RCP_Dimensions dim, RCP_Mat_DB mat, RCP_Mesh mesh,
                RCP_Indexer indexer, RCP_Global_Data data, bool adjoint = false);
 
-    // Solve the SPN equations.
+    // Advance the SPN equations through all timesteps.
     void solve(Teuchos::RCP<const External_Source> q);
 
+    // Take a single timestep.
+    void step(Teuchos::RCP<const External_Source> q);
+
     // Write the scalar-flux into the state.
     void write_state(State &state);
 
     // Write problem to file
     void write_problem_to_file() const;
 
+    //! Set a callback that is called after every accepted step.
+    void set_step_callback(Step_Callback callback) { d_callback = callback; }
+
     // >>> ACCESSORS
 
     //! Get LHS solution vector (in transformed \e u space).
     Teuchos::RCP<const MV> get_LHS() const { return d_lhs; }
 
+    //! Get the timestep controller.
+    RCP_Timestep timestep() const { return d_dt; }
+
+    //! Current problem time.
+    double time() const { return d_time; }
+
+    //! Number of steps taken.
+    int num_steps_taken() const { return d_steps; }
+
+    //! Number of steps rejected by the error control.
+    int num_steps_rejected() const { return d_rejected; }
+
+    //! Error estimate for the last step (0 without error control).
+    double error_estimate() const { return d_error; }
+
   private:
     // >>> IMPLEMENTATION
 
+    // Build the linear system for the current timestep.
+    void build_system();
+
+    // Solve for the current timestep.
+    void advance(const External_Source &q);
+
+    // Estimate the local truncation error of the current solution.
+    double estimate_error() const;
+
+    // Copy x into y.
+    static void copy(Teuchos::RCP<const MV> x, Teuchos::RCP<MV> y);
+
     // Timer.
     profugus::Timer d_timer;
 };
@@ -11,12 +11,15 @@
 #ifndef SPn_spn_Time_Dependent_Solver_t_hh
 #define SPn_spn_Time_Dependent_Solver_t_hh
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
 
 #include "harness/DBC.hh"
+#include "comm/global.hh"
 #include "utils/String_Functions.hh"
 #include "solvers/LinAlgTypedefs.hh"
 #include "Linear_System_FV.hh"
@@ -37,12 +40,18 @@ template <class T>
 Time_Dependent_Solver<T>::Time_Dependent_Solver(RCP_ParameterList db)
     : Base(db)
     , d_solver(b_db)
+    , d_time(0.0)
+    , d_steps(0)
+    , d_system_dt(0.0)
+    , d_dt_prev(0.0)
+    , d_dt_next(0.0)
+    , d_error(0.0)
+    , d_rejected(0)
 {
     REQUIRE(db->isSublist("timestep control"));
 
     // get the timestep control database
-    const auto &tdb =
-        db->template get<Teuchos::ParameterList>("timestep control");
+    auto &tdb = db->sublist("timestep control");
     CHECK(tdb.isParameter("dt"));
 
     // build the timestep object
@@ -51,6 +60,31 @@ Time_Dependent_Solver<T>::Time_Dependent_Solver(RCP_ParameterList db)
     // set the first timestep
     d_dt->set(tdb.template get<double>("dt"));
 
+    // get the stepping controls
+    d_num_steps  = tdb.get("num_steps", 1);
+    d_final_time = tdb.get("final_time", 0.0);
+    d_growth     = tdb.get("dt_growth", 1.0);
+    d_dt_max     = tdb.get("dt_max", constants::huge);
+
+    // get the error-based controls
+    std::string control = tdb.get("dt_control", std::string("growth"));
+    d_error_control = profugus::lower(control) == "error";
+    d_tolerance     = tdb.get("dt_tolerance", 1.0e-3);
+    d_dt_min        = tdb.get("dt_min", 1.0e-6 * d_dt->dt());
+    d_max_growth    = tdb.get("dt_max_growth", 2.0);
+
+    VALIDATE(d_error_control || profugus::lower(control) == "growth",
+             "Unknown dt_control " << control);
+    VALIDATE(d_num_steps > 0, "num_steps must be positive.");
+    VALIDATE(d_growth > 0.0, "dt_growth must be positive.");
+    VALIDATE(d_tolerance > 0.0, "dt_tolerance must be positive.");
+    VALIDATE(d_dt_min > 0.0 && d_dt_min <= d_dt->dt(),
+             "dt_min must be positive and no larger than dt.");
+    VALIDATE(d_max_growth >= 1.0, "dt_max_growth must be at least 1.");
+    VALIDATE(d_dt_max >= d_dt->dt(), "dt_max must be at least dt.");
+    VALIDATE(d_final_time == 0.0 || d_final_time >= d_dt->dt(),
+             "final_time must be at least dt.");
+
     ENSURE(!b_db.is_null());
     ENSURE(!d_dt.is_null());
     ENSURE(d_dt->dt() > 0.0);
@@ -63,7 +97,8 @@ Time_Dependent_Solver<T>::Time_Dependent_Solver(RCP_ParameterList db)
 /*!
  * \brief Setup the solver.
  *
- * Calls to this function builds the linear SPN system.
+ * Calls to this function builds the linear SPN system for the first timestep
+ * and sets the initial condition to zero.
  */
 template <class T>
 void Time_Dependent_Solver<T>::setup(RCP_Dimensions  dim,
@@ -82,6 +117,198 @@ void Time_Dependent_Solver<T>::setup(RCP_Dimensions  dim,
     REQUIRE(!d_dt.is_null());
     INSIST(!adjoint, "Adjoint not supported in time-dependent SPn.");
 
+    // store the problem objects so the system can be rebuilt when the
+    // timestep changes
+    d_dim     = dim;
+    d_mat     = mat;
+    d_mesh    = mesh;
+    d_indexer = indexer;
+    d_data    = data;
+
+    // build the linear system
+    build_system();
+
+    // allocate the left-hand side solution vector (initial condition)
+    d_lhs = VectorTraits<T>::build_vector(b_system->get_Map());
+    VectorTraits<T>::put_scalar(d_lhs, 0.0);
+
+    // allocate the solution history for error control
+    if (d_error_control)
+    {
+        d_prev  = VectorTraits<T>::build_vector(b_system->get_Map());
+        d_prev2 = VectorTraits<T>::build_vector(b_system->get_Map());
+    }
+
+    d_time     = 0.0;
+    d_steps    = 0;
+    d_rejected = 0;
+    d_error    = 0.0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance the SPN equations for a given external source.
+ *
+ * Takes "num_steps" steps, or steps until "final_time" if it is defined.
+ */
+template <class T>
+void Time_Dependent_Solver<T>::solve(Teuchos::RCP<const External_Source> q)
+{
+    REQUIRE(!q.is_null());
+    REQUIRE(!b_system.is_null());
+
+    if (d_final_time > 0.0)
+    {
+        // step until we reach the final time (to roundoff)
+        while (d_final_time - d_time > 1.0e-12 * d_final_time)
+        {
+            step(q);
+        }
+    }
+    else
+    {
+        for (int n = 0; n < d_num_steps; ++n)
+        {
+            step(q);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Take a single backward-Euler timestep.
+ *
+ * After the first step the timestep is grown by "dt_growth", or chosen from
+ * the error estimate of the previous step with "error" control, and limited
+ * by "dt_max" and the final time.  With error control a step whose estimate
+ * exceeds the tolerance is repeated with a smaller timestep.  The linear
+ * system, and with it the solver's preconditioner, is rebuilt only when the
+ * timestep changes.  The step callback is called once the step is accepted.
+ */
+template <class T>
+void Time_Dependent_Solver<T>::step(Teuchos::RCP<const External_Source> q)
+{
+    REQUIRE(!q.is_null());
+    REQUIRE(!b_system.is_null());
+    REQUIRE(!d_lhs.is_null());
+
+    // set the timestep for this step
+    if (d_steps > 0)
+    {
+        double dt = d_error_control ? d_dt_next : d_growth * d_dt->dt();
+        dt = std::min(dt, d_dt_max);
+        if (d_final_time > 0.0)
+        {
+            dt = std::min(dt, d_final_time - d_time);
+        }
+        d_dt->set(dt);
+    }
+
+    if (!d_error_control)
+    {
+        advance(*q);
+    }
+    else
+    {
+        REQUIRE(!d_prev.is_null());
+        REQUIRE(!d_prev2.is_null());
+
+        // shift the solution history; d_prev holds u^{n-1}
+        std::swap(d_prev, d_prev2);
+        copy(d_lhs, d_prev);
+
+        while (true)
+        {
+            double dt = d_dt->dt();
+
+            advance(*q);
+
+            // the first step has no history to estimate the error from
+            if (d_steps == 0)
+            {
+                d_error   = 0.0;
+                d_dt_next = dt;
+                break;
+            }
+
+            // estimate the error and the timestep that meets the tolerance
+            d_error = estimate_error();
+            double factor = 0.9 * std::sqrt(
+                d_tolerance / std::max(d_error, constants::tiny));
+            factor = std::max(std::min(factor, d_max_growth), 0.2);
+            double dt_new = std::max(factor * dt, d_dt_min);
+
+            if (d_error <= d_tolerance || dt <= d_dt_min)
+            {
+                d_dt_next = dt_new;
+                break;
+            }
+
+            // reject the step and retry from u^{n-1}
+            copy(d_prev, d_lhs);
+            d_dt->reset(dt_new);
+            ++d_rejected;
+        }
+
+        d_dt_prev = d_dt->dt();
+    }
+
+    d_time += d_dt->dt();
+    ++d_steps;
+
+    if (d_callback)
+    {
+        d_callback(*this);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write scalar flux into the state.
+ */
+template <class T>
+void Time_Dependent_Solver<T>::write_state(State &state)
+{
+    REQUIRE(state.mesh().num_cells() *
+             b_system->get_dims()->num_equations() * state.num_groups()
+             <= VectorTraits<T>::local_length(d_lhs) );
+
+    Base::write_u_into_state(d_lhs, state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write matrices to file
+ */
+template <class T>
+void Time_Dependent_Solver<T>::write_problem_to_file() const
+{
+    // Write A (LHS operator)
+    Teuchos::RCP<const typename T::MATRIX> matrix =
+        Teuchos::rcp_dynamic_cast<const typename T::MATRIX>(
+            b_system->get_Operator());
+    MatrixTraits<T>::write_matrix_file(matrix,"A.mtx");
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the linear system for the current timestep.
+ *
+ * The moment coefficients are cached with the timestep at construction, so
+ * the system is rebuilt for each new timestep size.  Registering the new
+ * operator with the solver also rebuilds its preconditioner.
+ */
+template <class T>
+void Time_Dependent_Solver<T>::build_system()
+{
+    REQUIRE(!d_dim.is_null());
+    REQUIRE(!d_mat.is_null());
+    REQUIRE(!d_mesh.is_null());
+    REQUIRE(!d_indexer.is_null());
+    REQUIRE(!d_data.is_null());
+
     // build the linear system (we only provide finite volume for now)
     std::string &eqn_type =
         b_db->template get<std::string>("eqn_type", std::string("fv"));
@@ -90,7 +317,7 @@ void Time_Dependent_Solver<T>::setup(RCP_Dimensions  dim,
     {
         b_system = Teuchos::rcp(
             new Linear_System_FV<T>(
-                b_db, dim, mat, mesh, indexer, data, d_dt));
+                b_db, d_dim, d_mat, d_mesh, d_indexer, d_data, d_dt));
     }
     else
     {
@@ -105,59 +332,83 @@ void Time_Dependent_Solver<T>::setup(RCP_Dimensions  dim,
     // register the operator with the solver
     d_solver.set_operator(b_system->get_Operator());
 
-    // allocate the left-hand side solution vector
-    d_lhs = VectorTraits<T>::build_vector(b_system->get_Map());
+    d_system_dt = d_dt->dt();
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Solve the SPN equations for a given external source.
+ * \brief Solve the backward-Euler system for the current timestep.
  */
 template <class T>
-void Time_Dependent_Solver<T>::solve(Teuchos::RCP<const External_Source> q)
+void Time_Dependent_Solver<T>::advance(const External_Source &q)
 {
-    REQUIRE(!q.is_null());
-    REQUIRE(!b_system.is_null());
-    REQUIRE(!d_lhs.is_null());
-
-    // null lhs vector
-    VectorTraits<T>::put_scalar(d_lhs,0.0);
+    // rebuild the operator only if the timestep has changed
+    if (d_dt->dt() != d_system_dt)
+    {
+        build_system();
+    }
 
-    // make the right-hand side vector based on the source
-    b_system->build_RHS(*q);
+    // make the right-hand side vector based on the source and the previous
+    // timestep solution
+    b_system->build_RHS(q);
+    b_system->add_time_source(d_lhs);
     CHECK( VectorTraits<T>::local_length(b_system->get_RHS()) ==
            VectorTraits<T>::local_length(d_lhs) );
 
-    // solve the problem
+    // solve the problem using the previous solution as the initial guess
     d_solver.solve(d_lhs, b_system->get_RHS());
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Write scalar flux into the state.
+ * \brief Estimate the relative local truncation error of the last solve.
+ *
+ * The solution is compared against the linear extrapolation of
+ * \f$\mathbf{u}^{n-2}\f$ and \f$\mathbf{u}^{n-1}\f$ to the new time; the
+ * difference is scaled to the backward-Euler truncation error.
  */
 template <class T>
-void Time_Dependent_Solver<T>::write_state(State &state)
+double Time_Dependent_Solver<T>::estimate_error() const
 {
-    REQUIRE(state.mesh().num_cells() *
-             b_system->get_dims()->num_equations() * state.num_groups()
-             <= VectorTraits<T>::local_length(d_lhs) );
+    REQUIRE(d_dt_prev > 0.0);
 
-    Base::write_u_into_state(d_lhs, state);
+    Teuchos::ArrayRCP<const double> u  = VectorTraits<T>::get_data(d_lhs);
+    Teuchos::ArrayRCP<const double> u1 = VectorTraits<T>::get_data(d_prev);
+    Teuchos::ArrayRCP<const double> u2 = VectorTraits<T>::get_data(d_prev2);
+    CHECK(u.size() == u1.size() && u.size() == u2.size());
+
+    double dt    = d_dt->dt();
+    double ratio = dt / d_dt_prev;
+
+    // norms of the difference and of the solution
+    double norm[2] = {0.0, 0.0};
+    for (int i = 0; i < u.size(); ++i)
+    {
+        double diff = u[i] - (u1[i] + ratio * (u1[i] - u2[i]));
+        norm[0] += diff * diff;
+        norm[1] += u[i] * u[i];
+    }
+    profugus::global_sum(norm, 2);
+
+    if (norm[1] == 0.0)
+        return 0.0;
+
+    return dt / (dt + d_dt_prev) * std::sqrt(norm[0] / norm[1]);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Write matrices to file
+ * \brief Copy the local entries of x into y.
  */
 template <class T>
-void Time_Dependent_Solver<T>::write_problem_to_file() const
+void Time_Dependent_Solver<T>::copy(Teuchos::RCP<const MV> x,
+                                    Teuchos::RCP<MV>       y)
 {
-    // Write A (LHS operator)
-    Teuchos::RCP<const typename T::MATRIX> matrix =
-        Teuchos::rcp_dynamic_cast<const typename T::MATRIX>(
-            b_system->get_Operator());
-    MatrixTraits<T>::write_matrix_file(matrix,"A.mtx");
+    Teuchos::ArrayRCP<const double> src = VectorTraits<T>::get_data(x);
+    Teuchos::ArrayRCP<double> dst = VectorTraits<T>::get_data_nonconst(y);
+    CHECK(src.size() == dst.size());
+
+    std::copy(src.begin(), src.end(), dst.begin());
 }
 
 } // end namespace profugus
@@ -65,6 +65,16 @@ class Timestep
         d_timesteps.push_back(d_dt);
     }
 
+    //! Replace the current timestep without advancing the cycle.
+    void reset(double dt)
+    {
+        REQUIRE(dt > 0.0);
+        REQUIRE(!d_timesteps.empty());
+
+        d_dt = dt;
+        d_timesteps.back() = d_dt;
+    }
+
     //! Get the current timestep.
     double dt() const { return d_dt; }
 
@@ -230,6 +230,62 @@ Teuchos::RCP<profugus::Mat_DB> make_mat(int Pn,
     return mat;
 }
 
+//---------------------------------------------------------------------------//
+
+Teuchos::RCP<profugus::Mat_DB> make_mat(int                        Pn,
+                                        const std::vector<int>    &matids,
+                                        const std::vector<double> &f,
+                                        const std::vector<int>    &cell2mid)
+{
+    using profugus::Mat_DB;
+
+    REQUIRE(f.size() == matids.size());
+
+    // material db
+    Teuchos::RCP<Mat_DB> mat = Teuchos::rcp(new Mat_DB);
+
+    // make the cross sections
+    Mat_DB::RCP_XS xs = Teuchos::rcp(new Mat_DB::XS_t);
+    xs->set(Pn, 12);
+
+    for (int m = 0; m < matids.size(); ++m)
+    {
+        // make totals
+        Mat_DB::XS_t::OneDArray tot(&T[0], &T[0] + 12);
+        for (int g = 0; g < 12; ++g)
+        {
+            tot[g] *= f[m];
+        }
+        xs->add(matids[m], Mat_DB::XS_t::TOTAL, tot);
+
+        double *sctxs[] = {&S0[0][0], &S1[0][0], &S2[0][0], &S3[0][0]};
+
+        // scattering
+        for (int n = 0; n <= Pn; ++n)
+        {
+            Mat_DB::XS_t::TwoDArray scat(12, 12, 0.0);
+            const double *data = sctxs[n];
+            for (int g = 0; g < 12; ++g)
+            {
+                for (int gp = 0; gp < 12; ++gp)
+                {
+                    scat(g, gp) = data[gp + g * 12] * f[m];
+                }
+            }
+
+            xs->add(matids[m], n, scat);
+        }
+    }
+
+    xs->complete();
+
+    // set the mat
+    mat->set(xs);
+    mat->assign(cell2mid);
+
+    return mat;
+}
+
 } // end namespace twelve_grp
 
 //---------------------------------------------------------------------------//
@@ -32,6 +32,10 @@ extern double S3[12][12];
 
 Teuchos::RCP<profugus::Mat_DB> make_mat(int Pn, int Nc);
 
+Teuchos::RCP<profugus::Mat_DB> make_mat(int Pn, const std::vector<int> &matids,
+                                        const std::vector<double> &f,
+                                        const std::vector<int> &cell2mid);
+
 }
 
 //---------------------------------------------------------------------------//
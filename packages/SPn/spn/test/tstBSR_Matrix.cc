@@ -0,0 +1,213 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/test/tstBSR_Matrix.cc
+ * \author agent
+ * \date   Mon Oct 19 03:25:24 2026
+ * \brief  BSR_Matrix unit test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "gtest/utils_gtest.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include "AnasaziOperatorTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "solvers/LinAlgTypedefs.hh"
+#include "../BSR_Matrix.hh"
+#include "../MatrixTraits.hh"
+#include "../VectorTraits.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+template <class T>
+class BSRTest : public testing::Test
+{
+  protected:
+    void SetUp()
+    {
+        node  = profugus::node();
+        nodes = profugus::nodes();
+    }
+
+    // Entry (g,gp) of block (i,j) of a block-tridiagonal matrix.
+    double entry(int i, int j, int g, int gp) const
+    {
+        if (i == j)
+            return g == gp ? 10.0 + i : 0.5 / (1.0 + g + 2 * gp);
+        return -1.0 / (1.0 + i + j + g + gp);
+    }
+
+  protected:
+    int node, nodes;
+};
+
+using profugus::EpetraTypes;
+using profugus::TpetraTypes;
+typedef ::testing::Types<EpetraTypes,TpetraTypes> MyTypes;
+TYPED_TEST_CASE(BSRTest, MyTypes);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(BSRTest, Apply)
+{
+    typedef typename TypeParam::MAP               Map_t;
+    typedef typename TypeParam::MATRIX            Matrix_t;
+    typedef typename TypeParam::OP                OP;
+    typedef typename TypeParam::MV                MV;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    typedef profugus::MatrixTraits<TypeParam>     MatrixTraits;
+    typedef profugus::VectorTraits<TypeParam>     VectorTraits;
+
+    // 4 block rows of size 3 on each domain
+    int bs = 3, Nr = 4, N = Nr * this->nodes;
+
+    Teuchos::RCP<Map_t> map =
+        MatrixTraits::build_map(Nr * bs, N * bs);
+
+    profugus::BSR_Matrix<TypeParam> A(map, bs, 3);
+    Teuchos::RCP<Matrix_t> B = MatrixTraits::construct_matrix(map, 3 * bs);
+
+    // fill the block-tridiagonal matrix in block and point storage
+    std::vector<double> block(bs * bs);
+    std::vector<int>    inds(3 * bs);
+    std::vector<double> vals(3 * bs);
+    for (int i = this->node * Nr; i < (this->node + 1) * Nr; ++i)
+    {
+        for (int g = 0; g < bs; ++g)
+        {
+            int count = 0;
+            for (int j = std::max(i - 1, 0); j <= std::min(i + 1, N - 1); ++j)
+            {
+                for (int gp = 0; gp < bs; ++gp)
+                {
+                    inds[count] = j * bs + gp;
+                    vals[count] = this->entry(i, j, g, gp);
+                    ++count;
+                }
+            }
+            MatrixTraits::add_to_matrix(
+                B, i * bs + g, count,
+                Teuchos::arcp<const int>(&inds[0], 0, count, false),
+                Teuchos::arcp<const double>(&vals[0], 0, count, false));
+        }
+
+        // insert the diagonal block in two halves to check summation
+        for (int j = std::max(i - 1, 0); j <= std::min(i + 1, N - 1); ++j)
+        {
+            for (int gp = 0; gp < bs; ++gp)
+            {
+                for (int g = 0; g < bs; ++g)
+                {
+                    block[g + gp * bs] = this->entry(i, j, g, gp) *
+                                         (i == j ? 0.5 : 1.0);
+                }
+            }
+            A.insert_block(i, j, &block[0]);
+            if (i == j)
+                A.insert_block(i, j, &block[0]);
+        }
+    }
+    MatrixTraits::finalize_matrix(B);
+    A.fill_complete();
+
+    EXPECT_TRUE(A.filled());
+    EXPECT_EQ(Nr, A.num_block_rows());
+    EXPECT_EQ(MatrixTraits::global_nonzeros(B), A.global_nonzeros());
+
+    // compare the block and point matrices
+    Teuchos::RCP<MV> x     = VectorTraits::build_vector(map, 2);
+    Teuchos::RCP<MV> y     = VectorTraits::build_vector(map, 2);
+    Teuchos::RCP<MV> y_ref = VectorTraits::build_vector(map, 2);
+
+    for (int v = 0; v < 2; ++v)
+    {
+        Teuchos::ArrayRCP<double> x_data =
+            VectorTraits::get_data_nonconst(x, v);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.1 * ((n + this->node + v) % 5);
+        }
+    }
+
+    OPT::Apply(*B, *x, *y_ref);
+    OPT::Apply(A, *x, *y);
+
+    for (int v = 0; v < 2; ++v)
+    {
+        Teuchos::ArrayRCP<const double> a = VectorTraits::get_data(y_ref, v);
+        Teuchos::ArrayRCP<const double> b = VectorTraits::get_data(y, v);
+        for (int n = 0; n < a.size(); ++n)
+        {
+            EXPECT_SOFTEQ(a[n], b[n], 1.0e-12);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(BSRTest, Block_Jacobi)
+{
+    typedef typename TypeParam::MAP               Map_t;
+    typedef typename TypeParam::OP                OP;
+    typedef typename TypeParam::MV                MV;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    typedef profugus::MatrixTraits<TypeParam>     MatrixTraits;
+    typedef profugus::VectorTraits<TypeParam>     VectorTraits;
+    typedef profugus::BSR_Matrix<TypeParam>       BSR;
+
+    int bs = 3, Nr = 4, N = Nr * this->nodes;
+
+    Teuchos::RCP<Map_t> map =
+        MatrixTraits::build_map(Nr * bs, N * bs);
+
+    // block-diagonal matrix
+    Teuchos::RCP<BSR> D = Teuchos::rcp(new BSR(map, bs, 1));
+    std::vector<double> block(bs * bs);
+    for (int i = this->node * Nr; i < (this->node + 1) * Nr; ++i)
+    {
+        for (int gp = 0; gp < bs; ++gp)
+        {
+            for (int g = 0; g < bs; ++g)
+            {
+                block[g + gp * bs] = this->entry(i, i, g, gp);
+            }
+        }
+        D->insert_block(i, i, &block[0]);
+    }
+    D->fill_complete();
+
+    profugus::BSR_Block_Jacobi<TypeParam> P(D);
+
+    // P(D x) = x
+    Teuchos::RCP<MV> x = VectorTraits::build_vector(map);
+    Teuchos::RCP<MV> b = VectorTraits::build_vector(map);
+    Teuchos::RCP<MV> y = VectorTraits::build_vector(map);
+
+    Teuchos::ArrayRCP<double> x_data = VectorTraits::get_data_nonconst(x);
+    for (int n = 0; n < x_data.size(); ++n)
+    {
+        x_data[n] = 1.0 + 0.2 * (n % 3);
+    }
+
+    OPT::Apply(*D, *x, *b);
+    OPT::Apply(P, *b, *y);
+
+    Teuchos::ArrayRCP<const double> y_data = VectorTraits::get_data(y);
+    for (int n = 0; n < y_data.size(); ++n)
+    {
+        EXPECT_SOFTEQ(x_data[n], y_data[n], 1.0e-12);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstBSR_Matrix.cc
+//---------------------------------------------------------------------------//
@@ -10,6 +10,9 @@
 
 #include "gtest/utils_gtest.hh"
 
+#include <vector>
+
+#include "Teuchos_Array.hpp"
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_StandardCatchMacros.hpp"
@@ -19,6 +22,7 @@
 #include "solvers/LinAlgTypedefs.hh"
 #include "../Dimensions.hh"
 #include "../Eigenvalue_Solver.hh"
+#include "../Energy_Multigrid.hh"
 #include "../Isotropic_Source.hh"
 
 #include "Test_XS.hh"
@@ -60,21 +64,24 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
         db = Teuchos::rcp(new Teuchos::ParameterList("Test"));
     }
 
+    // Build an NxNxN problem; for N > 3 the outer layer of cells is a
+    // non-fissile reflector.
     void build(int order,
-               int Ng)
+               int Ng,
+               int N = 3)
     {
         num_groups = Ng;
         eqn_order  = order;
 
-        // build 4x4x4 mesh
+        // build NxNxN mesh
 
         db->set("delta_x", 1.0);
         db->set("delta_y", 1.0);
         db->set("delta_z", 1.0);
 
-        db->set("num_cells_i", 3);
-        db->set("num_cells_j", 3);
-        db->set("num_cells_k", 3);
+        db->set("num_cells_i", N);
+        db->set("num_cells_j", N);
+        db->set("num_cells_k", N);
 
         if (nodes == 2)
         {
@@ -106,7 +113,7 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
         EXPECT_FALSE(data.is_null());
 
         // add fission
-        RCP_Mat_DB matf = Teuchos::rcp(new Mat_DB_t);
+        matf = Teuchos::rcp(new Mat_DB_t);
         {
             const XS &old = mat->xs();
             RCP_XS xs     = Teuchos::rcp(new XS);
@@ -163,12 +170,29 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
             xs->add(0, 2, P2);
             xs->add(0, 3, P3);
 
+            // reflector
+            if (N > 3)
+            {
+                xs->add(1, XS::TOTAL, tot);
+                xs->add(1, 0, P0);
+                xs->add(1, 1, P1);
+                xs->add(1, 2, P2);
+                xs->add(1, 3, P3);
+            }
+
             xs->complete();
             matf->set(xs, mesh->num_cells());
 
+            int i = 0, j = 0, k = 0;
             for (int n = 0; n < mesh->num_cells(); ++n)
             {
-                matf->matid(n) = 0;
+                indexer->l2l(n, i, j, k);
+                i += indexer->offset(def::I);
+                j += indexer->offset(def::J);
+
+                bool core = N == 3 || (i > 0 && i < N - 1 && j > 0 &&
+                                       j < N - 1 && k > 0 && k < N - 1);
+                matf->matid(n) = core ? 0 : 1;
             }
         }
 
@@ -185,13 +209,63 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
         state = Teuchos::rcp(new profugus::State(mesh, num_groups));
     }
 
+    // Copy the fission materials with nu-fission scaled by factor; in the
+    // infinite medium this scales keff and leaves the eigenvector unchanged.
+    RCP_Mat_DB scale_fission(double factor) const
+    {
+        const XS &old = matf->xs();
+        const int Ng  = old.num_groups();
+        RCP_XS    xs  = Teuchos::rcp(new XS);
+
+        xs->set(old.pn_order(), Ng);
+
+        std::vector<int> matids;
+        old.get_matids(matids);
+        for (int m : matids)
+        {
+            for (int type = 0; type < XS::END_XS_TYPES; ++type)
+            {
+                const XS::Vector &v = old.vector(m, type);
+                XS::OneDArray     d(v.values(), v.values() + Ng);
+                if (type == XS::NU_SIG_F)
+                {
+                    for (auto &x : d)
+                        x *= factor;
+                }
+                xs->add(m, type, d);
+            }
+            for (int n = 0; n <= old.pn_order(); ++n)
+            {
+                const XS::Matrix &s = old.matrix(m, n);
+                XS::TwoDArray     P(Ng, Ng);
+                for (int g = 0; g < Ng; ++g)
+                {
+                    for (int gp = 0; gp < Ng; ++gp)
+                    {
+                        P(g, gp) = s(g, gp);
+                    }
+                }
+                xs->add(m, n, P);
+            }
+        }
+        xs->complete();
+
+        RCP_Mat_DB scaled = Teuchos::rcp(new Mat_DB_t);
+        scaled->set(xs, mesh->num_cells());
+        for (int n = 0; n < mesh->num_cells(); ++n)
+        {
+            scaled->matid(n) = matf->matid(n);
+        }
+        return scaled;
+    }
+
   protected:
     RCP_ParameterList db;
     RCP_Mesh          mesh;
     RCP_Indexer       indexer;
     RCP_Global_Data   data;
 
-    RCP_Mat_DB     mat;
+    RCP_Mat_DB     mat, matf;
     RCP_Dimensions dim;
 
     RCP_Solver solver;
@@ -296,6 +370,199 @@ TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP1)
 
 //---------------------------------------------------------------------------//
 
+TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP1_Rebalance)
+{
+    typedef typename TestFixture::Linear_System_t Linear_System_t;
+    typedef typename TypeParam::MV                MV;
+
+    // power iteration with a coarse-mesh rebalance every iteration; the
+    // medium is infinite so the first rebalance gives the converged
+    // spectrum
+    Teuchos::ParameterList &edb = this->db->sublist("eigenvalue_db");
+    edb.set("eigensolver", std::string("Power"));
+    edb.set("tolerance", 1.0e-10);
+    edb.set("max_itr", 10);
+    edb.set("rebalance", true);
+    edb.set("rebalance_coarsening", Teuchos::Array<int>(3, 2));
+
+    this->build(1, 3);
+
+    Teuchos::RCP<profugus::Isotropic_Source> q;
+    this->solver->solve(q);
+
+    EXPECT_SOFTEQ(3.301149153942720, this->solver->get_eigenvalue(), 1.0e-6);
+
+    Teuchos::RCP<const MV> ev = this->solver->get_eigenvector();
+    Teuchos::ArrayRCP<const double> ev_data =
+        profugus::VectorTraits<TypeParam>::get_data(ev);
+
+    const Linear_System_t &system = this->solver->get_linear_system();
+
+    double ref[] = {0.316914305060293, 0.867219274759711, 0.384052148455639};
+
+    for (int cell = 0; cell < this->mesh->num_cells(); ++cell)
+    {
+        double norm = 0.0;
+        for (int g = 0; g < 3; ++g)
+        {
+            int index  = system.index(g, 0, cell);
+            norm      += ev_data[index] * ev_data[index];
+        }
+
+        for (int g = 0; g < 3; ++g)
+        {
+            int index = system.index(g, 0, cell);
+            double v  = std::fabs( ev_data[index] / sqrt(norm) );
+            EXPECT_SOFTEQ(ref[g], v, 1.0e-6);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP1_Rebalance_Heterogeneous)
+{
+    // reflected core with vacuum boundaries; power iteration with and
+    // without coarse-mesh rebalance must agree, and rebalance must need
+    // fewer outer iterations
+    Teuchos::ParameterList &edb = this->db->sublist("eigenvalue_db");
+    edb.set("eigensolver", std::string("Power"));
+    edb.set("tolerance", 1.0e-8);
+    edb.set("max_itr", 1000);
+    this->db->set("boundary", std::string("vacuum"));
+
+    this->build(1, 3, 8);
+
+    Teuchos::RCP<profugus::Isotropic_Source> q;
+    this->solver->solve(q);
+
+    int    power_itr  = this->solver->num_iters();
+    double power_keff = this->solver->get_eigenvalue();
+    EXPECT_LT(power_itr, 1000);
+    EXPECT_EQ(0, this->solver->num_rebalance_failures());
+
+    edb.set("rebalance", true);
+    edb.set("rebalance_coarsening", Teuchos::Array<int>(3, 2));
+
+    this->build(1, 3, 8);
+    this->solver->solve(q);
+
+    EXPECT_EQ(0, this->solver->num_rebalance_failures());
+    EXPECT_LT(this->solver->num_iters(), power_itr);
+    EXPECT_SOFTEQ(power_keff, this->solver->get_eigenvalue(), 1.0e-6);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP1_Warm_Start)
+{
+    typedef typename TestFixture::Solver     Solver;
+    typedef typename TestFixture::RCP_Mat_DB RCP_Mat_DB;
+
+    const double ref = 3.301149153942720;
+
+    Teuchos::ParameterList &edb = this->db->sublist("eigenvalue_db");
+    edb.set("eigensolver", std::string("Power"));
+    edb.set("tolerance", 1.0e-8);
+    edb.set("prec_reuse_tolerance", 0.01);
+
+    this->build(1, 3);
+    EXPECT_EQ(1, this->solver->num_preconditioner_builds());
+
+    // cold start
+    Teuchos::RCP<profugus::Isotropic_Source> q;
+    this->solver->solve(q);
+    EXPECT_SOFTEQ(ref, this->solver->get_eigenvalue(), 1.0e-6);
+    int cold = this->solver->num_iters();
+    EXPECT_GT(cold, 2);
+
+    // a small cross section change is within the tolerance, so the
+    // preconditioner is reused; the solve restarts from the converged
+    // eigenvector and takes fewer iterations
+    RCP_Mat_DB small = this->scale_fission(1.001);
+    this->solver->setup(this->dim, small, this->mesh, this->indexer,
+                        this->data);
+    EXPECT_EQ(1, this->solver->num_preconditioner_builds());
+    this->solver->solve(q);
+    EXPECT_SOFTEQ(1.001 * ref, this->solver->get_eigenvalue(), 1.0e-6);
+    EXPECT_LT(this->solver->num_iters(), cold);
+
+    // a large change exceeds the tolerance and rebuilds the preconditioner;
+    // the solve is still warm-started
+    RCP_Mat_DB large = this->scale_fission(1.5);
+    this->solver->setup(this->dim, large, this->mesh, this->indexer,
+                        this->data);
+    EXPECT_EQ(2, this->solver->num_preconditioner_builds());
+    this->solver->solve(q);
+    EXPECT_SOFTEQ(1.5 * ref, this->solver->get_eigenvalue(), 1.0e-6);
+    EXPECT_LT(this->solver->num_iters(), cold);
+
+    // returning within the tolerance of the rebuilt preconditioner's cross
+    // sections reuses it
+    this->solver->setup(this->dim, this->scale_fission(1.501), this->mesh,
+                        this->indexer, this->data);
+    EXPECT_EQ(2, this->solver->num_preconditioner_builds());
+
+    // a negative tolerance always rebuilds
+    edb.set("prec_reuse_tolerance", -1.0);
+    this->solver->setup(this->dim, this->matf, this->mesh, this->indexer,
+                        this->data);
+    EXPECT_EQ(3, this->solver->num_preconditioner_builds());
+
+    // seed a new solver with the converged solution
+    this->solver->solve(q);
+    double keff = this->solver->get_eigenvalue();
+    EXPECT_SOFTEQ(ref, keff, 1.0e-6);
+
+    Solver other(this->db);
+    other.setup(this->dim, this->matf, this->mesh, this->indexer,
+                this->data);
+    other.set_initial_guess(this->solver->get_eigenvector(), keff);
+    EXPECT_SOFTEQ(keff, other.get_eigenvalue(), 1.0e-12);
+    other.solve(q);
+    EXPECT_SOFTEQ(keff, other.get_eigenvalue(), 1.0e-6);
+    EXPECT_LT(other.num_iters(), cold);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP1_Davidson_Block)
+{
+    typedef profugus::Energy_Multigrid<TypeParam> Multigrid;
+
+    // Davidson expanding by blocks of 2 with a multigrid preconditioner whose
+    // Chebyshev smoothers take the whole block
+    Teuchos::ParameterList &edb = this->db->sublist("eigenvalue_db");
+    edb.set("eigensolver", std::string("Davidson"));
+    edb.set("tolerance", 1.0e-8);
+    edb.set("block_size", 2);
+    edb.set("Preconditioner", std::string("Multigrid"));
+
+    Teuchos::ParameterList &sdb =
+        edb.sublist("Multigrid Preconditioner").sublist("Smoother");
+    sdb.set("solver_type", std::string("profugus"));
+    sdb.set("profugus_solver", std::string("Chebyshev"));
+    sdb.set("Preconditioner", std::string("None"));
+    sdb.set("max_itr", 3);
+
+    this->build(1, 3);
+    EXPECT_EQ(2, edb.sublist("Anasazi").template get<int>("Block Size"));
+
+    Teuchos::RCP<profugus::Isotropic_Source> q;
+    this->solver->solve(q);
+
+    EXPECT_SOFTEQ(3.301149153942720, this->solver->get_eigenvalue(), 1.0e-6);
+
+    // the correction equations of a block share one V-cycle
+    Teuchos::RCP<const Multigrid> mg =
+        Teuchos::rcp_dynamic_cast<const Multigrid>(
+            this->solver->preconditioner());
+    ASSERT_FALSE(mg.is_null());
+    EXPECT_EQ(2, mg->max_block_size());
+}
+
+//---------------------------------------------------------------------------//
+
 TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP3)
 {
     typedef typename TestFixture::Linear_System_t Linear_System_t;
@@ -11,6 +11,7 @@
 #include <vector>
 #include <string>
 #include <iomanip>
+#include <cmath>
 
 #include "gtest/utils_gtest.hh"
 #include <SPn/config.h>
@@ -22,7 +23,9 @@
 
 #include "xs/Mat_DB.hh"
 #include "mesh/Partitioner.hh"
+#include "mesh/Mesh_Coarsener.hh"
 #include "solvers/LinAlgTypedefs.hh"
+#include "solvers/LinearSolverBuilder.hh"
 #include "../Linear_System_FV.hh"
 #include "../Dimensions.hh"
 #include "../Energy_Multigrid.hh"
@@ -152,12 +155,35 @@ class MultigridTest : public testing::Test
         // Create preconditioner
         d_prec = rcp( new Energy_Multigrid(
             db, prec_db, dim, mat, mesh, indexer, data, d_system) );
+
+        // Store the problem for additional preconditioners
+        d_db      = db;
+        d_dim     = dim;
+        d_mat     = mat;
+        d_mesh    = mesh;
+        d_indexer = indexer;
+        d_data    = data;
+    }
+
+    // Build a preconditioner on the fine system
+    RCP<Energy_Multigrid> build_prec(RCP_ParameterList prec_db)
+    {
+        return rcp( new Energy_Multigrid(
+            d_db, prec_db, d_dim, d_mat, d_mesh, d_indexer, d_data,
+            d_system) );
     }
 
     int d_node, d_nodes;
     RCP<Energy_Multigrid> d_prec;
     RCP<Linear_System>    d_system;
 
+    RCP_ParameterList                 d_db;
+    RCP<profugus::Dimensions>         d_dim;
+    RCP<profugus::Mat_DB>             d_mat;
+    Partitioner::RCP_Mesh             d_mesh;
+    Partitioner::RCP_Indexer          d_indexer;
+    Partitioner::RCP_Global_Data      d_data;
+
 };
 
 //---------------------------------------------------------------------------//
@@ -204,6 +230,449 @@ TYPED_TEST(MultigridTest, Heuristic)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Collapse_Cache)
+{
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+
+    RCP_ParameterList smoother_db = rcp(new ParameterList("Smoother"));
+    smoother_db->set("solver_type", string("profugus"));
+    smoother_db->set("profugus_solver", string("richardson"));
+    smoother_db->set("max_itr", 2);
+    smoother_db->set("Preconditioner", string("none"));
+
+    RCP_ParameterList prec_db = rcp(new ParameterList("Prec"));
+    prec_db->set("Smoother", *smoother_db);
+
+    // no caching by default
+    RCP<Energy_Multigrid> a = this->build_prec(prec_db);
+    EXPECT_TRUE(a->collapse_cache().is_null());
+
+    // a rebuilt preconditioner reuses the collapsed cross sections of the
+    // first
+    prec_db->set("Collapse Cache Size", 8);
+    RCP<Energy_Multigrid> b = this->build_prec(prec_db);
+    ASSERT_FALSE(b->collapse_cache().is_null());
+    int collapses = b->collapse_cache()->misses();
+    EXPECT_GT(collapses, 0);
+    EXPECT_EQ(0, b->collapse_cache()->hits());
+
+    RCP<Energy_Multigrid> c = this->build_prec(prec_db);
+    EXPECT_EQ(b->collapse_cache().get(), c->collapse_cache().get());
+    EXPECT_EQ(collapses, c->collapse_cache()->misses());
+    EXPECT_EQ(collapses, c->collapse_cache()->hits());
+
+    // a preconditioner built from another database has its own cache
+    RCP_ParameterList other_db = rcp(new ParameterList("Other"));
+    other_db->set("Smoother", *smoother_db);
+    other_db->set("Collapse Cache Size", 8);
+    RCP<Energy_Multigrid> d = this->build_prec(other_db);
+    EXPECT_NE(b->collapse_cache().get(), d->collapse_cache().get());
+    EXPECT_EQ(0, d->collapse_cache()->hits());
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Block)
+{
+    typedef typename TestFixture::MV  MV;
+    typedef typename TestFixture::MVT MVT;
+    typedef typename TestFixture::OPT OPT;
+
+    RCP<MV> v = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+
+    // a block of three vectors is preconditioned at once
+    RCP<MV> x = MVT::Clone(*v,3);
+    RCP<MV> y = MVT::Clone(*v,3);
+    MVT::MvRandom(*x);
+    OPT::Apply(*(this->d_prec),*x,*y);
+
+    // each vector is preconditioned independently
+    RCP<MV> z = MVT::Clone(*v,1);
+    for (int n = 0; n < 3; ++n)
+    {
+        vector<int> ind(1, n);
+        OPT::Apply(*(this->d_prec),*MVT::CloneView(*x,ind),*z);
+
+        vector<double> norm_z(1), norm_d(1);
+        MVT::MvNorm(*z,norm_z);
+        MVT::MvAddMv(1.0,*MVT::CloneView(*y,ind),-1.0,*z,*z);
+        MVT::MvNorm(*z,norm_d);
+        EXPECT_LT(norm_d[0], 1.0e-10 * norm_z[0]);
+    }
+
+    // the preconditioner can go back to single vectors
+    OPT::Apply(*(this->d_prec),*MVT::CloneView(*x,vector<int>(1,2)),*z);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Single_Precision)
+{
+    typedef typename TestFixture::MV  MV;
+    typedef typename TestFixture::MVT MVT;
+    typedef typename TestFixture::OPT OPT;
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+
+    // unpreconditioned Richardson smoother
+    RCP_ParameterList smoother_db = rcp(new ParameterList("Smoother"));
+    smoother_db->set("solver_type", string("profugus"));
+    smoother_db->set("profugus_solver", string("richardson"));
+    smoother_db->set("max_itr", 2);
+    smoother_db->set("tolerance", 1.0e-12);
+    smoother_db->set("Preconditioner", string("none"));
+
+    RCP_ParameterList prec_db = rcp(new ParameterList("Prec"));
+    prec_db->set("Smoother", *smoother_db);
+
+    // double- and single-precision V-cycles without refinement
+    RCP<Energy_Multigrid> dbl = this->build_prec(prec_db);
+    prec_db->set("Precision", string("single"));
+    prec_db->set("Refinement Iterations", 0);
+    RCP<Energy_Multigrid> sgl = this->build_prec(prec_db);
+
+    RCP<MV> x = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    RCP<MV> y = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    RCP<MV> z = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+
+    profugus::VectorTraits<TypeParam>::put_scalar(x,1.0);
+    OPT::Apply(*dbl,*x,*y);
+    OPT::Apply(*sgl,*x,*z);
+
+    // the V-cycles agree to single precision
+    vector<double> norm_y(1), norm_d(1);
+    MVT::MvNorm(*y,norm_y);
+    MVT::MvAddMv(1.0,*y,-1.0,*z,*z);
+    MVT::MvNorm(*z,norm_d);
+
+    EXPECT_GT(norm_y[0], 0.0);
+    EXPECT_LT(norm_d[0] / norm_y[0], 1.0e-5);
+
+    // preconditioners built from the double-precision matrix are rejected
+    smoother_db->set("Preconditioner", string("ifpack"));
+    prec_db->set("Smoother", *smoother_db);
+    EXPECT_THROW(this->build_prec(prec_db), profugus::assertion);
+
+    // single-precision block-Jacobi smoothing; each refinement iteration
+    // reduces the double-precision residual of the preconditioner
+    smoother_db->set("Preconditioner", string("block jacobi"));
+    prec_db->set("Smoother", *smoother_db);
+
+    RCP<MV> r = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    vector<double> norm_x(1), norm_r(3);
+    MVT::MvNorm(*x,norm_x);
+    for (int k = 0; k < 3; ++k)
+    {
+        prec_db->set("Refinement Iterations", k);
+        sgl = this->build_prec(prec_db);
+
+        OPT::Apply(*sgl,*x,*y);
+        OPT::Apply(*this->d_system->get_Operator(),*y,*r);
+        MVT::MvAddMv(1.0,*x,-1.0,*r,*r);
+
+        vector<double> norm(1);
+        MVT::MvNorm(*r,norm);
+        norm_r[k] = norm[0] / norm_x[0];
+    }
+    EXPECT_LT(norm_r[0], 1.0);
+    EXPECT_LT(norm_r[1], norm_r[0]);
+    EXPECT_LT(norm_r[2], norm_r[1]);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Space_Energy)
+{
+    typedef typename TestFixture::MV  MV;
+    typedef typename TestFixture::OPT OPT;
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+
+    // unpreconditioned Richardson smoother (it preserves spatially flat
+    // vectors)
+    RCP_ParameterList smoother_db = rcp(new ParameterList("Smoother"));
+    smoother_db->set("solver_type", string("profugus"));
+    smoother_db->set("profugus_solver", string("richardson"));
+    smoother_db->set("max_itr", 2);
+    smoother_db->set("tolerance", 1.0e-12);
+    smoother_db->set("Preconditioner", string("none"));
+
+    RCP<MV> x = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    RCP<MV> y = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    profugus::VectorTraits<TypeParam>::put_scalar(x,1.0);
+
+    // the problem is an infinite medium, so a spatially flat source gives
+    // a spatially flat V-cycle for both space-energy coarsenings
+    string coarsening[] = {"space-energy", "alternating"};
+    for (int c = 0; c < 2; ++c)
+    {
+        RCP_ParameterList prec_db = rcp(new ParameterList("Prec"));
+        prec_db->set("Smoother", *smoother_db);
+        prec_db->set("Coarsening", coarsening[c]);
+
+        RCP<Energy_Multigrid> prec = this->build_prec(prec_db);
+        OPT::Apply(*prec,*x,*y);
+
+        Teuchos::ArrayRCP<const double> data =
+            profugus::VectorTraits<TypeParam>::get_data(y);
+
+        int Nu = data.size() / this->d_mesh->num_cells();
+        for (int cell = 1; cell < this->d_mesh->num_cells(); ++cell)
+        {
+            for (int u = 0; u < Nu; ++u)
+            {
+                EXPECT_SOFTEQ(data[u], data[u + Nu * cell], 1.0e-8);
+            }
+        }
+        EXPECT_GT(std::fabs(data[0]), 0.0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Space_Energy_Heterogeneous)
+{
+    using def::I; using def::J; using def::K;
+
+    typedef typename TestFixture::MV  MV;
+    typedef typename TestFixture::OPT OPT;
+    typedef typename TestFixture::Linear_System    Linear_System;
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+    typedef profugus::VectorTraits<TypeParam>      VT;
+
+    // 16x16x2 mesh of 0.5 cm cells (with the decomposition of the fixture)
+    RCP_ParameterList db = rcp(new ParameterList("Heterogeneous"));
+    db->set("delta_x", 0.5);
+    db->set("delta_y", 0.5);
+    db->set("delta_z", 0.5);
+    db->set("num_cells_i", 16);
+    db->set("num_cells_j", 16);
+    db->set("num_cells_k", 2);
+    db->set("num_blocks_i", this->d_db->template get<int>("num_blocks_i"));
+    db->set("num_blocks_j", this->d_db->template get<int>("num_blocks_j"));
+    db->set("boundary", string("vacuum"));
+    db->set("matrix_storage", string("bsr"));
+
+    Partitioner p(db);
+    p.build();
+    Partitioner::RCP_Mesh mesh        = p.get_mesh();
+    Partitioner::RCP_Indexer indexer  = p.get_indexer();
+    Partitioner::RCP_Global_Data data = p.get_global_data();
+
+    // checkerboard of 2x2 cm tiles; the second material is 4 times denser
+    vector<int> cell2mid(mesh->num_cells());
+    for (int cell = 0; cell < mesh->num_cells(); ++cell)
+    {
+        profugus::Mesh::Dim_Vector ijk = mesh->cardinal(cell);
+        int ti = static_cast<int>(mesh->center(ijk[I], I) / 2.0);
+        int tj = static_cast<int>(mesh->center(ijk[J], J) / 2.0);
+        cell2mid[cell] = (ti + tj) % 2;
+    }
+    vector<int>    matids = {0, 1};
+    vector<double> f      = {1.0, 4.0};
+    RCP<profugus::Mat_DB> mat = twelve_grp::make_mat(1, matids, f, cell2mid);
+
+    RCP<Linear_System> system = rcp(
+        new Linear_System(db, this->d_dim, mat, mesh, indexer, data));
+    system->build_Matrix();
+
+    // block-Jacobi Richardson smoother on every level
+    RCP_ParameterList smoother_db = rcp(new ParameterList("Smoother"));
+    smoother_db->set("solver_type", string("profugus"));
+    smoother_db->set("profugus_solver", string("richardson"));
+    smoother_db->set("max_itr", 2);
+    smoother_db->set("tolerance", 1.0e-12);
+    smoother_db->set("Preconditioner", string("block jacobi"));
+
+    string coarsening[] = {"energy", "space-energy"};
+    RCP<Energy_Multigrid> prec[2];
+    for (int c = 0; c < 2; ++c)
+    {
+        RCP_ParameterList prec_db = rcp(new ParameterList("Prec"));
+        prec_db->set("Smoother", *smoother_db);
+        prec_db->set("Coarsening", coarsening[c]);
+
+        prec[c] = rcp(new Energy_Multigrid(
+                          db, prec_db, this->d_dim, mat, mesh, indexer, data,
+                          system));
+    }
+    ASSERT_GT(prec[1]->num_levels(), 1);
+
+    // the first space-energy level collapses pairs of groups and 2x2x2
+    // cells
+    profugus::Mesh_Coarsener coarsener(mesh, indexer, data);
+    coarsener.build();
+    const profugus::Mesh &coarse_mesh = *coarsener.get_mesh();
+    EXPECT_EQ(8 * coarse_mesh.num_cells(), mesh->num_cells());
+
+    int Ne  = this->d_dim->num_equations();
+    int Ng  = 12;
+    int Ngc = 6;
+
+    // a vector that is linear in space and in the group index
+    RCP<MV> x  = VT::build_vector(system->get_Map());
+    RCP<MV> xc = VT::build_vector(prec[1]->level_map(1));
+    RCP<MV> z  = VT::build_vector(system->get_Map());
+    VT::put_scalar(x, 0.0);
+    {
+        Teuchos::ArrayRCP<double> data_x = VT::get_data_nonconst(x);
+        for (int cell = 0; cell < mesh->num_cells(); ++cell)
+        {
+            profugus::Mesh::Dim_Vector ijk = mesh->cardinal(cell);
+            double v = mesh->center(ijk[I], I) +
+                       2.0 * mesh->center(ijk[J], J) +
+                       3.0 * mesh->center(ijk[K], K);
+            for (int n = 0; n < Ne; ++n)
+            {
+                for (int g = 0; g < Ng; ++g)
+                {
+                    data_x[g + Ng * (n + Ne * cell)] = v + g + 10.0 * n;
+                }
+            }
+        }
+    }
+
+    // the restriction averages the groups and the cells of each coarse cell,
+    // so it is exact for the linear vector
+    OPT::Apply(*prec[1]->restriction(0), *x, *xc);
+    Teuchos::ArrayRCP<const double> data_xc = VT::get_data(xc);
+    for (int cc = 0; cc < coarse_mesh.num_cells(); ++cc)
+    {
+        profugus::Mesh::Dim_Vector ijk = coarse_mesh.cardinal(cc);
+        double v = coarse_mesh.center(ijk[I], I) +
+                   2.0 * coarse_mesh.center(ijk[J], J) +
+                   3.0 * coarse_mesh.center(ijk[K], K);
+        for (int n = 0; n < Ne; ++n)
+        {
+            for (int G = 0; G < Ngc; ++G)
+            {
+                EXPECT_SOFTEQ(v + 2 * G + 0.5 + 10.0 * n,
+                              data_xc[G + Ngc * (n + Ne * cc)], 1.0e-12);
+            }
+        }
+    }
+
+    // the prolongation is piecewise constant over the coarse cells and
+    // groups
+    OPT::Apply(*prec[1]->prolongation(0), *xc, *z);
+    Teuchos::ArrayRCP<const double> data_z = VT::get_data(z);
+    for (int cell = 0; cell < mesh->num_cells(); ++cell)
+    {
+        int cc = coarsener.coarse_cell(cell);
+        for (int n = 0; n < Ne; ++n)
+        {
+            for (int g = 0; g < Ng; ++g)
+            {
+                EXPECT_SOFTEQ(data_xc[g / 2 + Ngc * (n + Ne * cc)],
+                              data_z[g + Ng * (n + Ne * cell)], 1.0e-12);
+            }
+        }
+    }
+
+    // spatial coarsening reduces the GMRES iterations on the heterogeneous
+    // problem (the smoother does little for smooth spatial modes)
+    RCP_ParameterList solver_db = rcp(new ParameterList("GMRES"));
+    solver_db->set("solver_type", string("profugus"));
+    solver_db->set("profugus_solver", string("gmres"));
+    solver_db->set("gmres_restart", 50);
+    solver_db->set("max_itr", 500);
+    solver_db->set("tolerance", 1.0e-8);
+
+    RCP<MV> b = VT::build_vector(system->get_Map());
+    VT::put_scalar(b, 1.0);
+
+    int iters[2];
+    for (int c = 0; c < 2; ++c)
+    {
+        RCP<profugus::LinearSolver<TypeParam> > solver =
+            profugus::LinearSolverBuilder<TypeParam>::build_solver(solver_db);
+        solver->set_operator(system->get_Operator());
+        solver->set_preconditioner(prec[c]);
+
+        VT::put_scalar(z, 0.0);
+        solver->solve(z, b);
+        EXPECT_TRUE(solver->converged());
+
+        iters[c] = solver->num_iters();
+        if (this->d_node == 0)
+        {
+            cout << coarsening[c] << " coarsening: " << prec[c]->num_levels()
+                 << " levels, " << iters[c] << " GMRES iterations" << endl;
+        }
+    }
+    EXPECT_LT(iters[1], iters[0]);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Chebyshev)
+{
+    typedef typename TestFixture::MV  MV;
+    typedef typename TestFixture::OPT OPT;
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+
+    // unpreconditioned Chebyshev smoother on the coarse levels (a polynomial
+    // in the operator preserves spatially flat vectors)
+    RCP_ParameterList smoother_db = rcp(new ParameterList("Smoother"));
+    smoother_db->set("solver_type", string("profugus"));
+    smoother_db->set("profugus_solver", string("chebyshev"));
+    smoother_db->set("max_itr", 3);
+    smoother_db->set("Preconditioner", string("none"));
+
+    // Richardson on the finest level
+    RCP_ParameterList fine_db = rcp(new ParameterList("Smoother Level 0"));
+    fine_db->set("solver_type", string("profugus"));
+    fine_db->set("profugus_solver", string("richardson"));
+    fine_db->set("max_itr", 2);
+    fine_db->set("tolerance", 1.0e-12);
+    fine_db->set("Preconditioner", string("none"));
+
+    RCP<MV> x = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    RCP<MV> y = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    RCP<MV> z = profugus::VectorTraits<TypeParam>::build_vector(
+        this->d_system->get_Map());
+    profugus::VectorTraits<TypeParam>::put_scalar(x,1.0);
+
+    RCP_ParameterList prec_db = rcp(new ParameterList("Prec"));
+    prec_db->set("Smoother", *smoother_db);
+    RCP<Energy_Multigrid> cheb = this->build_prec(prec_db);
+    prec_db->set("Smoother Level 0", *fine_db);
+    RCP<Energy_Multigrid> mixed = this->build_prec(prec_db);
+
+    OPT::Apply(*cheb,*x,*y);
+    OPT::Apply(*mixed,*x,*z);
+
+    // both V-cycles are spatially flat for the infinite medium problem
+    Teuchos::ArrayRCP<const double> data_y =
+        profugus::VectorTraits<TypeParam>::get_data(y);
+    Teuchos::ArrayRCP<const double> data_z =
+        profugus::VectorTraits<TypeParam>::get_data(z);
+
+    int Nu = data_y.size() / this->d_mesh->num_cells();
+    for (int cell = 1; cell < this->d_mesh->num_cells(); ++cell)
+    {
+        for (int u = 0; u < Nu; ++u)
+        {
+            EXPECT_SOFTEQ(data_y[u], data_y[u + Nu * cell], 1.0e-8);
+            EXPECT_SOFTEQ(data_z[u], data_z[u + Nu * cell], 1.0e-8);
+        }
+    }
+    EXPECT_GT(std::fabs(data_y[0]), 0.0);
+    EXPECT_GT(std::fabs(data_z[0]), 0.0);
+
+    // the finest level uses a different smoother
+    EXPECT_NE(data_y[0], data_z[0]);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstEnergy_Multigrid.cc
 //---------------------------------------------------------------------------//
@@ -566,6 +566,47 @@ TEST_F(FV_Gather_Test, 2_PE_3Grp_Test)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(FV_Gather_Test, Aggregated_Test)
+{
+    problem(3);
+
+    // gather all equations in one exchange
+    FV_Gather all(mesh, mom_coeff, *indexer);
+    all.start_gather(4);
+    all.finish_gather();
+
+    // gather one equation at a time
+    FV_Gather one(mesh, mom_coeff, *indexer);
+    for (int eqn = 0; eqn < 4; ++eqn)
+    {
+        one.gather(eqn);
+
+        for (int face = X; face <= Y; ++face)
+        {
+            RCP_Face_Field a[2] = {all.low_side_D(face, eqn),
+                                   all.high_side_D(face, eqn)};
+            RCP_Face_Field b[2] = {one.low_side_D(face),
+                                   one.high_side_D(face)};
+
+            for (int side = 0; side < 2; ++side)
+            {
+                EXPECT_EQ(b[side].is_null(), a[side].is_null());
+                if (b[side].is_null())
+                    continue;
+
+                ASSERT_EQ(b[side]->data_size(), a[side]->data_size());
+                for (int n = 0; n < b[side]->data_size(); ++n)
+                {
+                    EXPECT_EQ(b[side]->begin_data()[n],
+                              a[side]->begin_data()[n]);
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                        end of tstFV_Gather.cc
 //---------------------------------------------------------------------------//
@@ -2274,6 +2274,360 @@ TYPED_TEST(MatrixTest, SP7_3Grp_Fission_Matrix)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MatrixTest, SP3_2Grp_Vac_Chunked_Assembly)
+{
+    typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
+    typedef typename TestFixture::Matrix_t          Matrix_t;
+    typedef profugus::MatrixTraits<TypeParam>       MatrixTraits;
+    typedef profugus::VectorTraits<TypeParam>       VectorTraits;
+    typedef typename TypeParam::MV                  MV;
+    typedef typename TypeParam::OP                  OP;
+    typedef Anasazi::OperatorTraits<double,MV,OP>   OPT;
+
+    // build the mesh and data
+    this->build(3, 2);
+    RCP_ParameterList db = this->db;
+    db->set("boundary", string("vacuum"));
+
+    // build the matrices with the default chunk size (all cells in one
+    // chunk)
+    this->make_data();
+    RCP_Linear_System ref = this->system;
+    ref->build_Matrix();
+    ref->build_fission_matrix();
+
+    // build the matrices with chunks that do not divide the number of cells
+    // and with a staging memory that only holds one cell
+    for (int c = 0; c < 2; ++c)
+    {
+        if (c == 0)
+        {
+            db->set("assembly_chunk_size", 3);
+        }
+        else
+        {
+            db->set("assembly_chunk_size", 4096);
+            db->set("assembly_staging_mb", 1.0e-6);
+        }
+        this->make_data();
+        RCP_Linear_System system = this->system;
+        system->build_Matrix();
+        system->build_fission_matrix();
+
+        Teuchos::RCP<const Matrix_t> A_ref =
+            Teuchos::rcp_dynamic_cast<const Matrix_t>(ref->get_Operator());
+        Teuchos::RCP<const Matrix_t> A =
+            Teuchos::rcp_dynamic_cast<const Matrix_t>(
+                system->get_Operator());
+        Teuchos::RCP<const Matrix_t> B_ref =
+            Teuchos::rcp_dynamic_cast<const Matrix_t>(
+                ref->get_fission_matrix());
+        Teuchos::RCP<const Matrix_t> B =
+            Teuchos::rcp_dynamic_cast<const Matrix_t>(
+                system->get_fission_matrix());
+
+        EXPECT_EQ(MatrixTraits::global_nonzeros(A_ref),
+                  MatrixTraits::global_nonzeros(A));
+        EXPECT_EQ(MatrixTraits::global_nonzeros(B_ref),
+                  MatrixTraits::global_nonzeros(B));
+
+        // the operators must be identical
+        Teuchos::RCP<MV> x = VectorTraits::build_vector(system->get_Map());
+        Teuchos::RCP<MV> y = VectorTraits::build_vector(system->get_Map());
+        Teuchos::RCP<MV> y_ref =
+            VectorTraits::build_vector(system->get_Map());
+
+        Teuchos::ArrayRCP<double> x_data =
+            VectorTraits::get_data_nonconst(x,0);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.1 * (n % 7);
+        }
+
+        OPT::Apply(*A_ref,*x,*y_ref);
+        OPT::Apply(*A,*x,*y);
+        {
+            Teuchos::ArrayRCP<const double> a =
+                VectorTraits::get_data(y_ref,0);
+            Teuchos::ArrayRCP<const double> b = VectorTraits::get_data(y,0);
+            for (int n = 0; n < a.size(); ++n)
+            {
+                EXPECT_SOFTEQ(a[n], b[n], 1.0e-12);
+            }
+        }
+
+        OPT::Apply(*B_ref,*x,*y_ref);
+        OPT::Apply(*B,*x,*y);
+        {
+            Teuchos::ArrayRCP<const double> a =
+                VectorTraits::get_data(y_ref,0);
+            Teuchos::ArrayRCP<const double> b = VectorTraits::get_data(y,0);
+            for (int n = 0; n < a.size(); ++n)
+            {
+                EXPECT_SOFTEQ(a[n], b[n], 1.0e-12);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MatrixTest, SP3_2Grp_Matrix_Free)
+{
+    typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
+    typedef typename TestFixture::Matrix_t          Matrix_t;
+    typedef profugus::VectorTraits<TypeParam>       VectorTraits;
+    typedef typename TypeParam::MV                  MV;
+    typedef typename TypeParam::OP                  OP;
+    typedef Anasazi::OperatorTraits<double,MV,OP>   OPT;
+
+    Array_Dbl &cx = this->cx;
+    Array_Dbl &cy = this->cy;
+    Array_Dbl &cz = this->cz;
+
+    using def::I; using def::J; using def::K;
+
+    // make non-uniform mesh
+    cx.resize(5);
+    cy.resize(5);
+    cz.resize(5);
+
+    cx[0] = 0.0; cx[1] = 0.8; cx[2] = 1.7; cx[3] = 2.7; cx[4] = 3.8;
+    cy[0] = 0.0; cy[1] = 0.7; cy[2] = 1.5; cy[3] = 2.4; cy[4] = 3.4;
+    cz[0] = 0.0; cz[1] = 0.6; cz[2] = 1.3; cz[3] = 2.1; cz[4] = 3.0;
+
+    // build the mesh and data
+    this->build(3, 2);
+    RCP_ParameterList db = this->db;
+    RCP_Mesh mesh = this->mesh;
+    RCP_Indexer indexer = this->indexer;
+
+    // 2 materials
+    vector<int>    ids(2, 0);
+    vector<double> f(2, 0.0);
+    vector<int>    matids(mesh->num_cells(), 0);
+    ids[0] = 9;  f[0] = 0.9;
+    ids[1] = 11; f[1] = 1.1;
+
+    vector<int> gids(4*4*4, 0);
+    for (int k = 0; k < 4; ++k)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                gids[indexer->g2g(i, j, k)] = (i + j + k) % 2 ? 11 : 9;
+            }
+        }
+    }
+
+    for (int k = 0; k < mesh->num_cells_dim(K); ++k)
+    {
+        for (int j = 0; j < mesh->num_cells_dim(J); ++j)
+        {
+            for (int i = 0; i < mesh->num_cells_dim(I); ++i)
+            {
+                matids[indexer->l2l(i, j, k)] = gids[indexer->l2g(i, j, k)];
+            }
+        }
+    }
+
+    const char *bcs[] = {"vacuum", "reflect"};
+    for (int bc = 0; bc < 2; ++bc)
+    {
+        db->set("boundary", string(bcs[bc]));
+
+        // assembled operator
+        db->set("matrix_free", false);
+        this->make_data(ids, f, matids);
+        RCP_Linear_System ref = this->system;
+        ref->build_Matrix();
+        ref->build_fission_matrix();
+
+        // matrix-free operator
+        db->set("matrix_free", true);
+        this->make_data(ids, f, matids);
+        RCP_Linear_System system = this->system;
+        system->build_Matrix();
+        system->build_fission_matrix();
+
+        EXPECT_TRUE(system->get_Matrix().is_null());
+        EXPECT_FALSE(system->get_fission_matrix().is_null());
+        EXPECT_TRUE(Teuchos::rcp_dynamic_cast<const Matrix_t>(
+                        system->get_Operator()).is_null());
+
+        // the operators must agree
+        Teuchos::RCP<MV> x     = VectorTraits::build_vector(system->get_Map());
+        Teuchos::RCP<MV> y     = VectorTraits::build_vector(system->get_Map());
+        Teuchos::RCP<MV> y_ref = VectorTraits::build_vector(system->get_Map());
+
+        Teuchos::ArrayRCP<double> x_data =
+            VectorTraits::get_data_nonconst(x,0);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.1 * (n % 7) + 0.01 * node;
+        }
+
+        OPT::Apply(*ref->get_Operator(),*x,*y_ref);
+        OPT::Apply(*system->get_Operator(),*x,*y);
+
+        Teuchos::ArrayRCP<const double> a = VectorTraits::get_data(y_ref,0);
+        Teuchos::ArrayRCP<const double> b = VectorTraits::get_data(y,0);
+        EXPECT_EQ(a.size(), b.size());
+        for (int n = 0; n < a.size(); ++n)
+        {
+            EXPECT_SOFTEQ(a[n], b[n], 1.0e-12);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MatrixTest, SP3_2Grp_BSR)
+{
+    typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
+    typedef typename TestFixture::Matrix_t          Matrix_t;
+    typedef profugus::MatrixTraits<TypeParam>       MatrixTraits;
+    typedef profugus::VectorTraits<TypeParam>       VectorTraits;
+    typedef typename TypeParam::MV                  MV;
+    typedef typename TypeParam::OP                  OP;
+    typedef Anasazi::OperatorTraits<double,MV,OP>   OPT;
+
+    Array_Dbl &cx = this->cx;
+    Array_Dbl &cy = this->cy;
+    Array_Dbl &cz = this->cz;
+
+    using def::I; using def::J; using def::K;
+
+    // make non-uniform mesh
+    cx.resize(5);
+    cy.resize(5);
+    cz.resize(5);
+
+    cx[0] = 0.0; cx[1] = 0.8; cx[2] = 1.7; cx[3] = 2.7; cx[4] = 3.8;
+    cy[0] = 0.0; cy[1] = 0.7; cy[2] = 1.5; cy[3] = 2.4; cy[4] = 3.4;
+    cz[0] = 0.0; cz[1] = 0.6; cz[2] = 1.3; cz[3] = 2.1; cz[4] = 3.0;
+
+    // build the mesh and data
+    this->build(3, 2);
+    RCP_ParameterList db = this->db;
+    RCP_Mesh mesh = this->mesh;
+    RCP_Indexer indexer = this->indexer;
+
+    // 2 materials
+    vector<int>    ids(2, 0);
+    vector<double> f(2, 0.0);
+    vector<int>    matids(mesh->num_cells(), 0);
+    ids[0] = 9;  f[0] = 0.9;
+    ids[1] = 11; f[1] = 1.1;
+
+    vector<int> gids(4*4*4, 0);
+    for (int k = 0; k < 4; ++k)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                gids[indexer->g2g(i, j, k)] = (i + j + k) % 2 ? 11 : 9;
+            }
+        }
+    }
+
+    for (int k = 0; k < mesh->num_cells_dim(K); ++k)
+    {
+        for (int j = 0; j < mesh->num_cells_dim(J); ++j)
+        {
+            for (int i = 0; i < mesh->num_cells_dim(I); ++i)
+            {
+                matids[indexer->l2l(i, j, k)] = gids[indexer->l2g(i, j, k)];
+            }
+        }
+    }
+
+    const char *bcs[] = {"vacuum", "reflect"};
+    for (int bc = 0; bc < 2; ++bc)
+    {
+        db->set("boundary", string(bcs[bc]));
+
+        // assembled (point) operator
+        db->set("matrix_storage", string("crs"));
+        this->make_data(ids, f, matids);
+        RCP_Linear_System ref = this->system;
+        ref->build_Matrix();
+        ref->build_fission_matrix();
+
+        // block-sparse operator
+        db->set("matrix_storage", string("bsr"));
+        this->make_data(ids, f, matids);
+        RCP_Linear_System system = this->system;
+        system->build_Matrix();
+        system->build_fission_matrix();
+
+        EXPECT_TRUE(system->get_Matrix().is_null());
+        EXPECT_FALSE(system->get_fission_matrix().is_null());
+        EXPECT_TRUE(Teuchos::rcp_dynamic_cast<const Matrix_t>(
+                        system->get_Operator()).is_null());
+        EXPECT_FALSE(system->get_block_Matrix().is_null());
+
+        // the block rows are sized from the stencil, so the storage holds
+        // exactly the stored blocks
+        const profugus::BSR_Matrix<TypeParam> &A =
+            *system->get_block_Matrix();
+        std::size_t bs2 = A.block_size() * A.block_size();
+        EXPECT_EQ(A.num_blocks() * (bs2 * sizeof(double) + sizeof(int)) +
+                  (A.num_block_rows() + 1) * sizeof(int),
+                  A.storage_bytes());
+
+        // memory of the block and point storage (12 bytes per nonzero and
+        // a row offset for each row)
+        Teuchos::RCP<const Matrix_t> A_ref =
+            Teuchos::rcp_dynamic_cast<const Matrix_t>(ref->get_Operator());
+        double bsr_bytes = A.storage_bytes();
+        double crs_bytes =
+            MatrixTraits::local_rows(A_ref) * sizeof(int) +
+            static_cast<double>(MatrixTraits::global_nonzeros(A_ref)) *
+            (sizeof(double) + sizeof(int)) / nodes;
+        profugus::global_sum(bsr_bytes);
+        profugus::global_sum(crs_bytes);
+
+        // a 2x2 block takes 36 bytes and at least its 2 diagonal entries
+        // (24 bytes in CRS) are nonzero; with downscatter only most blocks
+        // have 3 nonzeros (36 bytes in CRS)
+        EXPECT_LE(bsr_bytes, 1.5 * crs_bytes);
+        if (node == 0)
+        {
+            std::cout << bcs[bc] << ": BSR storage " << bsr_bytes
+                      << " bytes, CRS storage " << crs_bytes << " bytes"
+                      << std::endl;
+        }
+
+        // the operators must agree
+        Teuchos::RCP<MV> x     = VectorTraits::build_vector(system->get_Map());
+        Teuchos::RCP<MV> y     = VectorTraits::build_vector(system->get_Map());
+        Teuchos::RCP<MV> y_ref = VectorTraits::build_vector(system->get_Map());
+
+        Teuchos::ArrayRCP<double> x_data =
+            VectorTraits::get_data_nonconst(x,0);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.1 * (n % 7) + 0.01 * node;
+        }
+
+        OPT::Apply(*ref->get_Operator(),*x,*y_ref);
+        OPT::Apply(*system->get_Operator(),*x,*y);
+
+        Teuchos::ArrayRCP<const double> a = VectorTraits::get_data(y_ref,0);
+        Teuchos::ArrayRCP<const double> b = VectorTraits::get_data(y,0);
+        EXPECT_EQ(a.size(), b.size());
+        for (int n = 0; n < a.size(); ++n)
+        {
+            EXPECT_SOFTEQ(a[n], b[n], 1.0e-12);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstLinear_System_FV.cc
 //---------------------------------------------------------------------------//
@@ -861,6 +861,44 @@ TEST_F(Moment_CoefficientsTest, F_3gp)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(Moment_CoefficientsTest, cache)
+{
+    make_dim(7);
+
+    Moment_Coefficients mc(db, dim, mat3);
+    int matid = mat3->matid(0);
+
+    Serial_Matrix M(3, 3), R(3, 3);
+
+    for (int n = 0; n < 4; ++n)
+    {
+        // every cell has the same material, so every cell gets the cached
+        // block
+        const Serial_Matrix &D = mc.D_block(n, matid);
+        for (int cell = 0; cell < 4; ++cell)
+        {
+            mc.make_D(n, cell, M);
+            check_matrices(D, M, 0.0);
+        }
+
+        for (int m = 0; m < 4; ++m)
+        {
+            const Serial_Matrix &A = mc.A_block(n, m, matid);
+            mc.make_A(n, m, 2, M);
+            check_matrices(A, M, 0.0);
+
+            // A is symmetric in (n,m) so only one block is stored
+            EXPECT_EQ(&A(0, 0), &mc.A_block(m, n, matid)(0, 0));
+        }
+    }
+
+    // A_00 is Sigma_0
+    mc.make_Sigma(0, matid, R);
+    check_matrices(mc.A_block(0, 0, matid), R, 1.0e-12);
+}
+
+//---------------------------------------------------------------------------//
+
 TEST(Static_Functions, Convert_U_to_Phi)
 {
     double u0 = 11.3;
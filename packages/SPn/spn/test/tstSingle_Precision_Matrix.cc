@@ -0,0 +1,203 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/test/tstSingle_Precision_Matrix.cc
+ * \author agent
+ * \date   Mon Oct 19 03:28:18 2026
+ * \brief  Single_Precision_Matrix and Single_Precision_Block_Jacobi unit test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "gtest/utils_gtest.hh"
+
+#include <vector>
+
+#include "AnasaziOperatorTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "solvers/LinAlgTypedefs.hh"
+#include "../Single_Precision_Matrix.hh"
+#include "../MatrixTraits.hh"
+#include "../VectorTraits.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+template <class T>
+class SinglePrecisionTest : public testing::Test
+{
+  protected:
+    void SetUp()
+    {
+        node  = profugus::node();
+        nodes = profugus::nodes();
+    }
+
+  protected:
+    int node, nodes;
+};
+
+using profugus::EpetraTypes;
+using profugus::TpetraTypes;
+typedef ::testing::Types<EpetraTypes,TpetraTypes> MyTypes;
+TYPED_TEST_CASE(SinglePrecisionTest, MyTypes);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(SinglePrecisionTest, Apply)
+{
+    typedef typename TypeParam::MAP               Map_t;
+    typedef typename TypeParam::MATRIX            Matrix_t;
+    typedef typename TypeParam::OP                OP;
+    typedef typename TypeParam::MV                MV;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    typedef profugus::MatrixTraits<TypeParam>     MatrixTraits;
+    typedef profugus::VectorTraits<TypeParam>     VectorTraits;
+
+    // 10 rows on each domain
+    int Nr = 10, N = Nr * this->nodes;
+
+    Teuchos::RCP<Map_t> map = MatrixTraits::build_map(Nr, N);
+
+    // periodic tridiagonal matrix (couples the first and last domains)
+    Teuchos::RCP<Matrix_t> A = MatrixTraits::construct_matrix(map, 3);
+    std::vector<int>    inds(3);
+    std::vector<double> vals(3);
+    for (int i = this->node * Nr; i < (this->node + 1) * Nr; ++i)
+    {
+        inds[0] = (i + N - 1) % N;
+        inds[1] = i;
+        inds[2] = (i + 1) % N;
+        vals[0] = -1.0 / 3.0;
+        vals[1] = 2.0 + 0.1 * i;
+        vals[2] = -1.0 / 7.0;
+
+        MatrixTraits::add_to_matrix(
+            A, i, 3,
+            Teuchos::arcp<const int>(&inds[0], 0, 3, false),
+            Teuchos::arcp<const double>(&vals[0], 0, 3, false));
+    }
+    MatrixTraits::finalize_matrix(A);
+
+    profugus::Single_Precision_Matrix<TypeParam> S(map, A);
+    EXPECT_EQ(3 * Nr, S.num_entries());
+
+    // compare the single- and double-precision matrices
+    Teuchos::RCP<MV> x     = VectorTraits::build_vector(map, 2);
+    Teuchos::RCP<MV> y     = VectorTraits::build_vector(map, 2);
+    Teuchos::RCP<MV> y_ref = VectorTraits::build_vector(map, 2);
+
+    for (int v = 0; v < 2; ++v)
+    {
+        Teuchos::ArrayRCP<double> x_data =
+            VectorTraits::get_data_nonconst(x, v);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.1 * ((n + this->node + v) % 5);
+        }
+    }
+
+    OPT::Apply(*A, *x, *y_ref);
+    OPT::Apply(S, *x, *y);
+
+    for (int v = 0; v < 2; ++v)
+    {
+        Teuchos::ArrayRCP<const double> a = VectorTraits::get_data(y_ref, v);
+        Teuchos::ArrayRCP<const double> b = VectorTraits::get_data(y, v);
+        for (int n = 0; n < a.size(); ++n)
+        {
+            EXPECT_SOFTEQ(a[n], b[n], 1.0e-6);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(SinglePrecisionTest, Block_Jacobi)
+{
+    typedef typename TypeParam::MAP               Map_t;
+    typedef typename TypeParam::MATRIX            Matrix_t;
+    typedef typename TypeParam::OP                OP;
+    typedef typename TypeParam::MV                MV;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+    typedef profugus::MatrixTraits<TypeParam>     MatrixTraits;
+    typedef profugus::VectorTraits<TypeParam>     VectorTraits;
+    typedef profugus::Single_Precision_Matrix<TypeParam> Single_t;
+
+    // 10 rows (5 blocks of 2) on each domain
+    int Nr = 10, N = Nr * this->nodes;
+
+    Teuchos::RCP<Map_t> map = MatrixTraits::build_map(Nr, N);
+
+    // periodic tridiagonal matrix; the couplings between blocks are
+    // ignored by the preconditioner
+    Teuchos::RCP<Matrix_t> A = MatrixTraits::construct_matrix(map, 3);
+    std::vector<int>    inds(3);
+    std::vector<double> vals(3);
+    for (int i = this->node * Nr; i < (this->node + 1) * Nr; ++i)
+    {
+        inds[0] = (i + N - 1) % N;
+        inds[1] = i;
+        inds[2] = (i + 1) % N;
+        vals[0] = -1.0 / 3.0;
+        vals[1] = 2.0 + 0.1 * i;
+        vals[2] = -1.0 / 7.0;
+
+        MatrixTraits::add_to_matrix(
+            A, i, 3,
+            Teuchos::arcp<const int>(&inds[0], 0, 3, false),
+            Teuchos::arcp<const double>(&vals[0], 0, 3, false));
+    }
+    MatrixTraits::finalize_matrix(A);
+
+    Teuchos::RCP<Single_t> S = Teuchos::rcp(new Single_t(map, A));
+
+    // diagonal blocks
+    std::vector<float> blocks;
+    S->diagonal_blocks(2, blocks);
+    ASSERT_EQ(2 * Nr, static_cast<int>(blocks.size()));
+    for (int b = 0; b < Nr / 2; ++b)
+    {
+        int i = this->node * Nr + 2 * b;
+        EXPECT_SOFTEQ(2.0 + 0.1 * i, blocks[4 * b], 1.0e-6);
+        EXPECT_SOFTEQ(-1.0 / 3.0, blocks[4 * b + 1], 1.0e-6);
+        EXPECT_SOFTEQ(-1.0 / 7.0, blocks[4 * b + 2], 1.0e-6);
+        EXPECT_SOFTEQ(2.1 + 0.1 * i, blocks[4 * b + 3], 1.0e-6);
+    }
+
+    profugus::Single_Precision_Block_Jacobi<TypeParam> D(S, 2);
+
+    Teuchos::RCP<MV> x = VectorTraits::build_vector(map);
+    Teuchos::RCP<MV> y = VectorTraits::build_vector(map);
+    {
+        Teuchos::ArrayRCP<double> x_data = VectorTraits::get_data_nonconst(x);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.1 * ((n + this->node) % 5);
+        }
+    }
+    OPT::Apply(D, *x, *y);
+
+    // solve the 2x2 blocks directly
+    Teuchos::ArrayRCP<const double> x_data = VectorTraits::get_data(x);
+    Teuchos::ArrayRCP<const double> y_data = VectorTraits::get_data(y);
+    for (int b = 0; b < Nr / 2; ++b)
+    {
+        int    i   = this->node * Nr + 2 * b;
+        double a11 = 2.0 + 0.1 * i, a12 = -1.0 / 7.0;
+        double a21 = -1.0 / 3.0,    a22 = 2.1 + 0.1 * i;
+        double det = a11 * a22 - a12 * a21;
+
+        double x1 = x_data[2 * b], x2 = x_data[2 * b + 1];
+        EXPECT_SOFTEQ((a22 * x1 - a12 * x2) / det, y_data[2 * b], 1.0e-5);
+        EXPECT_SOFTEQ((a11 * x2 - a21 * x1) / det, y_data[2 * b + 1], 1.0e-5);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstSingle_Precision_Matrix.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/test/tstSpace_Energy_Prolongation.cc
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Space_Energy_Prolongation test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "gtest/utils_gtest.hh"
+
+#include <vector>
+
+#include "AnasaziOperatorTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "solvers/LinAlgTypedefs.hh"
+#include "../Space_Energy_Prolongation.hh"
+#include "../MatrixTraits.hh"
+#include "../VectorTraits.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+template <class T>
+class SpaceProlongTest : public testing::Test
+{
+  protected:
+    void SetUp(){};
+};
+
+using profugus::EpetraTypes;
+using profugus::TpetraTypes;
+typedef ::testing::Types<EpetraTypes,TpetraTypes> MyTypes;
+TYPED_TEST_CASE(SpaceProlongTest, MyTypes);
+
+TYPED_TEST(SpaceProlongTest, Pairs)
+{
+    typedef typename TypeParam::MAP    Map_t;
+    typedef typename TypeParam::OP     OP;
+    typedef typename TypeParam::MV     MV;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+
+    // 8 fine spatial unknowns in pairs, 2 equations, 4 groups collapsed by 2
+    int Ns = 8;
+    int Ne = 2;
+    int Ng = 4;
+
+    int nodes = profugus::nodes();
+
+    // Create maps
+    int Nf = Ns*Ne*Ng, Nc = Nf/4;
+    Teuchos::RCP<Map_t> map0 =
+        profugus::MatrixTraits<TypeParam>::build_map(Nf,Nf*nodes);
+    Teuchos::RCP<Map_t> map1 =
+        profugus::MatrixTraits<TypeParam>::build_map(Nc,Nc*nodes);
+
+    Teuchos::RCP<MV> vec0 =
+        profugus::VectorTraits<TypeParam>::build_vector(map0);
+    Teuchos::RCP<MV> vec1 =
+        profugus::VectorTraits<TypeParam>::build_vector(map1);
+
+    std::vector<int> spatial(Ns);
+    for( int s=0; s<Ns; ++s )
+    {
+        spatial[s] = s/2;
+    }
+
+    std::vector<int> steer(2,2);
+    profugus::Space_Energy_Prolongation<TypeParam> prolong0(
+        map1, map0, spatial, steer );
+
+    double tol=1.e-12;
+
+    // Test prolongation
+    Teuchos::ArrayRCP<double> fine_data =
+        profugus::VectorTraits<TypeParam>::get_data_nonconst(vec0,0);
+    Teuchos::ArrayRCP<double> coarse_data =
+        profugus::VectorTraits<TypeParam>::get_data_nonconst(vec1,0);
+
+    for( int i=0; i<coarse_data.size(); ++i )
+    {
+        coarse_data[i] = static_cast<double>(i);
+    }
+
+    OPT::Apply(prolong0,*vec1,*vec0);
+
+    for( int s=0; s<Ns; ++s )
+    {
+        for( int n=0; n<Ne; ++n )
+        {
+            for( int g=0; g<Ng; ++g )
+            {
+                EXPECT_SOFTEQ(static_cast<double>(g/2 + 2*(n + Ne*(s/2))),
+                              fine_data[g + Ng*(n + Ne*s)], tol);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstSpace_Energy_Prolongation.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,110 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/test/tstSpace_Energy_Restriction.cc
+ * \author agent
+ * \date   Mon Oct 19 03:53:23 2026
+ * \brief  Space_Energy_Restriction test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "gtest/utils_gtest.hh"
+
+#include <vector>
+
+#include "AnasaziOperatorTraits.hpp"
+#include "AnasaziEpetraAdapter.hpp"
+#include "AnasaziTpetraAdapter.hpp"
+
+#include "solvers/LinAlgTypedefs.hh"
+#include "../Space_Energy_Restriction.hh"
+#include "../MatrixTraits.hh"
+#include "../VectorTraits.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+template <class T>
+class SpaceRestrictTest : public testing::Test
+{
+  protected:
+    void SetUp(){};
+};
+
+using profugus::EpetraTypes;
+using profugus::TpetraTypes;
+typedef ::testing::Types<EpetraTypes,TpetraTypes> MyTypes;
+TYPED_TEST_CASE(SpaceRestrictTest, MyTypes);
+
+TYPED_TEST(SpaceRestrictTest, Pairs)
+{
+    typedef typename TypeParam::MAP    Map_t;
+    typedef typename TypeParam::OP     OP;
+    typedef typename TypeParam::MV     MV;
+    typedef Anasazi::OperatorTraits<double,MV,OP> OPT;
+
+    // 8 fine spatial unknowns in pairs, 2 equations, 4 groups collapsed by 2
+    int Ns = 8;
+    int Ne = 2;
+    int Ng = 4;
+
+    int nodes = profugus::nodes();
+
+    // Create maps
+    int Nf = Ns*Ne*Ng, Nc = Nf/4;
+    Teuchos::RCP<Map_t> map0 =
+        profugus::MatrixTraits<TypeParam>::build_map(Nf,Nf*nodes);
+    Teuchos::RCP<Map_t> map1 =
+        profugus::MatrixTraits<TypeParam>::build_map(Nc,Nc*nodes);
+
+    Teuchos::RCP<MV> vec0 =
+        profugus::VectorTraits<TypeParam>::build_vector(map0);
+    Teuchos::RCP<MV> vec1 =
+        profugus::VectorTraits<TypeParam>::build_vector(map1);
+
+    // unequal weights within each pair
+    std::vector<int>    spatial(Ns);
+    std::vector<double> weights(Ns);
+    for( int s=0; s<Ns; ++s )
+    {
+        spatial[s] = s/2;
+        weights[s] = (s%2) ? 0.75 : 0.25;
+    }
+
+    std::vector<int> steer(2,2);
+    profugus::Space_Energy_Restriction<TypeParam> restrict0(
+        map0, map1, spatial, weights, steer );
+
+    double tol=1.e-12;
+
+    // Test restriction
+    Teuchos::ArrayRCP<double> fine_data =
+        profugus::VectorTraits<TypeParam>::get_data_nonconst(vec0,0);
+    Teuchos::ArrayRCP<double> coarse_data =
+        profugus::VectorTraits<TypeParam>::get_data_nonconst(vec1,0);
+
+    for( int i=0; i<fine_data.size(); ++i )
+    {
+        fine_data[i] = static_cast<double>(i);
+    }
+
+    OPT::Apply(restrict0,*vec0,*vec1);
+
+    // the fine value of (g,n,s) is g + Ng*(n + Ne*s)
+    for( int S=0; S<Ns/2; ++S )
+    {
+        for( int n=0; n<Ne; ++n )
+        {
+            for( int G=0; G<2; ++G )
+            {
+                double ref = (2*G + 0.5) + Ng*(n + Ne*(2*S + 0.75));
+                EXPECT_SOFTEQ(ref, coarse_data[G + 2*(n + Ne*S)], tol);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstSpace_Energy_Restriction.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,265 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/test/tstTime_Dependent_Solver.cc
+ * \author agent
+ * \date   Mon Oct 19 03:39:19 2026
+ * \brief  Test of Time_Dependent_Solver class.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "gtest/utils_gtest.hh"
+
+#include "Teuchos_StandardCatchMacros.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "utils/Definitions.hh"
+#include "mesh/Partitioner.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "../Dimensions.hh"
+#include "../Time_Dependent_Solver.hh"
+#include "../VectorTraits.hh"
+#include "Test_XS.hh"
+
+using namespace std;
+
+typedef profugus::Isotropic_Source             External_Source;
+typedef profugus::Partitioner                  Partitioner;
+typedef External_Source::Source_Shapes         Source_Shapes;
+typedef External_Source::Shape                 Shape;
+typedef External_Source::Source_Field          Source_Field;
+typedef External_Source::ID_Field              ID_Field;
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+template <class T>
+class Inf_Med_Time_Test : public testing::Test
+{
+  protected:
+
+    typedef profugus::Time_Dependent_Solver<T> Solver;
+    typedef Teuchos::RCP<Solver>               RCP_Solver;
+    typedef typename Solver::RCP_ParameterList RCP_ParameterList;
+    typedef typename Solver::RCP_Mat_DB        RCP_Mat_DB;
+    typedef typename Solver::RCP_Dimensions    RCP_Dimensions;
+    typedef typename Solver::RCP_Mesh          RCP_Mesh;
+    typedef typename Solver::RCP_Indexer       RCP_Indexer;
+    typedef typename Solver::RCP_Global_Data   RCP_Global_Data;
+
+  protected:
+
+    void SetUp()
+    {
+        node  = profugus::node();
+        nodes = profugus::nodes();
+
+        // 3x3x3 mesh
+        db = Teuchos::rcp(new Teuchos::ParameterList("test"));
+
+        db->set("delta_x", 1.0);
+        db->set("delta_y", 1.0);
+        db->set("delta_z", 1.0);
+
+        db->set("num_cells_i", 3);
+        db->set("num_cells_j", 3);
+        db->set("num_cells_k", 3);
+
+        if (nodes == 2)
+        {
+            db->set("num_blocks_i", 2);
+        }
+        if (nodes == 4)
+        {
+            db->set("num_blocks_i", 2);
+            db->set("num_blocks_j", 2);
+        }
+
+        db->set("tolerance", 1.0e-10);
+        db->sublist("timestep control").set("dt", 1.0);
+    }
+
+    void build()
+    {
+        Partitioner p(db);
+        p.build();
+
+        mesh    = p.get_mesh();
+        indexer = p.get_indexer();
+        data    = p.get_global_data();
+
+        solver = Teuchos::rcp(new Solver(db));
+
+        // one-group infinite medium with v = 1
+        mat = one_grp::make_mat(3, mesh->num_cells());
+        mat->get_xs()->set_velocities(
+            profugus::Mat_DB::XS_t::OneDArray(1, 1.0));
+
+        bool success = true, verbose = true;
+        try
+        {
+            dim = Teuchos::rcp(new profugus::Dimensions(1));
+
+            solver->setup(dim, mat, mesh, indexer, data);
+        }
+        TEUCHOS_STANDARD_CATCH_STATEMENTS(verbose, std::cerr, success);
+
+        // make the source
+        q = Teuchos::rcp(new External_Source(mesh->num_cells()));
+        Source_Shapes shapes(1, Shape(1, 1.2));
+        ID_Field srcids(mesh->num_cells(), 0);
+        Source_Field source(mesh->num_cells(), 1.0);
+        q->set(srcids, shapes, source);
+    }
+
+    void check(double ref, double eps = 1.0e-6)
+    {
+        Teuchos::ArrayRCP<const double> x =
+            profugus::VectorTraits<T>::get_data(solver->get_LHS());
+        for (int i = 0; i < x.size(); ++i)
+        {
+            EXPECT_SOFTEQ(ref, x[i], eps);
+        }
+    }
+
+  protected:
+
+    RCP_ParameterList db;
+
+    RCP_Mesh        mesh;
+    RCP_Indexer     indexer;
+    RCP_Global_Data data;
+
+    RCP_Mat_DB     mat;
+    RCP_Dimensions dim;
+
+    RCP_Solver solver;
+
+    Teuchos::RCP<External_Source> q;
+
+    int node, nodes;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+using profugus::EpetraTypes;
+using profugus::TpetraTypes;
+typedef ::testing::Types<EpetraTypes,TpetraTypes> MyTypes;
+TYPED_TEST_CASE(Inf_Med_Time_Test, MyTypes);
+
+// phi^n = (q + phi^{n-1}/(v dt)) / (sigma_a + 1/(v dt)) with q = 1.2 and
+// sigma_a = 0.6
+TYPED_TEST(Inf_Med_Time_Test, Fixed_Steps)
+{
+    this->db->sublist("timestep control").set("num_steps", 3);
+    this->build();
+
+    // record the time after every step
+    std::vector<double> times;
+    this->solver->set_step_callback(
+        [&times](const typename TestFixture::Solver &s)
+        { times.push_back(s.time()); });
+
+    this->solver->solve(this->q);
+
+    ASSERT_EQ(3, times.size());
+    EXPECT_SOFTEQ(1.0, times[0], 1.0e-12);
+    EXPECT_SOFTEQ(2.0, times[1], 1.0e-12);
+    EXPECT_SOFTEQ(3.0, times[2], 1.0e-12);
+
+    EXPECT_EQ(3, this->solver->num_steps_taken());
+    EXPECT_SOFTEQ(3.0, this->solver->time(), 1.0e-12);
+    EXPECT_EQ(3, this->solver->timestep()->cycle());
+    this->check(1.51171875);
+
+    // further solves continue from the last solution
+    this->solver->solve(this->q);
+    EXPECT_EQ(6, this->solver->num_steps_taken());
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(Inf_Med_Time_Test, Adaptive_Steps)
+{
+    // dt = 1, 2, 2 (the last step is cut to land on t = 5)
+    this->db->sublist("timestep control").set("final_time", 5.0);
+    this->db->sublist("timestep control").set("dt_growth", 2.0);
+    this->build();
+
+    const void *system = &this->solver->get_linear_system();
+
+    this->solver->step(this->q);
+    this->check(0.75);
+    EXPECT_EQ(system, &this->solver->get_linear_system());
+
+    // the timestep changes so the system is rebuilt
+    this->solver->step(this->q);
+    this->check(1.4318181818181817);
+    EXPECT_NE(system, &this->solver->get_linear_system());
+    system = &this->solver->get_linear_system();
+
+    // the timestep is unchanged so the system is reused
+    this->solver->solve(this->q);
+    this->check(1.7417355371900825);
+    EXPECT_EQ(system, &this->solver->get_linear_system());
+
+    EXPECT_EQ(3, this->solver->num_steps_taken());
+    EXPECT_SOFTEQ(5.0, this->solver->time(), 1.0e-12);
+
+    const auto &dts = this->solver->timestep()->timesteps();
+    ASSERT_EQ(3, dts.size());
+    EXPECT_EQ(1.0, dts[0]);
+    EXPECT_EQ(2.0, dts[1]);
+    EXPECT_EQ(2.0, dts[2]);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(Inf_Med_Time_Test, Error_Control)
+{
+    auto &tdb = this->db->sublist("timestep control");
+    tdb.set("dt", 0.5);
+    tdb.set("final_time", 10.0);
+    tdb.set("dt_control", std::string("error"));
+    tdb.set("dt_tolerance", 1.0e-2);
+    this->build();
+
+    // every accepted step meets the tolerance
+    int steps = 0;
+    this->solver->set_step_callback(
+        [&steps](const typename TestFixture::Solver &s)
+        {
+            EXPECT_LE(s.error_estimate(), 1.0e-2);
+            ++steps;
+        });
+
+    this->solver->solve(this->q);
+
+    EXPECT_EQ(steps, this->solver->num_steps_taken());
+    EXPECT_SOFTEQ(10.0, this->solver->time(), 1.0e-12);
+
+    // the initial step is too large and the step after it is rejected
+    EXPECT_GT(this->solver->num_steps_rejected(), 0);
+
+    // the timestep shrinks during the transient and grows as the solution
+    // approaches steady state
+    const auto &dts = this->solver->timestep()->timesteps();
+    ASSERT_EQ(steps, dts.size());
+    EXPECT_LT(dts[1], dts[0]);
+    EXPECT_GT(*std::max_element(dts.begin(), dts.end()), 1.0);
+    EXPECT_LT(steps, 40);
+
+    // phi(t) = 2(1 - exp(-0.6 t))
+    this->check(2.0 * (1.0 - std::exp(-6.0)), 1.0e-2);
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstTime_Dependent_Solver.cc
+//---------------------------------------------------------------------------//
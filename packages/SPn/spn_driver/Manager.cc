@@ -20,8 +20,32 @@
 #include "utils/Definitions.hh"
 #include "spn/Dimensions.hh"
 #include "spn/SpnSolverBuilder.hh"
+#include "spn/Time_Dependent_Solver.hh"
 #include "Manager.hh"
 
+namespace
+{
+
+//---------------------------------------------------------------------------//
+// Register a per-step output function with a time-dependent solver; returns
+// false if the solver is not a Time_Dependent_Solver<T>.
+template <class T>
+bool set_step_output(Teuchos::RCP<profugus::Solver_Base> solver,
+                     std::function<void(int)>            output)
+{
+    typedef profugus::Time_Dependent_Solver<T> Solver;
+
+    Teuchos::RCP<Solver> tdep = Teuchos::rcp_dynamic_cast<Solver>(solver);
+    if (tdep.is_null())
+        return false;
+
+    tdep->set_step_callback(
+        [output](const Solver &s) { output(s.num_steps_taken()); });
+    return true;
+}
+
+}
+
 namespace spn
 {
 
@@ -108,6 +132,31 @@ void Manager::setup(const std::string &xml_file)
     d_state = Teuchos::rcp(
         new profugus::State(d_mesh, d_mat->xs().num_groups()));
 
+    // write the fluxes every "output_interval" steps of a time-dependent
+    // problem
+    if (prob_type == "fixed_tdep")
+    {
+        int interval = d_db->sublist("timestep control").get(
+            "output_interval", 0);
+        VALIDATE(interval >= 0, "output_interval must be non-negative.");
+
+        if (interval > 0)
+        {
+            auto output = [this, interval](int step)
+            {
+                if (step % interval == 0)
+                    this->output_step(step);
+            };
+
+            bool registered =
+                set_step_output<profugus::EpetraTypes>(d_solver_base,
+                                                       output) ||
+                set_step_output<profugus::TpetraTypes>(d_solver_base,
+                                                       output);
+            CHECK(registered);
+        }
+    }
+
     ENSURE(!d_mesh.is_null());
     ENSURE(!d_indexer.is_null());
     ENSURE(!d_gdata.is_null());
@@ -142,8 +191,6 @@ void Manager::solve()
  */
 void Manager::output()
 {
-    using def::I; using def::J; using def::K;
-
     REQUIRE(!d_state.is_null());
     REQUIRE(!d_db.is_null());
 
@@ -168,7 +215,29 @@ void Manager::output()
     // Output filename
     std::ostringstream m;
     m << d_problem_name << "_output.h5";
-    std::string outfile = m.str();
+
+    write_fluxes(m.str());
+
+    profugus::global_barrier();
+
+    // >>> OUTPUT MATRICES
+    if (d_db->get<bool>("output_matrices", false))
+    {
+        d_solver_base->write_problem_to_file();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the state fluxes to an HDF5 file.
+ */
+void Manager::write_fluxes(const std::string &outfile) const
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(!d_state.is_null());
 
     // get a constant reference to the state
     const profugus::State &state = *d_state;
@@ -223,14 +292,28 @@ void Manager::output()
         writer.close();
     }
 #endif
+}
 
-    profugus::global_barrier();
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the fluxes after a time-dependent step.
+ *
+ * Called from the solver after the step is accepted.  The fluxes are written
+ * to "<problem_name>_step_<step>.h5".
+ */
+void Manager::output_step(int step)
+{
+    SCOPED_TIMER("Manager.output_step");
 
-    // >>> OUTPUT MATRICES
-    if (d_db->get<bool>("output_matrices", false))
-    {
-        d_solver_base->write_problem_to_file();
-    }
+    // write the current solution into the state
+    d_solver_base->write_state(*d_state);
+
+    std::ostringstream m;
+    m << d_problem_name << "_step_" << step << ".h5";
+
+    write_fluxes(m.str());
+
+    profugus::global_barrier();
 }
 
 } // end namespace spn
@@ -99,6 +99,12 @@ class Manager
     // Problem name.
     std::string d_problem_name;
 
+    // Write the state fluxes to an HDF5 file.
+    void write_fluxes(const std::string &outfile) const;
+
+    // Write the fluxes for a time-dependent step.
+    void output_step(int step);
+
     //! Output messages in a common format.
 #define SCREEN_MSG(stream)                            \
     {                                                 \
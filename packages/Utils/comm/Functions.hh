@@ -287,6 +287,28 @@ void receive_async_comm(Request& request, T *buffer,
         const Communicator_t& comm, int size,
         int source, int tag = Comm_Traits<T*>::tag);
 
+//---------------------------------------------------------------------------//
+// NON-BLOCKING GLOBAL REDUCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Start an element-wise, non-blocking global sum of an array.
+ *
+ * The sum is done in place; \a x must not be accessed until the request has
+ * been waited on.  Work that does not depend on the sum can be done between
+ * the post and the wait to hide the reduction latency.
+ *
+ * \return Request object to handle communciation requests
+ */
+template<class T>
+Request allreduce_async(T *x, int n);
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Start an element-wise, non-blocking global sum of an array.
+ */
+template<class T>
+void allreduce_async(Request &request, T *x, int n);
+
 //---------------------------------------------------------------------------//
 // BROADCAST
 //---------------------------------------------------------------------------//
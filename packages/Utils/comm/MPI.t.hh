@@ -226,6 +226,43 @@ void receive_async_comm(
               comm, &request.r());
 }
 
+//---------------------------------------------------------------------------//
+// NON-BLOCKING GLOBAL REDUCTIONS
+//---------------------------------------------------------------------------//
+
+template<class T>
+Request allreduce_async(T  *x,
+                        int n)
+{
+    // make a comm request handle
+    Request request;
+
+    // do an in-place MPI_Iallreduce (result is on all processors in x)
+    MPI_Iallreduce(MPI_IN_PLACE, x, n, MPI_Traits<T>::element_type(), MPI_SUM,
+                   communicator, &request.r());
+
+    // set the request to active
+    request.set();
+    return request;
+}
+
+//---------------------------------------------------------------------------//
+
+template<class T>
+void allreduce_async(Request &request,
+                     T       *x,
+                     int      n)
+{
+    REQUIRE(!request.inuse());
+
+    // set the request
+    request.set();
+
+    // post an in-place MPI_Iallreduce
+    MPI_Iallreduce(MPI_IN_PLACE, x, n, MPI_Traits<T>::element_type(), MPI_SUM,
+                   communicator, &request.r());
+}
+
 //---------------------------------------------------------------------------//
 // BROADCAST
 //---------------------------------------------------------------------------//
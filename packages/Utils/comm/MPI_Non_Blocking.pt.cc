@@ -94,6 +94,22 @@ template void receive_async_comm(Request &, float *, const MPI_Comm&, int, int,
 template void receive_async_comm(Request &, double *, const MPI_Comm&, int, int, int);
 template void receive_async_comm(Request &, long double *, const MPI_Comm&, int, int, int);
 
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATIONS OF NON-BLOCKING GLOBAL REDUCTIONS
+//---------------------------------------------------------------------------//
+
+template Request allreduce_async(int *, int);
+template Request allreduce_async(long *, int);
+template Request allreduce_async(float *, int);
+template Request allreduce_async(double *, int);
+template Request allreduce_async(long double *, int);
+
+template void allreduce_async(Request &, int *, int);
+template void allreduce_async(Request &, long *, int);
+template void allreduce_async(Request &, float *, int);
+template void allreduce_async(Request &, double *, int);
+template void allreduce_async(Request &, long double *, int);
+
 } // end namespace profugus
 
 #endif // COMM_MPI
@@ -151,6 +151,12 @@ class Request
     template<class T>
     friend void receive_async_comm(Request &r, T *buf,
             const Communicator_t& comm, int nels, int source, int tag);
+
+    template<class T>
+    friend Request allreduce_async(T *x, int n);
+
+    template<class T>
+    friend void allreduce_async(Request &r, T *x, int n);
 };
 
 } // end namespace profugus
@@ -242,6 +242,36 @@ void receive_async_comm(Request &request,
     internals::buffers[tag] = reinterpret_cast<void *>(buffer);
 }
 
+//---------------------------------------------------------------------------//
+// NON-BLOCKING GLOBAL REDUCTIONS
+//---------------------------------------------------------------------------//
+
+template<class T>
+Request allreduce_async(
+        T  * x,
+        int  n)
+{
+    // the sum is already complete; set the request so that it can be waited
+    // on
+    Request request;
+    request.set();
+    return request;
+}
+
+//---------------------------------------------------------------------------//
+
+template<class T>
+void allreduce_async(
+        Request & request,
+        T       * x,
+        int       n)
+{
+    REQUIRE(!request.inuse());
+
+    // set it
+    request.set();
+}
+
 //---------------------------------------------------------------------------//
 // BROADCAST
 //---------------------------------------------------------------------------//
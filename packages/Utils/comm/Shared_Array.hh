@@ -0,0 +1,182 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Utils/comm/Shared_Array.hh
+ * \author agent
+ * \date   Mon Oct 19 03:02:32 2026
+ * \brief  Shared_Array class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef Utils_comm_Shared_Array_hh
+#define Utils_comm_Shared_Array_hh
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "harness/DBC.hh"
+#include "Shared_Window.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Shared_Array
+ * \brief Fixed-size array that is local or shared across a node.
+ *
+ * A Shared_Array is built in local (per-domain) storage.  Calling \c share()
+ * moves it into a Shared_Window so that a single copy is held by each
+ * shared-memory node; after that the array must be treated as read-only on
+ * every domain (writes would race with reads on other domains).  Shared
+ * storage must be released with the collective \c free() before the last
+ * copy of the array is destroyed.  Pointers to the data are invalidated by
+ * \c allocate(), \c share(), and \c free().
+ *
+ * Only trivially-copyable types may be stored.
+ */
+//===========================================================================//
+
+template<class T>
+class Shared_Array
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Shared_Array requires a trivially-copyable type");
+
+  public:
+    //@{
+    //! Typedefs.
+    typedef T                 value_type;
+    typedef std::size_t       size_type;
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // Local storage.
+    std::vector<T> d_local;
+
+    // Shared storage.
+    std::shared_ptr<Shared_Window> d_window;
+
+    // Data and size.
+    T        *d_data;
+    size_type d_size;
+
+  public:
+    //! Constructor.
+    Shared_Array() : d_data(nullptr), d_size(0) {}
+
+    //! Copy constructor (shared storage is shared with \a rhs).
+    Shared_Array(const Shared_Array &rhs)
+        : d_local(rhs.d_local)
+        , d_window(rhs.d_window)
+        , d_size(rhs.d_size)
+    {
+        bind();
+    }
+
+    //! Assignment (shared storage is shared with \a rhs).
+    Shared_Array& operator=(const Shared_Array &rhs)
+    {
+        d_local  = rhs.d_local;
+        d_window = rhs.d_window;
+        d_size   = rhs.d_size;
+        bind();
+        return *this;
+    }
+
+    //! Allocate local storage of size \a n initialized to \a value.
+    void allocate(size_type n, const T &value = T())
+    {
+        REQUIRE(!shared());
+        d_local.assign(n, value);
+        d_size = n;
+        bind();
+    }
+
+    //! Move the array into node-shared storage (collective).
+    void share()
+    {
+        REQUIRE(!shared());
+
+        auto window = std::make_shared<Shared_Window>(d_size * sizeof(T));
+        if (window->is_node_master())
+        {
+            std::copy(d_local.begin(), d_local.end(),
+                      static_cast<T *>(window->base()));
+        }
+        window->sync();
+
+        d_window = window;
+        std::vector<T>().swap(d_local);
+        bind();
+
+        ENSURE(shared());
+    }
+
+    //! Release the storage of the array, which becomes empty (collective if
+    //! the array is shared).
+    void free()
+    {
+        if (shared())
+        {
+            d_window->free();
+            d_window.reset();
+        }
+        std::vector<T>().swap(d_local);
+        d_size = 0;
+        bind();
+
+        ENSURE(empty());
+    }
+
+    //! True if the array is held in node-shared storage.
+    bool shared() const { return static_cast<bool>(d_window); }
+
+    //! Number of elements.
+    size_type size() const { return d_size; }
+
+    //! True if the array is empty.
+    bool empty() const { return d_size == 0; }
+
+    //@{
+    //! Data access.
+    pointer data() { return d_data; }
+    const_pointer data() const { return d_data; }
+    //@}
+
+    //@{
+    //! Element access.
+    T& operator[](size_type i)
+    {
+        REQUIRE(i < d_size);
+        return d_data[i];
+    }
+    const T& operator[](size_type i) const
+    {
+        REQUIRE(i < d_size);
+        return d_data[i];
+    }
+    //@}
+
+  private:
+    // Point at the active storage.
+    void bind()
+    {
+        d_data = shared() ? static_cast<T *>(d_window->base())
+                          : d_local.data();
+    }
+};
+
+} // end namespace profugus
+
+#endif // Utils_comm_Shared_Array_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Shared_Array.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,186 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Utils/comm/Shared_Window.cc
+ * \author agent
+ * \date   Mon Oct 19 03:02:32 2026
+ * \brief  Shared_Window member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "harness/DBC.hh"
+#include "global.hh"
+#include "Shared_Window.hh"
+
+namespace profugus
+{
+
+#ifdef COMM_MPI
+
+//---------------------------------------------------------------------------//
+// MPI IMPLEMENTATION
+//---------------------------------------------------------------------------//
+
+namespace
+{
+
+//! Split the current communicator into shared-memory node communicators.
+MPI_Comm node_communicator()
+{
+    MPI_Comm node_comm;
+    int result = MPI_Comm_split_type(communicator, MPI_COMM_TYPE_SHARED,
+                                     node(), MPI_INFO_NULL, &node_comm);
+    INSIST(result == MPI_SUCCESS, "Failed to split node communicator");
+    return node_comm;
+}
+
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * The segment is allocated on the node master only; the other domains
+ * attach to it.
+ */
+Shared_Window::Shared_Window(std::size_t bytes)
+    : d_base(nullptr)
+    , d_bytes(bytes)
+    , d_freed(false)
+    , d_node_rank(0)
+    , d_node_comm(node_communicator())
+{
+    MPI_Comm_rank(d_node_comm, &d_node_rank);
+
+    MPI_Aint size = is_node_master() ? bytes : 0;
+    int result    = MPI_Win_allocate_shared(
+        size, 1, MPI_INFO_NULL, d_node_comm, &d_base, &d_win);
+    INSIST(result == MPI_SUCCESS, "Failed to allocate shared window of "
+           << bytes << " bytes");
+
+    // attach to the master's segment
+    if (!is_node_master())
+    {
+        MPI_Aint master_size = 0;
+        int      disp_unit   = 0;
+        MPI_Win_shared_query(d_win, 0, &master_size, &disp_unit, &d_base);
+        CHECK(static_cast<std::size_t>(master_size) == bytes);
+    }
+
+    // open a passive-target epoch for the life of the window
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, d_win);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Destructor.
+ */
+Shared_Window::~Shared_Window()
+{
+    CHECK(freed());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Release the window and the node communicator.
+ *
+ * This call is collective over the domains on the node.
+ */
+void Shared_Window::free()
+{
+    REQUIRE(!freed());
+
+    MPI_Win_unlock_all(d_win);
+    MPI_Win_free(&d_win);
+    MPI_Comm_free(&d_node_comm);
+
+    d_base  = nullptr;
+    d_bytes = 0;
+    d_freed = true;
+
+    ENSURE(freed());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Make writes by the node master visible to all domains on the node.
+ */
+void Shared_Window::sync()
+{
+    REQUIRE(!freed());
+
+    MPI_Win_sync(d_win);
+    MPI_Barrier(d_node_comm);
+    MPI_Win_sync(d_win);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Number of domains sharing the window.
+ */
+int Shared_Window::node_size() const
+{
+    REQUIRE(!freed());
+
+    int size = 0;
+    MPI_Comm_size(d_node_comm, &size);
+    return size;
+}
+
+#else
+
+//---------------------------------------------------------------------------//
+// SERIAL IMPLEMENTATION
+//---------------------------------------------------------------------------//
+
+Shared_Window::Shared_Window(std::size_t bytes)
+    : d_base(nullptr)
+    , d_bytes(bytes)
+    , d_freed(false)
+    , d_node_rank(0)
+    , d_local(bytes)
+{
+    d_base = d_local.data();
+}
+
+//---------------------------------------------------------------------------//
+
+Shared_Window::~Shared_Window()
+{
+    CHECK(freed());
+}
+
+//---------------------------------------------------------------------------//
+
+void Shared_Window::free()
+{
+    REQUIRE(!freed());
+
+    std::vector<char>().swap(d_local);
+    d_base  = nullptr;
+    d_bytes = 0;
+    d_freed = true;
+
+    ENSURE(freed());
+}
+
+//---------------------------------------------------------------------------//
+
+void Shared_Window::sync()
+{
+}
+
+//---------------------------------------------------------------------------//
+
+int Shared_Window::node_size() const
+{
+    return 1;
+}
+
+#endif
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Shared_Window.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Utils/comm/Shared_Window.hh
+ * \author agent
+ * \date   Mon Oct 19 03:02:32 2026
+ * \brief  Shared_Window class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef Utils_comm_Shared_Window_hh
+#define Utils_comm_Shared_Window_hh
+
+#include <cstddef>
+#include <vector>
+
+#include "Definitions.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Shared_Window
+ * \brief Block of memory shared by all domains on a shared-memory node.
+ *
+ * The current communicator is split into shared-memory (node) communicators
+ * and an MPI-3 shared window of the requested size is allocated on the node
+ * master (rank 0 of the node communicator).  All other domains on the node
+ * receive a pointer into the master's segment, so a read-only table stored
+ * in the window exists once per node instead of once per domain.
+ *
+ * Only the node master writes into the window; after writing, \c sync() must
+ * be called by all domains on the node before the data is read.  The window
+ * must be released with \c free(), which is collective on the node, before
+ * the object is destroyed and before profugus::finalize() is called.  The
+ * destructor makes no MPI calls because domains may destroy their objects in
+ * different orders; it only checks that \c free() was called.
+ *
+ * In serial builds the window is ordinary local storage and every domain is
+ * its own node master.
+ *
+ * Construction is collective over the current communicator.
+ */
+//===========================================================================//
+
+class Shared_Window
+{
+  public:
+    // Constructor (collective).
+    explicit Shared_Window(std::size_t bytes);
+
+    // Destructor.
+    ~Shared_Window();
+
+    // Release the window (collective on the node).
+    void free();
+
+    //! True if the window has been released.
+    bool freed() const { return d_freed; }
+
+    //! Base address of the window.
+    void* base() const { return d_base; }
+
+    //! Size of the window in bytes.
+    std::size_t bytes() const { return d_bytes; }
+
+    //! True if this domain writes the window data.
+    bool is_node_master() const { return d_node_rank == 0; }
+
+    // Make writes by the node master visible on the node (collective).
+    void sync();
+
+    // Number of domains sharing the window.
+    int node_size() const;
+
+  private:
+    // Disallow copy and assignment.
+    Shared_Window(const Shared_Window &);
+    Shared_Window& operator=(const Shared_Window &);
+
+    // Base address and size (a zero-byte window may have a null base).
+    void        *d_base;
+    std::size_t  d_bytes;
+
+    // True after free() has been called.
+    bool d_freed;
+
+    // Rank of this domain on the node.
+    int d_node_rank;
+
+#ifdef COMM_MPI
+    // Node communicator and window.
+    MPI_Comm d_node_comm;
+    MPI_Win  d_win;
+#else
+    // Local storage.
+    std::vector<char> d_local;
+#endif
+};
+
+} // end namespace profugus
+
+#endif // Utils_comm_Shared_Window_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Shared_Window.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,118 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Utils/utils/LRU_Cache.hh
+ * \author agent
+ * \date   Mon Oct 19 02:56:23 2026
+ * \brief  LRU_Cache class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef Utils_utils_LRU_Cache_hh
+#define Utils_utils_LRU_Cache_hh
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "harness/DBC.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class LRU_Cache
+ * \brief Bounded key/value cache with least-recently-used eviction.
+ *
+ * Values are stored in a list ordered from most- to least-recently used and
+ * indexed by an unordered map.  When the cache is full, inserting a new
+ * value evicts the least-recently used one.  References returned by find()
+ * and insert() are valid until the value is evicted.
+ *
+ * The cache is not thread-safe.
+ */
+/*!
+ * \example utils/test/tstLRU_Cache.cc
+ *
+ * Test of LRU_Cache.
+ */
+//===========================================================================//
+
+template<class Key, class T>
+class LRU_Cache
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef Key                      key_type;
+    typedef T                        mapped_type;
+    typedef std::pair<Key, T>        value_type;
+    typedef std::size_t              size_type;
+    //@}
+
+  private:
+    // Types.
+    typedef std::list<value_type>                         List;
+    typedef typename List::iterator                       list_iter;
+    typedef std::unordered_map<Key, list_iter>            Index;
+
+    // >>> DATA
+
+    // Values ordered from most- to least-recently used.
+    List d_items;
+
+    // Index into the list.
+    Index d_index;
+
+    // Maximum number of values.
+    size_type d_capacity;
+
+    // Hit and miss counters.
+    size_type d_hits, d_misses;
+
+  public:
+    // Constructor.
+    explicit LRU_Cache(size_type capacity = 1024);
+
+    // Find a value and mark it as most-recently used (null if not cached).
+    inline T* find(const Key &key);
+
+    // Insert a value (evicting the least-recently used value if full).
+    inline T& insert(const Key &key, const T &value);
+
+    // Clear the cache and reset the counters.
+    void clear();
+
+    // Change the capacity.
+    void set_capacity(size_type capacity);
+
+    // >>> ACCESSORS
+
+    //! Number of cached values.
+    size_type size() const { return d_items.size(); }
+
+    //! Maximum number of cached values.
+    size_type capacity() const { return d_capacity; }
+
+    //! Number of successful finds.
+    size_type hits() const { return d_hits; }
+
+    //! Number of unsuccessful finds.
+    size_type misses() const { return d_misses; }
+};
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+#include "LRU_Cache.i.hh"
+
+#endif // Utils_utils_LRU_Cache_hh
+
+//---------------------------------------------------------------------------//
+//                 end of LRU_Cache.hh
+//---------------------------------------------------------------------------//
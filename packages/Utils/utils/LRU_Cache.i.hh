@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Utils/utils/LRU_Cache.i.hh
+ * \author agent
+ * \date   Mon Oct 19 02:56:23 2026
+ * \brief  Member definitions of class LRU_Cache.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef Utils_utils_LRU_Cache_i_hh
+#define Utils_utils_LRU_Cache_i_hh
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+template<class Key, class T>
+LRU_Cache<Key,T>::LRU_Cache(size_type capacity)
+    : d_capacity(capacity)
+    , d_hits(0)
+    , d_misses(0)
+{
+    REQUIRE(d_capacity > 0);
+    d_index.reserve(d_capacity);
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find a value and mark it as most-recently used.
+ *
+ * \return pointer to the value or null if the key is not cached
+ */
+template<class Key, class T>
+T* LRU_Cache<Key,T>::find(const Key &key)
+{
+    auto itr = d_index.find(key);
+    if (itr == d_index.end())
+    {
+        ++d_misses;
+        return nullptr;
+    }
+    ++d_hits;
+
+    // move the value to the front of the list
+    d_items.splice(d_items.begin(), d_items, itr->second);
+    return &itr->second->second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Insert a value.
+ *
+ * \pre the key is not cached
+ */
+template<class Key, class T>
+T& LRU_Cache<Key,T>::insert(const Key &key,
+                            const T   &value)
+{
+    REQUIRE(!d_index.count(key));
+
+    // evict the least-recently used value
+    if (d_items.size() == d_capacity)
+    {
+        d_index.erase(d_items.back().first);
+        d_items.pop_back();
+    }
+
+    d_items.emplace_front(key, value);
+    d_index[key] = d_items.begin();
+
+    ENSURE(d_items.size() <= d_capacity);
+    return d_items.front().second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Clear the cache and reset the counters.
+ */
+template<class Key, class T>
+void LRU_Cache<Key,T>::clear()
+{
+    d_items.clear();
+    d_index.clear();
+    d_hits   = 0;
+    d_misses = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Change the capacity, evicting least-recently used values if needed.
+ */
+template<class Key, class T>
+void LRU_Cache<Key,T>::set_capacity(size_type capacity)
+{
+    REQUIRE(capacity > 0);
+
+    d_capacity = capacity;
+    while (d_items.size() > d_capacity)
+    {
+        d_index.erase(d_items.back().first);
+        d_items.pop_back();
+    }
+}
+
+} // end namespace profugus
+
+#endif // Utils_utils_LRU_Cache_i_hh
+
+//---------------------------------------------------------------------------//
+//                 end of LRU_Cache.i.hh
+//---------------------------------------------------------------------------//
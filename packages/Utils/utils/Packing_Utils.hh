@@ -231,6 +231,38 @@ inline Unpacker& operator>>(Unpacker &u, T &value)
     return u;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pack a std::vector into a stream (the size followed by the
+ * elements).
+ *
+ * Works in compute_buffer_size_mode() as well.
+ */
+template<class T>
+inline void pack_vector(Packer &p, const std::vector<T> &field)
+{
+    int size = field.size();
+    p << size;
+    for (const auto &value : field)
+        p << value;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Unpack a std::vector that was packed with pack_vector().
+ */
+template<class T>
+inline void unpack_vector(Unpacker &u, std::vector<T> &field)
+{
+    int size = 0;
+    u >> size;
+    CHECK(size >= 0);
+
+    field.resize(size);
+    for (auto &value : field)
+        u >> value;
+}
+
 //===========================================================================//
 // PACKING/UNPACKING SHORTCUT FUNCTIONS
 //===========================================================================//
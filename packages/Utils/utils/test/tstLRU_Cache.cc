@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   Utils/utils/test/tstLRU_Cache.cc
+ * \author agent
+ * \date   Mon Oct 19 02:56:23 2026
+ * \brief  LRU_Cache test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../LRU_Cache.hh"
+
+#include "gtest/utils_gtest.hh"
+
+using profugus::LRU_Cache;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(LRU_Cache, find_insert)
+{
+    LRU_Cache<int, double> cache(3);
+    EXPECT_EQ(3, cache.capacity());
+    EXPECT_EQ(0, cache.size());
+
+    EXPECT_EQ(nullptr, cache.find(1));
+    EXPECT_EQ(1.5, cache.insert(1, 1.5));
+    cache.insert(2, 2.5);
+    cache.insert(3, 3.5);
+    EXPECT_EQ(3, cache.size());
+
+    ASSERT_NE(nullptr, cache.find(2));
+    EXPECT_EQ(2.5, *cache.find(2));
+
+    EXPECT_EQ(2, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+
+    // values can be modified in place
+    *cache.find(3) = 4.0;
+    EXPECT_EQ(4.0, *cache.find(3));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(LRU_Cache, eviction)
+{
+    LRU_Cache<int, int> cache(3);
+    cache.insert(1, 10);
+    cache.insert(2, 20);
+    cache.insert(3, 30);
+
+    // use 1 so that 2 becomes the least-recently used
+    EXPECT_EQ(10, *cache.find(1));
+
+    cache.insert(4, 40);
+    EXPECT_EQ(3, cache.size());
+    EXPECT_EQ(nullptr, cache.find(2));
+    EXPECT_EQ(10, *cache.find(1));
+    EXPECT_EQ(30, *cache.find(3));
+    EXPECT_EQ(40, *cache.find(4));
+
+    // shrinking evicts the least-recently used values (1 then 3)
+    cache.set_capacity(1);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(nullptr, cache.find(1));
+    EXPECT_EQ(40, *cache.find(4));
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+    EXPECT_EQ(0, cache.hits());
+    EXPECT_EQ(0, cache.misses());
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstLRU_Cache.cc
+//---------------------------------------------------------------------------//